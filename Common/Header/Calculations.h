@@ -12,6 +12,8 @@
 #include "NMEA/Info.h"
 #include "NMEA/Derived.h"
 
+class RasterMap;
+
 typedef struct _THERMAL_HISTORY
 {
   bool   Valid;
@@ -137,6 +139,22 @@ double FinalGlideThroughTerrain(const double bearing,
 				bool *outofrange,
 				double *TerrainBase = NULL); 
 
+/**
+ * same as above but for concurrent use :
+ *  - <irange> is altitude lost per meter in <bearing> direction ( GlidePolar::MacCreadyAltitude() ),
+ *  - <map> is read without changing terrain rounding, RasterTerrain::Lock() must be held by caller.
+ */
+double FinalGlideThroughTerrain(const RasterMap* map,
+                                const double irange,
+                                const double bearing,
+                                const double start_lat,
+                                const double start_lon,
+                                const double start_alt,
+                                double *retlat, double *retlon,
+                                const double maxrange,
+                                bool *outofrange,
+                                double *TerrainBase = NULL);
+
 double FarFinalGlideThroughTerrain(const double bearing, NMEA_INFO *Basic, 
                                 DERIVED_INFO *Calculated,
                                 double *retlat, double *retlon,
@@ -15,7 +15,12 @@
 #define MAXFLARMLOCALS	50
 
 // Max Simultaneous traffic aka MAXTRAFFIC
+#ifdef UNDER_CE
 #define FLARM_MAX_TRAFFIC	50
+#else
+// OGN feeds at busy competition sites exceed 50 targets
+#define FLARM_MAX_TRAFFIC	500
+#endif
 #define MAX_FLARM_TRACES	5000
 
 // These are always used +1 for safety
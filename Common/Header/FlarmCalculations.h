@@ -2,7 +2,7 @@
 #define FLARMCALCULATIONS_H
 
 #include <math.h>
-#include <map>
+#include <unordered_map>
 #include <stdint.h>
 #include "ClimbAverageCalculator.h"
 
@@ -12,8 +12,10 @@ public:
   FlarmCalculations(void);
   ~FlarmCalculations(void);
   double Average30s(uint32_t RadioId, double curTime, double curAltitude);
+  // forget history of a traffic removed from slots
+  void Remove(uint32_t RadioId);
 private:
-  typedef std::map<uint32_t, ClimbAverageCalculator<30> > AverageCalculatorMap;
+  typedef std::unordered_map<uint32_t, ClimbAverageCalculator<30> > AverageCalculatorMap;
   AverageCalculatorMap averageCalculatorMap;
 };
 
@@ -0,0 +1,136 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   FlarmSlotIndex.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _FLARMSLOTINDEX_H_
+#define _FLARMSLOTINDEX_H_
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * RadioId => slot of `NMEA_INFO::FLARM_Traffic` hash table.
+ *
+ * Open addressing with linear probing and backward shift deletion, stored
+ * inside NMEA_INFO : it must stay trivially copyable, and all zero ( memset )
+ * is a valid empty index.
+ *
+ * RadioId 0 is never a valid traffic id and is used as empty entry marker.
+ */
+template<unsigned slot_count>
+class flarm_slot_index final {
+
+  static constexpr unsigned next_pow2(unsigned value) {
+    unsigned result = 1;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  // load factor <= 0.5
+  static constexpr unsigned table_size = next_pow2(2 * slot_count);
+  static constexpr unsigned table_mask = table_size - 1;
+
+  static_assert(slot_count < UINT16_MAX, "invalid slot_count");
+
+  struct entry_t {
+    uint32_t id;
+    uint16_t slot;
+  };
+
+  static unsigned hash(uint32_t id) {
+    // Fibonacci hashing, RadioId are often sequential
+    return (id * 2654435769U) >> 16;
+  }
+
+ public:
+  /**
+   * @return slot of <id> or -1 if not found.
+   */
+  int find(uint32_t id) const {
+    if (id == 0) {
+      return -1;
+    }
+    for (unsigned i = hash(id) & table_mask; table[i].id != 0; i = (i + 1) & table_mask) {
+      if (table[i].id == id) {
+        return table[i].slot;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * add or update <id>, ignored if index is full.
+   */
+  void insert(uint32_t id, unsigned slot) {
+    if (id == 0 || slot >= slot_count) {
+      return;
+    }
+    unsigned i = hash(id) & table_mask;
+    for (; table[i].id != 0; i = (i + 1) & table_mask) {
+      if (table[i].id == id) {
+        table[i].slot = slot;
+        return;
+      }
+    }
+    if (count < slot_count) {
+      table[i] = { id, static_cast<uint16_t>(slot) };
+      ++count;
+    }
+  }
+
+  void erase(uint32_t id) {
+    if (id == 0) {
+      return;
+    }
+    unsigned i = hash(id) & table_mask;
+    for (; table[i].id != id; i = (i + 1) & table_mask) {
+      if (table[i].id == 0) {
+        return; // not found
+      }
+    }
+    // shift back following entries of same cluster that are not at their home position.
+    unsigned j = i;
+    for (;;) {
+      j = (j + 1) & table_mask;
+      if (table[j].id == 0) {
+        break;
+      }
+      const unsigned home = hash(table[j].id) & table_mask;
+      // entry <j> can move to hole <i> only if its home is not inside ]i, j]
+      if (((j - home) & table_mask) >= ((j - i) & table_mask)) {
+        table[i] = table[j];
+        i = j;
+      }
+    }
+    table[i] = {};
+    --count;
+  }
+
+  void clear() {
+    for (auto& entry : table) {
+      entry = {};
+    }
+    count = 0;
+  }
+
+  /**
+   * true if index can't take one more entry.
+   */
+  bool full() const {
+    return count >= slot_count;
+  }
+
+ private:
+  entry_t table[table_size];
+  unsigned count;
+};
+
+#endif // _FLARMSLOTINDEX_H_
@@ -17,6 +17,7 @@
 #include "Poco/Event.h"
 #include "Time/PeriodClock.hpp"
 #include "Comm/PortConfig.h"
+#include "Calc/trail_store.h"
 
 
   #undef  GEXTERN
@@ -525,8 +526,7 @@ GEXTERN bool InfoWindowActive;
 // snail trail
 GEXTERN SNAIL_POINT SnailTrail[TRAILSIZE];
 GEXTERN	int SnailNext;
-GEXTERN LONG_SNAIL_POINT LongSnailTrail[LONGTRAILSIZE+1];
-GEXTERN	int LongSnailNext;
+GEXTERN trail_store<LONGTRAILSIZE> LongSnailTrail;
 GEXTERN int TrailLock;
 
 // Logger
@@ -853,6 +853,12 @@ GEXTERN bool SonarWarning;
 GEXTERN bool SonarWarning_Config;
 
 GEXTERN bool EnableAudioVario;
+GEXTERN double AudioVarioLiftThreshold; // m/s, beeps above
+GEXTERN double AudioVarioSinkThreshold; // m/s, sink tone below
+GEXTERN int AudioVarioLiftToneLow;      // Hz, at lift threshold
+GEXTERN int AudioVarioLiftToneHigh;     // Hz, at 5 m/s
+GEXTERN int AudioVarioSinkTone;         // Hz, at sink threshold
+GEXTERN int AudioVarioVolume;           // %
 
 //
 // ---------------------------------------------------------------------------
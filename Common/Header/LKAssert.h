@@ -19,7 +19,7 @@
 #else
   #include <cstdlib>
   extern void MSG_ASSERTION(int line, const TCHAR *filename);
-  #define LKASSERT(arg) {;if (!(arg)) {; StartupStore(_T("[ASSERT FAILURE] in %s line %d\n"),_T(__FILE__),__LINE__); MSG_ASSERTION(__LINE__,_T(__FILE__)); std::abort();}}
+  #define LKASSERT(arg) {;if (!(arg)) {; StartupStore(_T("[ASSERT FAILURE] in %s line %d\n"),_T(__FILE__),__LINE__); StartupStoreFlush(); MSG_ASSERTION(__LINE__,_T(__FILE__)); std::abort();}}
 #endif
 #else
   #define LKASSERT(arg)
@@ -337,6 +337,12 @@ extern const char szRegistry_earth_model_wgs84[];
 
 extern const char szRegistrySoundSwitch[];
 extern const char szRegistryEnableAudioVario[];
+extern const char szRegistryAudioVarioLiftThreshold[];
+extern const char szRegistryAudioVarioSinkThreshold[];
+extern const char szRegistryAudioVarioLiftToneLow[];
+extern const char szRegistryAudioVarioLiftToneHigh[];
+extern const char szRegistryAudioVarioSinkTone[];
+extern const char szRegistryAudioVarioVolume[];
 
 void InitDefaultComPort();
 
@@ -27,6 +27,12 @@ class ReplayLogger {
   static void SetFilename(const TCHAR *name);
   static bool IsEnabled(void);
   static double TimeScale;
+  /**
+   * if > 0, replay time is driven by a simulated clock : each Update()
+   * advance replay of SimulatedStep seconds, whatever the wall clock and
+   * TimeScale. Used by headless replay to run as fast as cpu allow.
+   */
+  static double SimulatedStep;
  private:
   static bool UpdateInternal(void);
   static bool ReadLine(TCHAR *buffer);
@@ -215,13 +215,6 @@ typedef struct _SNAIL_POINT
   double DriftFactor;
 } SNAIL_POINT;
 
-typedef struct _LONG_SNAIL_POINT
-{
-  float Latitude;
-  float Longitude;
-  bool FarVisible;
-} LONG_SNAIL_POINT;
-
 typedef struct {
     bool Border;
     bool FillBackground;
@@ -257,6 +250,7 @@ typedef struct
 } DiagrammStruct;
 
 class ScreenProjection;
+class frame_arena;
 
 class MapWindow {
  public:
@@ -464,6 +458,13 @@ class MapWindow {
 
  public:
 
+  /**
+   * scratch memory for containers local to drawing functions, released at end
+   * of RenderMapWindow. Only usable from drawing code : draw thread, or main
+   * thread with OpenGL.
+   */
+  static frame_arena& FrameArena();
+
   // 12 is number of airspace types
   static LKColor Colours[NUMAIRSPACECOLORS];
   static LKPen hAirspacePens[AIRSPACECLASSCOUNT];
@@ -629,6 +630,7 @@ class MapWindow {
   static void DrawWelcome8000(LKSurface& Surface, const RECT& rc);
   static void DrawFlightMode(LKSurface& Surface, const RECT& rc);
   static void DrawGPSStatus(LKSurface& Surface, const RECT& rc);
+  static void DrawProfilerHud(LKSurface& Surface, const RECT& rc);
   static void DrawFunctions1HZ(LKSurface& Surface, const RECT& rc);
 
   static void DrawYGrid(LKSurface& Surface, const RECT& rc, double ticstep,double unit_step, double zero, int iTextAling,
@@ -698,7 +700,6 @@ protected:
 #endif
 private:
   static int iSnailNext;
-  static int iLongSnailNext;
 
 #ifndef ENABLE_OPENGL
   static LKWindowSurface WindowSurface; // used as AttribDC for Bitmap Surface.
@@ -1,6 +1,10 @@
 #if !defined(AFX_MCREADY_H__695AAC30_F401_4CFF_9BD9_FE62A2A2D0D2__INCLUDED_)
 #define AFX_MCREADY_H__695AAC30_F401_4CFF_9BD9_FE62A2A2D0D2__INCLUDED_
 
+#include <memory>
+
+class MacCreadySolver;
+
 class GlidePolar {
  public:
 
@@ -23,6 +27,12 @@ class GlidePolar {
   static void SetBallast();
   static double GetAUW();
 
+  /**
+   * solver for current polar, ballast and bugs, replaced by SetBallast().
+   * thread safe, can be nullptr before first SetBallast().
+   */
+  static std::shared_ptr<const MacCreadySolver> Solver();
+
   static double SafetyMacCready;
 
   //  static double BallastFactor;
@@ -108,6 +118,8 @@ private:
 
 	static unsigned _Vminsink; //@ unsigned int, because is Array index of _sinkratecache (iRound(v*2)) integer m/s values
 	static unsigned _Vbestld;
+
+	static std::shared_ptr<const MacCreadySolver> _solver;
 };
 
 #endif
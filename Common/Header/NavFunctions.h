@@ -1,6 +1,9 @@
 #if !defined(NAVFUNCTIONS_H)
 #define NAVFUNCTIONS_H
 
+#include <cstddef>
+
+struct GeoPoint;
 
 void xXY_Brg_Rng(double X_1, double Y_1, double X_2, double Y_2, double *Bearing, double *Range);
 
@@ -8,6 +11,13 @@ void DistanceBearing(double lat1, double lon1,
                      double lat2, double lon2,
                      double *Distance, double *Bearing);
 
+/**
+ * Distance and bearing from <origin> to <count> points.
+ * <Distance> or <Bearing> can be null.
+ */
+void DistanceBearing(const GeoPoint& origin, const GeoPoint* dest, size_t count,
+                     double *Distance, double *Bearing);
+
 double DoubleDistance(double lat1, double lon1,
                       double lat2, double lon2,
                       double lat3, double lon3);
@@ -16,6 +26,12 @@ void FindLatitudeLongitude(double Lat, double Lon,
                            double Bearing, double Distance,
                            double *lat_out, double *lon_out);
 
+/**
+ * Position of <count> points at <Bearing>[i] and <Distance>[i] from <origin>
+ */
+void FindLatitudeLongitude(const GeoPoint& origin, const double *Bearing, const double *Distance,
+                           size_t count, GeoPoint *out);
+
 double CrossTrackError(double lon1, double lat1,
                        double lon2, double lat2,
                        double lon3, double lat3,
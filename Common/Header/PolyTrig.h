@@ -0,0 +1,92 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   PolyTrig.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef POLYTRIG_H
+#define POLYTRIG_H
+
+#include <cmath>
+
+/*
+ * Polynomial approximation of trigonometric functions, accurate to 1 or 2 ulp.
+ * (fdlibm kernel_sin/kernel_cos and cephes atan coefficients)
+ *
+ * Unlike libm functions, they don't branch nor set errno, so loops over
+ * arrays using them can be vectorized by compiler.
+ * Range reduction is only accurate for |x| < 1e5 radian.
+ *
+ * Unlike table based `fastsine()` / `fastcosine()` from MathFunctions.h,
+ * they are accurate enough for geodesic computation.
+ */
+
+/**
+ * sine and cosine of x (radian)
+ */
+inline void poly_sin_cos(double x, double &s, double &c) {
+  // pi/2 split in 3 parts, q * PIO2_1 is exact
+  constexpr double PIO2_1 = 1.57079632673412561417e+00;
+  constexpr double PIO2_2 = 6.07710050630396597660e-11;
+  constexpr double PIO2_3 = 2.02226624879595063154e-21;
+  constexpr double INV_PIO2 = 6.36619772367581382433e-01;
+
+  // round to nearest, without call to floor() or nearbyint()
+  const double xq = x * INV_PIO2;
+  const double q = static_cast<int>(xq + ((xq < 0) ? -0.5 : 0.5));
+  const double r = ((x - q * PIO2_1) - q * PIO2_2) - q * PIO2_3;
+  const double z = r * r;
+
+  // |r| <= pi/4
+  const double sr = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03
+                  + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06
+                  + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+  const double cr = 1. - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03
+                  + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07
+                  + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+
+  const int quadrant = static_cast<int>(q) & 3;
+  const double s0 = (quadrant & 1) ? cr : sr;
+  const double c0 = (quadrant & 1) ? sr : cr;
+  s = (quadrant & 2) ? -s0 : s0;
+  c = (quadrant == 1 || quadrant == 2) ? -c0 : c0;
+}
+
+/**
+ * arc tangent of y/x in [-pi, pi], 0 if x == y == 0
+ */
+inline double poly_atan2(double y, double x) {
+  constexpr double PIO2 = 1.57079632679489661923;
+  constexpr double PIO4 = 7.85398163397448309616E-1;
+  constexpr double PI = 3.14159265358979323846;
+
+  const double ax = std::fabs(x);
+  const double ay = std::fabs(y);
+  const double max = (ax > ay) ? ax : ay;
+  const double min = (ax > ay) ? ay : ax;
+  const double t = min / ((max > 0) ? max : 1.);
+
+  // t in [0, 1]
+  const bool reduce = (t > 0.66);
+  // division is always done : allow compiler to use select instead of branch
+  const double t_reduced = (t - 1.) / (t + 1.);
+  const double u = reduce ? t_reduced : t;
+  const double z = u * u;
+  const double p = (((-8.750608600031904122785E-1 * z - 1.615753718733365076637E1) * z
+                   - 7.500855792314704667340E1) * z - 1.228866684490136173410E2) * z
+                   - 6.485021904942025371773E1;
+  const double q = ((((z + 2.485846490142306297962E1) * z + 1.650270098316988542046E2) * z
+                   + 4.328810604912902668951E2) * z + 4.853903996359136964868E2) * z
+                   + 1.945506571482613964425E2;
+  const double a = u + u * z * p / q + (reduce ? PIO4 : 0.);
+
+  const double r0 = (ay > ax) ? PIO2 - a : a;
+  const double r1 = (x < 0) ? PI - r0 : r0;
+  return (y < 0) ? -r1 : r1;
+}
+
+#endif /* POLYTRIG_H */
@@ -25,8 +25,22 @@ struct TERRAIN_INFO {
 
 class RasterMap final {
  public:
+  /**
+   * terrain sampling resolution, see `GetFieldRounding()`
+   */
+  struct FieldRounding {
+    int xlleft;
+    int xlltop;
+
+    bool Interpolate;
+
+    double fXrounding, fYrounding;
+    double fXroundingFine, fYroundingFine;
+    int Xrounding, Yrounding;
+  };
+
   RasterMap() {
-    Interpolate = false;
+    Rounding = {};
 
     TerrainMem = nullptr;
   }
@@ -50,7 +64,17 @@ class RasterMap final {
 
   void SetFieldRounding(double xr, double yr);
 
-  inline short GetField(const double &Latitude, const double &Longitude) const;
+  /**
+   * same as `SetFieldRounding()` but without changing map state :
+   *  result can be used by many threads at once with `GetField(rounding, ...)`
+   */
+  FieldRounding GetFieldRounding(double xr, double yr) const;
+
+  inline short GetField(const double &Latitude, const double &Longitude) const {
+    return GetField(Rounding, Latitude, Longitude);
+  }
+
+  inline short GetField(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const;
 
   bool Open(const TCHAR* filename);
   void Close();
@@ -58,20 +82,19 @@ class RasterMap final {
 protected:
   friend class TerrainRenderer;
 
-  inline bool interpolate() const { return Interpolate; }
-  inline short GetFieldInterpolate(const double &Latitude, const double &Longitude) const;
-  inline short GetFieldFine(const double &Latitude, const double &Longitude) const;
+  inline bool interpolate() const { return Rounding.Interpolate; }
+  inline short GetFieldInterpolate(const double &Latitude, const double &Longitude) const {
+    return GetFieldInterpolate(Rounding, Latitude, Longitude);
+  }
+  inline short GetFieldFine(const double &Latitude, const double &Longitude) const {
+    return GetFieldFine(Rounding, Latitude, Longitude);
+  }
 
  private:
+  inline short GetFieldInterpolate(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const;
+  inline short GetFieldFine(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const;
 
-  int xlleft;
-  int xlltop;
-
-  bool Interpolate;
-
-  double fXrounding, fYrounding;
-  double fXroundingFine, fYroundingFine;
-  int Xrounding, Yrounding;
+  FieldRounding Rounding;
 
   TERRAIN_INFO TerrainInfo;
   const short* TerrainMem;
@@ -92,11 +115,11 @@ protected:
  * @optimization : return invalid terrain for right&bottom line.
  */
 inline
-short RasterMap::GetFieldInterpolate(const double &Latitude, const double &Longitude) const {
-    assert(Interpolate);
+short RasterMap::GetFieldInterpolate(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const {
+    assert(rounding.Interpolate);
 
-    unsigned int lx = (int)(Longitude * fXroundingFine) - xlleft;
-    unsigned int ly = xlltop - (int) (Latitude * fYroundingFine);
+    unsigned int lx = (int)(Longitude * rounding.fXroundingFine) - rounding.xlleft;
+    unsigned int ly = rounding.xlltop - (int) (Latitude * rounding.fYroundingFine);
 
     const unsigned ix = CombinedDivAndMod(lx);
     const unsigned iy = CombinedDivAndMod(ly);
@@ -146,13 +169,13 @@ short RasterMap::GetFieldInterpolate(const double &Latitude, const double &Longi
  * @optimization : return invalid terrain for right&bottom line.
  */
 inline
-short RasterMap::GetFieldFine(const double &Latitude, const double &Longitude) const {
+short RasterMap::GetFieldFine(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const {
     if(gcc_unlikely(Longitude < TerrainInfo.Left || Latitude > TerrainInfo.Top)) {
         return TERRAIN_INVALID;
     }
 
-    const unsigned int lx = uround((Longitude - TerrainInfo.Left) * fXrounding) * Xrounding;
-    const unsigned int ly = uround((TerrainInfo.Top - Latitude) * fYrounding) * Yrounding;
+    const unsigned int lx = uround((Longitude - TerrainInfo.Left) * rounding.fXrounding) * rounding.Xrounding;
+    const unsigned int ly = uround((TerrainInfo.Top - Latitude) * rounding.fYrounding) * rounding.Yrounding;
 
     if (gcc_unlikely(lx >= (TerrainInfo.Columns) || ly >= (TerrainInfo.Rows))) {
         return TERRAIN_INVALID;
@@ -164,11 +187,11 @@ short RasterMap::GetFieldFine(const double &Latitude, const double &Longitude) c
 }
 
 inline
-short RasterMap::GetField(const double &Latitude, const double &Longitude) const {
-    if (interpolate()) {
-        return GetFieldInterpolate(Latitude, Longitude);
+short RasterMap::GetField(const FieldRounding& rounding, const double &Latitude, const double &Longitude) const {
+    if (rounding.Interpolate) {
+        return GetFieldInterpolate(rounding, Latitude, Longitude);
     } else {
-        return GetFieldFine(Latitude, Longitude);
+        return GetFieldFine(rounding, Latitude, Longitude);
     }
 }
 
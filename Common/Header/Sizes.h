@@ -48,6 +48,7 @@
 #define MAXTASKPOINTS 50
 #define MAXSTARTPOINTS 20
 
+// whole flight, decimated when full ( see Calc/trail_store.h )
 #define LONGTRAILSIZE 600
 // 1000 points at 3.6 seconds average = one hour
 #define TRAILSIZE 1000
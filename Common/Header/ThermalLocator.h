@@ -1,35 +1,7 @@
 #ifndef THERMALLOCATOR_H
 #define THERMALLOCATOR_H
 
-#define TLOCATOR_NMIN 5
-#define TLOCATOR_NMAX 60
-
-#include "leastsqs.h"
-
-class ThermalLocator_Point {
- public:
-  ThermalLocator_Point() {
-    valid = false;
-  }
-  double latitude;
-  double longitude;
-  double t;
-  double w;
-  //  double logw;
-  double d;
-  bool valid;
-  double weight;
-
-  void Drift(double t_0,
-	     double longitude_0, double latitude_0,
-	     double wind_lon, double wind_lat, double decay);
-  double x;
-  double y;
-  int xiw;
-  int yiw;
-  int iweight;
-  int iw;
-};
+#include "Calc/thermal_estimator.h"
 
 class ThermalLocator {
  public:
@@ -46,8 +18,6 @@ class ThermalLocator {
 	      double *Thermal_W,
 	      double *Thermal_R);
 
-  //  double Estimate(double t_x, double t_y);
-
   void EstimateThermalBase(double Thermal_Longitude,
 			   double Thermal_Latitude,
 			   double altitude,
@@ -57,34 +27,22 @@ class ThermalLocator {
 			   double *ground_longitude,
 			   double *ground_latitude,
 			   double *ground_alt);
-  double est_x;
-  double est_y;
-  double est_w;
-  double est_r;
-  double est_t;
-  double est_latitude;
-  double est_longitude;
- private:
 
-  void Update_Internal(double t_0,
-                       double longitude_0, double latitude_0,
-                       double traildrift_lon, double traildrift_lat,
-                       double trackbearing,
-                       double decay,
-                       double *Thermal_Longitude,
-                       double *Thermal_Latitude,
-                       double *Thermal_W,
-                       double *Thermal_R);
+ private:
+  thermal_estimator estimator;
 
-  void Drift(double t_0,
-	     double longitude_0, double latitude_0,
-	     double wind_lon, double wind_lat, double decay);
-  ThermalLocator_Point points[TLOCATOR_NMAX];
-  LeastSquares ols;
+  // local frame, origin is first point after reset
   bool initialised;
-  int nindex;
-  int npoints;
-
+  double origin_latitude;
+  double origin_longitude;
+  double origin_cosine;
+
+  // last point, added to estimator on next update with current wind
+  double point_t;
+  double point_latitude;
+  double point_longitude;
+  double point_w;
+  bool point_valid;
 };
 
 #endif
@@ -33,7 +33,7 @@
 # error This library requires C++
 #endif
 
-#define MAX_STATISTICS 1000
+#include "utils/time_series.h"
 
 class LeastSquares {
 
@@ -55,9 +55,8 @@ class LeastSquares {
 
   double y_ave;
 
-  float xstore[MAX_STATISTICS];
-  float ystore[MAX_STATISTICS];
-  float weightstore[MAX_STATISTICS];
+  // all points, decimated to bounded memory, for analysis graphs
+  time_series series;
 
   LeastSquares() {
     Reset();
@@ -59,6 +59,11 @@ N and E lat and long are positive, S and W negative
 double SGMagVar( double lat, double lon, double h, long dat );
 
 
+struct NMEA_INFO;
+
+/* evaluate magnetic variation grid around <Basic> position */
+void PrefetchMagneticVariation(const NMEA_INFO& Basic);
+
 /* return Magenetic vartion of current position in degree */
 double CalculateMagneticVariation();
 
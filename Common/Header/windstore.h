@@ -18,7 +18,10 @@
 #ifndef WINDSTORE_H
 #define WINDSTORE_H
 
-#include "windmeasurementlist.h"
+#include "Calc/wind_profile.h"
+
+using Vector = Point2D<double>;
+
 struct NMEA_INFO;
 struct DERIVED_INFO;
 
@@ -64,7 +67,7 @@ private:
   Vector _lastWind = {};
   double _lastAltitude = -10000.0; // invalide altitude for warantly first calculation done.
 
-  WindMeasurementList windlist ;
+  wind_profile windlist;
 
   /** Recalculates the wind from the stored measurements.
     * May result in a newWind signal. */
@@ -21,6 +21,7 @@
 #include "utils/stringext.h"
 #include "Draw/ScreenProjection.h"
 #include "NavFunctions.h"
+#include "Geographic/GeoPoint.h"
 #include "Util/TruncateString.hpp"
 
 #include "Topology/shapelib/mapserver.h"
@@ -49,6 +50,18 @@ unsigned int OutsideAirspaceCnt =0;
 
 namespace {
 
+/**
+ * append points of arc centered on <center> with <radius>, one by bearing.
+ */
+void AddArcPoints(CPoint2DArray* geopoints, const GeoPoint& center, const std::vector<double>& bearings, double radius) {
+    const std::vector<double> distances(bearings.size(), radius);
+    std::vector<GeoPoint> points(bearings.size());
+    FindLatitudeLongitude(center, bearings.data(), distances.data(), bearings.size(), points.data());
+    for (const auto& point : points) {
+        geopoints->emplace_back(point.latitude, point.longitude);
+    }
+}
+
 struct start_with_predicate final {
     bool operator()(tstring_view text, tstring_view prefix) {
         return text.substr(0, prefix.size()) == prefix;
@@ -1438,7 +1451,6 @@ bool CAirspaceManager::CalculateArc(TCHAR *Text, CPoint2DArray *_geopoints, doub
     double Radius;
     double arc_bearing_range;
     TCHAR *Comma = NULL;
-    double lat, lon;
 
     ReadCoords(Text, &StartLon, &StartLat);
 
@@ -1459,14 +1471,15 @@ bool CAirspaceManager::CalculateArc(TCHAR *Text, CPoint2DArray *_geopoints, doub
         arc_bearing_range = AngleLimit360(StartBearing - EndBearing);
     }
 
+    std::vector<double> bearings;
     // TODO : use radius for calculate bearing increment.
     while (arc_bearing_range > 7.5) {
         StartBearing = AngleLimit360(StartBearing + Rotation * 5);
         arc_bearing_range -= 5;
-
-        FindLatitudeLongitude(Center_lat, Center_lon, StartBearing, Radius, &lat, &lon);
-        _geopoints->emplace_back(lat, lon);
+        bearings.push_back(StartBearing);
     }
+    AddArcPoints(_geopoints, {Center_lat, Center_lon}, bearings, Radius);
+
     _geopoints->emplace_back(EndLat, EndLon);
     return true;
 }
@@ -1474,7 +1487,6 @@ bool CAirspaceManager::CalculateArc(TCHAR *Text, CPoint2DArray *_geopoints, doub
 bool CAirspaceManager::CalculateSector(TCHAR *Text, CPoint2DArray *_geopoints, double Center_lon, double Center_lat, int Rotation) {
     double arc_bearing_range = 0.0;
     const TCHAR *Stop = nullptr;
-    double lat = 0, lon = 0;
 
     // TODO 110307 FIX problem of StrToDouble returning 0.0 in case of error , and not setting Stop!!
     double Radius = Units::From(unNauticalMiles, StrToDouble(Text, &Stop));
@@ -1494,19 +1506,18 @@ bool CAirspaceManager::CalculateSector(TCHAR *Text, CPoint2DArray *_geopoints, d
         arc_bearing_range = AngleLimit360(StartBearing - EndBearing);
     }
 
+    std::vector<double> bearings;
     while (arc_bearing_range > 7.5) {
         if (StartBearing >= 360) StartBearing -= 360;
         if (StartBearing < 0) StartBearing += 360;
 
-        FindLatitudeLongitude(Center_lat, Center_lon, StartBearing, Radius, &lat, &lon);
-
-        _geopoints->emplace_back(lat, lon);
+        bearings.push_back(StartBearing);
 
         StartBearing += Rotation * 5;
         arc_bearing_range -= 5;
     }
-    FindLatitudeLongitude(Center_lat, Center_lon, EndBearing, Radius, &lat, &lon);
-    _geopoints->emplace_back(lat, lon);
+    bearings.push_back(EndBearing);
+    AddArcPoints(_geopoints, {Center_lat, Center_lon}, bearings, Radius);
     return true;
 }
 
@@ -2498,6 +2509,21 @@ int CAirspaceManager::ScanAirspaceLineList(const double (&lats)[AIRSPACE_SCANSIZ
     unsigned int iSelAS = 0; // current selected airspace for processing
     unsigned int i; // loop variable
     CAirspaceList::const_iterator it;
+    // bounds of scan line, only airspaces touching it are scanned
+    rectObj line_bounds = { lons[0], lats[0], lons[0], lats[0] };
+    for (i = 1; i < AIRSPACE_SCANSIZE_X; i++) {
+        line_bounds.minx = min(line_bounds.minx, lons[i]);
+        line_bounds.maxx = max(line_bounds.maxx, lons[i]);
+        line_bounds.miny = min(line_bounds.miny, lats[i]);
+        line_bounds.maxy = max(line_bounds.maxy, lats[i]);
+    }
+    // JMW detect scan line that wraps across 180
+    if ((line_bounds.minx < -90) && (line_bounds.maxx > 90)) {
+        std::swap(line_bounds.minx, line_bounds.maxx);
+    }
+
+    bool inside[AIRSPACE_SCANSIZE_X]; // horizontal inside result of current airspace
+
     ScopeLock guard(_csairspaces);
 
     airspacetype[0].psAS = NULL;
@@ -2506,12 +2532,16 @@ int CAirspaceManager::ScanAirspaceLineList(const double (&lats)[AIRSPACE_SCANSIZ
         LKASSERT((*it)->Type() >= 0);
 
         if ((CheckAirspaceAltitude(*(*it)->Base(), *(*it)->Top()) == TRUE)&& (iNoFoundAS < iMaxNoAs - 1) &&
-                ((MapWindow::iAirspaceMode[(*it)->Type()] % 2) > 0)) {
+                ((MapWindow::iAirspaceMode[(*it)->Type()] % 2) > 0) &&
+                msRectOverlap(&line_bounds, &(*it)->Bounds())) {
+            for (i = 0; i < AIRSPACE_SCANSIZE_X; i++) {
+                inside[i] = (*it)->IsHorizontalInside(lons[i], lats[i]);
+            }
             for (i = 0; i < AIRSPACE_SCANSIZE_X; i++) {
-                if ((*it)->IsHorizontalInside(lons[i], lats[i])) {
+                if (inside[i]) {
                     BOOL bPrevIn = false;
                     if (i > 0)
-                        if ((*it)->IsHorizontalInside(lons[i - 1], lats[i - 1]))
+                        if (inside[i - 1])
                             bPrevIn = true;
 
                     if (!bPrevIn)/* new AS section in this view*/ {
@@ -2567,7 +2597,7 @@ int CAirspaceManager::ScanAirspaceLineList(const double (&lats)[AIRSPACE_SCANSIZ
                         if (i == AIRSPACE_SCANSIZE_X - 1)
                             bLast = true;
                         else {
-                            if (airspacetype[iSelAS].psAS->IsHorizontalInside(lons[i + 1], lats[i + 1]))
+                            if (inside[i + 1])
                                 bLast = false;
                             else
                                 bLast = true;
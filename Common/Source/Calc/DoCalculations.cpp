@@ -12,6 +12,7 @@
 #include "Sideview.h"
 #include "Multimap.h"
 #include "Comm/ExternalWind.h"
+#include "Profiler.h"
 
 
 extern void LD(NMEA_INFO *Basic, DERIVED_INFO *Calculated);
@@ -46,6 +47,7 @@ extern bool TargetDialogOpen;
 
 bool DoCalculations(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
 {
+  const profiler::scoped_timer timer(profiler::probe::DoCalculations);
 
   // first thing: assign navaltitude!
   EnergyHeightNavAltitude(Basic, Calculated);
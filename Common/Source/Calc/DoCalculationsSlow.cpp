@@ -12,6 +12,8 @@
 #include "DoInits.h"
 #include "MathFunctions.h"
 #include "Radio.h"
+#include "Profiler.h"
+#include "magfield.h"
 
 
 
@@ -22,6 +24,8 @@ extern void TerrainFootprint(NMEA_INFO *Basic, DERIVED_INFO *Calculated);
 
 void DoCalculationsSlow(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
 
+  const profiler::scoped_timer timer(profiler::probe::DoCalculationsSlow);
+
   static double LastSearchBestTime = 0; 
   static bool	validHomeWaypoint=false;
   static bool	gotValidFix=false;
@@ -80,15 +84,15 @@ void DoCalculationsSlow(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
 				if ( DoRangeWaypointList(Basic,Calculated) )
 					LastDoRangeWaypointListTime=Basic->Time;
 
-				// Not necessary right now, we dont calculate magnetic bearings
-				// CalculateMagneticVariation();
-
 				gotValidFix=true;
 			}
 		}
 		// else we should consider SIMMODE and PAN repositions , here! TODO
 	}
 
+	// keep magnetic variation grid around aircraft, used by TrueWind
+	PrefetchMagneticVariation(*Basic);
+
 	// watchout for replay files
 	if (LastSearchBestTime > Basic->Time ) {
 		LastSearchBestTime = Basic->Time - (BESTALTERNATEINTERVAL + 10);
@@ -7,6 +7,8 @@
 */
 
 #include "Vario.h"
+#include "NMEA/Derived.h"
+#include "Sound/Sound.h"
 
 extern void NettoVario(NMEA_INFO *Basic, DERIVED_INFO *Calculated);
 extern void SpeedToFly(NMEA_INFO *Basic, DERIVED_INFO *Calculated);
@@ -16,5 +18,6 @@ void DoCalculationsVario(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
     Vario(*Basic,*Calculated);
     NettoVario(Basic, Calculated);
     SpeedToFly(Basic, Calculated);
+    AudioVarioUpdate(Calculated->Vario);
   }
 }
@@ -8,6 +8,7 @@
 
 #include "externs.h"
 #include "NavFunctions.h"
+#include "Geographic/LocalFrame.h"
 
 
 // Fill Calculated values for waypoint, assuming that DistanceBearing has already been performed!
@@ -122,6 +123,8 @@ void DoNearest(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
    // at our back..
    bool directsort=(SortedMode[curmapspace]==2);
 
+   const LocalFrame frame({Basic->Latitude, Basic->Longitude});
+
    // This can be a problem, careful: we use MAXRANGELANDABLE but we may be using MAXRANGETURNPOINT
    // if in the future we want to make them different (currently both 500, so ok).
    for (i=0, inserted=0; i<MAXRANGELANDABLE; i++) { 
@@ -135,8 +138,8 @@ void DoNearest(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
 	StartupStore(_T("wp_index=%d  <%s>\n"),wp_index, WayPointList[wp_index].Name);
 	#endif
 
-	DistanceBearing(Basic->Latitude , Basic->Longitude , WayPointList[wp_index].Latitude,
-		WayPointList[wp_index].Longitude, &wp_distance, &wp_bearing);
+	frame.DistanceBearing({WayPointList[wp_index].Latitude, WayPointList[wp_index].Longitude},
+		&wp_distance, &wp_bearing);
 
 	// since we have them calculated, lets save these values 
 	WayPointCalc[wp_index].Distance = wp_distance;
@@ -16,21 +16,32 @@
 // Final glide through terrain and footprint calculations
 
 
-double FinalGlideThroughTerrain(const double this_bearing,
+namespace {
+
+// terrain rounding factor : half of one glide step
+void GlideTerrainRounding(const double start_lat, const double start_lon, const double glide_max_range,
+                          double *Xrounding, double *Yrounding) {
+  double lat, lon;
+  FindLatitudeLongitude(start_lat, start_lon, 0,
+                        glide_max_range/NUMFINALGLIDETERRAIN, &lat, &lon);
+
+  *Xrounding = fabs(lon-start_lon)/2;
+  *Yrounding = fabs(lat-start_lat)/2;
+}
+
+} // namespace
+
+double FinalGlideThroughTerrain(const RasterMap* map,
+                                const double irange,
+                                const double this_bearing,
                                 const double start_lat,
                                 const double start_lon,
                                 const double start_alt,
-                                DERIVED_INFO *Calculated,
                                 double *retlat, double *retlon,
                                 const double max_range,
 				bool *out_of_range,
 				double *TerrainBase)
 {
-  double irange = GlidePolar::MacCreadyAltitude(MACCREADY,
-						1.0, this_bearing,
-						Calculated->WindSpeed,
-						Calculated->WindBearing,
-						0, 0, true, 0);
   double safetyterrain;
 
   if (retlat && retlon) {
@@ -57,26 +68,31 @@ double FinalGlideThroughTerrain(const double this_bearing,
   double last_dh=0;
   double altitude;
 
-  // Warning: leave this part locked, RasterTerrain need no changes on the map position while working
-  RasterTerrain::Lock();  //@ 101031 WE DO NEED IT!   BUG 101027:  no need, locking individually
   double retval = 0;
   int i=0;
   bool start_under = false;
 
   // calculate terrain rounding factor
+  double Xrounding, Yrounding;
+  GlideTerrainRounding(start_lat, start_lon, glide_max_range, &Xrounding, &Yrounding);
 
-  FindLatitudeLongitude(start_lat, start_lon, 0,
-                        glide_max_range/NUMFINALGLIDETERRAIN, &lat, &lon);
+  // map is read only : sampling resolution is local to this glide.
+  const RasterMap::FieldRounding rounding = (map && map->isMapLoaded())
+          ? map->GetFieldRounding(Xrounding, Yrounding)
+          : RasterMap::FieldRounding{};
 
-  double Xrounding = fabs(lon-start_lon)/2;
-  double Yrounding = fabs(lat-start_lat)/2;
-  RasterTerrain::SetTerrainRounding(Xrounding, Yrounding);
+  auto GetTerrainHeight = [&](double lat, double lon) -> short {
+    if (map && map->isMapLoaded()) {
+      return map->GetField(rounding, lat, lon);
+    }
+    return TERRAIN_INVALID;
+  };
 
   lat = last_lat = start_lat;
   lon = last_lon = start_lon;
 
   altitude = start_alt;
-  h =  max((short)0, RasterTerrain::GetTerrainHeight(lat, lon));
+  h =  max((short)0, GetTerrainHeight(lat, lon));
   if (h==TERRAIN_INVALID) h=0; // @ 101027 FIX
   dh = altitude - h - safetyterrain;
   last_dh = dh;
@@ -137,7 +153,7 @@ double FinalGlideThroughTerrain(const double this_bearing,
 
     // find height over terrain
 
-    h =  max((short)0, RasterTerrain::GetTerrainHeight(lat, lon));
+    h =  max((short)0, GetTerrainHeight(lat, lon));
     if (h==TERRAIN_INVALID) h=0; //@ 101027 FIX
 
 
@@ -191,6 +207,39 @@ double FinalGlideThroughTerrain(const double this_bearing,
   retval = glide_max_range;
 
  OnExit:
+  return retval;
+}
+
+
+double FinalGlideThroughTerrain(const double this_bearing,
+                                const double start_lat,
+                                const double start_lon,
+                                const double start_alt,
+                                DERIVED_INFO *Calculated,
+                                double *retlat, double *retlon,
+                                const double max_range,
+				bool *out_of_range,
+				double *TerrainBase)
+{
+  double irange = GlidePolar::MacCreadyAltitude(MACCREADY,
+						1.0, this_bearing,
+						Calculated->WindSpeed,
+						Calculated->WindBearing,
+						0, 0, true, 0);
+
+  // Warning: leave this part locked, RasterTerrain need no changes on the map position while working
+  RasterTerrain::Lock();  //@ 101031 WE DO NEED IT!   BUG 101027:  no need, locking individually
+
+  if ((irange > 0.0) && (start_alt > 0)) {
+    // caller can use GetTerrainHeight() with the same rounding after this call.
+    double Xrounding, Yrounding;
+    GlideTerrainRounding(start_lat, start_lon, start_alt / irange, &Xrounding, &Yrounding);
+    RasterTerrain::SetTerrainRounding(Xrounding, Yrounding);
+  }
+
+  double retval = FinalGlideThroughTerrain(RasterTerrain::TerrainMap.get(), irange,
+                                           this_bearing, start_lat, start_lon, start_alt,
+                                           retlat, retlon, max_range, out_of_range, TerrainBase);
   RasterTerrain::Unlock();
   return retval;
 }
@@ -24,3 +24,8 @@ double FlarmCalculations::Average30s(uint32_t RadioId, double curTime, double cu
 {
   return averageCalculatorMap[RadioId].GetAverage(curTime, curAltitude);
 }
+
+void FlarmCalculations::Remove(uint32_t RadioId)
+{
+  averageCalculatorMap.erase(RadioId);
+}
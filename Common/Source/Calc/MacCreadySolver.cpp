@@ -0,0 +1,563 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   MacCreadySolver.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "externs.h"
+#include "MacCreadySolver.h"
+#include "Util/Clamp.hpp"
+
+namespace {
+
+constexpr double min_maccready = 0.000000000001; // same as MIN_MACCREADY in McReady.cpp
+
+// table nodes
+constexpr double mc_step = 0.5;
+constexpr unsigned mc_count = 13; // 0 .. 6 m/s
+constexpr double wind_step = 3.;
+constexpr double head_wind_min = -30.;
+constexpr unsigned head_wind_count = 21; // -30 .. 30 m/s
+constexpr unsigned cross_wind_count = 11; // 0 .. 30 m/s
+
+constexpr double table_distance = 1000.;
+
+unsigned node_index(double value, double min, double step, unsigned count) {
+  const int index = iround((value - min) / step);
+  return Clamp<int>(index, 0, count - 1);
+}
+
+size_t table_index(bool final_glide, unsigned mc, unsigned head_wind, unsigned cross_wind) {
+  return (((final_glide ? 1 : 0) * mc_count + mc) * head_wind_count + head_wind) * cross_wind_count + cross_wind;
+}
+
+} // namespace
+
+struct MacCreadySolver::context_t {
+  double mc;
+  double distance;
+  double bearing;
+  double head_wind;
+  double cross_wind;
+  double head_wind_sqd;
+  double cross_wind_sqd;
+  double cruise_efficiency;
+  bool final_glide;
+
+  context_t(double emcready, double Distance, double Bearing,
+            double WindSpeed, double WindBearing,
+            bool isFinalGlide, double efficiency)
+      : mc(isFinalGlide ? std::max(0.0, emcready) : std::max(min_maccready, emcready)),
+        distance(std::max(1.0, Distance)),
+        bearing(Bearing),
+        cruise_efficiency(efficiency),
+        final_glide(isFinalGlide) {
+
+    const double CrossBearing = AngleLimit360(Bearing - WindBearing);
+    head_wind = WindSpeed * fastcosine(CrossBearing);
+    cross_wind = WindSpeed * fastsine(CrossBearing);
+    head_wind_sqd = head_wind * head_wind;
+    cross_wind_sqd = cross_wind * cross_wind;
+  }
+
+  // table node
+  context_t(double emcready, double HeadWind, double CrossWind, bool isFinalGlide)
+      : mc(isFinalGlide ? std::max(0.0, emcready) : std::max(min_maccready, emcready)),
+        distance(table_distance),
+        bearing(0),
+        head_wind(HeadWind),
+        cross_wind(CrossWind),
+        head_wind_sqd(HeadWind * HeadWind),
+        cross_wind_sqd(CrossWind * CrossWind),
+        cruise_efficiency(1.),
+        final_glide(isFinalGlide) {}
+
+  // best glide or best time before search
+  double InitialCost() const {
+    return final_glide ? 10000 : 1e6;
+  }
+};
+
+struct MacCreadySolver::eval_t {
+  bool feasible;
+  double cost; // inverse glide ratio relative to ground (final glide) or total time
+  double tc;   // fraction of time spent in cruise
+  double vtot; // average speed along track relative to ground
+};
+
+MacCreadySolver::MacCreadySolver(const double* sinkrate, size_t size, unsigned vmin, unsigned vmax, double safety_speed)
+    : _sinkrate(sinkrate, sinkrate + size),
+      _vmin(vmin),
+      _vmax(std::min<unsigned>(vmax, size - 1)),
+      _safety_speed(safety_speed) {
+
+  BuildTable();
+}
+
+double MacCreadySolver::SinkRate(unsigned v) const {
+  return _sinkrate[Clamp(v, 8U, std::max(8U, _vmax))];
+}
+
+MacCreadySolver::eval_t MacCreadySolver::Evaluate(const context_t& ctx, unsigned v) const {
+  const double vtrack = (v / 2.0) * ctx.cruise_efficiency;
+
+  double sinkrate;
+  double tc;
+  if (ctx.final_glide) {
+    sinkrate = -(SinkRate(v) - ctx.mc);
+    tc = 1.0; // assume no circling, e.g. final glide at best LD
+  } else {
+    sinkrate = -SinkRate(v);
+    if ((sinkrate + ctx.mc) == 0) {
+      sinkrate += 0.1;
+    }
+    tc = std::max(0.0, std::min(1.0, ctx.mc / (sinkrate + ctx.mc)));
+  }
+
+  double vtot = (vtrack * vtrack * tc * tc - ctx.cross_wind_sqd);
+  // if able to advance against crosswind
+  if (vtot > 0) {
+    // if able to advance against headwind
+    if (vtot > ctx.head_wind_sqd) {
+      vtot = sqrt(vtot) - ctx.head_wind;
+    } else {
+      return {false, 0, 0, 0};
+    }
+  }
+  if (vtot <= 0) {
+    return {false, 0, 0, 0};
+  }
+
+  if (ctx.final_glide) {
+    return {true, sinkrate / vtot, tc, vtot};
+  }
+
+  const double time_cruise = (tc / vtot) * ctx.distance;
+  const double time_climb = sinkrate * (time_cruise / ctx.mc);
+  return {true, std::max(time_cruise + time_climb, 0.0001), tc, vtot};
+}
+
+unsigned MacCreadySolver::Scan(const context_t& ctx) const {
+  unsigned best = 0;
+  double best_cost = ctx.InitialCost();
+  for (unsigned v = _vmin; v <= _vmax; ++v) {
+    const eval_t eval = Evaluate(ctx, v);
+    if (!eval.feasible) {
+      continue;
+    }
+    if (eval.cost <= best_cost) {
+      best = v;
+      best_cost = eval.cost;
+    } else {
+      // no need to continue search, max already found..
+      break;
+    }
+  }
+  return best;
+}
+
+unsigned MacCreadySolver::Climb(const context_t& ctx, unsigned guess) const {
+  unsigned v = Clamp(guess, _vmin, _vmax);
+  eval_t eval = Evaluate(ctx, v);
+  if (!eval.feasible) {
+    return Scan(ctx);
+  }
+
+  // cost is decreasing until optimum speed, then increasing.
+  while (v > _vmin) {
+    const eval_t prev = Evaluate(ctx, v - 1);
+    if (!prev.feasible || !(prev.cost < eval.cost)) {
+      break;
+    }
+    eval = prev;
+    --v;
+  }
+  while (v < _vmax) {
+    const eval_t next = Evaluate(ctx, v + 1);
+    if (!next.feasible || next.cost > eval.cost) {
+      break;
+    }
+    eval = next;
+    ++v;
+  }
+
+  // linear scan give up if cost of the first speed that allow to advance is above initial cost.
+  for (unsigned first = _vmin; first <= v; ++first) {
+    const eval_t first_eval = Evaluate(ctx, first);
+    if (first_eval.feasible) {
+      return (first_eval.cost > ctx.InitialCost()) ? 0 : v;
+    }
+  }
+  return v;
+}
+
+unsigned MacCreadySolver::Guess(const context_t& ctx) const {
+  const unsigned mc = node_index(ctx.mc, 0, mc_step, mc_count);
+  const unsigned head_wind = node_index(ctx.head_wind, head_wind_min, wind_step, head_wind_count);
+  const unsigned cross_wind = node_index(fabs(ctx.cross_wind), 0, wind_step, cross_wind_count);
+  return _table[table_index(ctx.final_glide, mc, head_wind, cross_wind)];
+}
+
+void MacCreadySolver::BuildTable() {
+  _table.assign(2 * mc_count * head_wind_count * cross_wind_count, 0);
+  if (_vmin > _vmax) {
+    return;
+  }
+  for (bool final_glide : { false, true }) {
+    for (unsigned mc = 0; mc < mc_count; ++mc) {
+      for (unsigned head_wind = 0; head_wind < head_wind_count; ++head_wind) {
+        unsigned best = 0;
+        for (unsigned cross_wind = 0; cross_wind < cross_wind_count; ++cross_wind) {
+          const context_t ctx(mc * mc_step, head_wind_min + head_wind * wind_step, cross_wind * wind_step, final_glide);
+          // optimum change slowly from one node to the next
+          best = best ? Climb(ctx, best) : Scan(ctx);
+          _table[table_index(final_glide, mc, head_wind, cross_wind)] = best;
+        }
+      }
+    }
+  }
+}
+
+MacCreadySolver::result_t MacCreadySolver::Result(const context_t& ctx, unsigned best) const {
+  result_t result = {};
+  result.found = (best != 0);
+  result.cruise_track = ctx.bearing;
+
+  double speed = 4; // 4 m/s is less speed for _sinkRatecache
+  double time_cruise = -1; // initialise to error value
+  result.time = ERROR_TIME;
+
+  if (result.found) {
+    const eval_t eval = Evaluate(ctx, best);
+    speed = std::min(_safety_speed, best / 2.0);
+
+    // best track bearing is the track along cruise that
+    // compensates for the drift during climb
+    result.cruise_track = atan2(ctx.cross_wind * (eval.tc - 1), eval.vtot + ctx.head_wind * (1 - eval.tc)) * RAD_TO_DEG + ctx.bearing;
+
+    // speed along track during cruise component
+    time_cruise = ctx.distance * eval.tc / eval.vtot;
+
+    if (ctx.final_glide) {
+      result.time = ctx.distance / eval.vtot;
+    } else {
+      // like linear scan : time of the first speed checked after optimum.
+      result.time = eval.cost;
+      for (unsigned v = best + 1; v <= _vmax; ++v) {
+        const eval_t next = Evaluate(ctx, v);
+        if (next.feasible) {
+          result.time = next.cost;
+          break;
+        }
+      }
+    }
+  } else if (!ctx.final_glide) {
+    // like linear scan : time of the first speed that allow to advance, even
+    // if above initial cost.
+    for (unsigned v = _vmin; v <= _vmax; ++v) {
+      const eval_t first = Evaluate(ctx, v);
+      if (first.feasible) {
+        result.time = first.cost;
+        break;
+      }
+    }
+  }
+  result.speed = speed;
+
+  // this is the altitude needed to final glide to destination
+  result.altitude = -SinkRate(iround(speed * 2)) * time_cruise;
+  return result;
+}
+
+MacCreadySolver::result_t MacCreadySolver::Solve(const context_t& ctx, bool use_table) const {
+  if (_vmin > _vmax) {
+    return Result(ctx, 0);
+  }
+  if (use_table) {
+    const unsigned guess = Guess(ctx);
+    return Result(ctx, guess ? Climb(ctx, guess) : Scan(ctx));
+  }
+  return Result(ctx, Scan(ctx));
+}
+
+MacCreadySolver::result_t MacCreadySolver::Solve(double mc, double distance, double bearing,
+                                                 double wind_speed, double wind_bearing,
+                                                 bool final_glide, double cruise_efficiency) const {
+  const context_t ctx(mc, distance, bearing, wind_speed, wind_bearing, final_glide, cruise_efficiency);
+  return Solve(ctx, true);
+}
+
+void MacCreadySolver::Solve(double mc, const double* distance, const double* bearing, size_t count,
+                            double wind_speed, double wind_bearing,
+                            bool final_glide, double cruise_efficiency, result_t* out) const {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Solve(mc, distance[i], bearing[i], wind_speed, wind_bearing, final_glide, cruise_efficiency);
+  }
+}
+
+MacCreadySolver::result_t MacCreadySolver::SolveScan(double mc, double distance, double bearing,
+                                                     double wind_speed, double wind_bearing,
+                                                     bool final_glide, double cruise_efficiency) const {
+  const context_t ctx(mc, distance, bearing, wind_speed, wind_bearing, final_glide, cruise_efficiency);
+  return Solve(ctx, false);
+}
+
+#ifndef DOCTEST_CONFIG_DISABLE
+#include <doctest/doctest.h>
+
+namespace {
+
+/**
+ * copy of original GlidePolar::MacCreadyAltitude_internal() ( without
+ * BCT_ALT_FIX ), with polar given as argument instead of GlidePolar statics.
+ * used as reference for regression check.
+ */
+MacCreadySolver::result_t MacCreadyAltitude_reference(const double* _sinkratecache, unsigned _Vminsink,
+                                                      unsigned iSAFETYSPEED, double SAFTEYSPEED,
+                                                      double emcready, double Distance, double Bearing,
+                                                      const double WindSpeed, const double WindBearing,
+                                                      const bool isFinalGlide, const double cruise_efficiency) {
+
+  auto _SinkRateFast = [&](double MC, unsigned v) {
+    return _sinkratecache[Clamp(v, 8U, iSAFETYSPEED)] - MC;
+  };
+
+  double BestSpeed, BestGlide, Glide;
+  double BestSinkRate, TimeToDestCruise;
+  static double HeadWind, CrossWind=0.0;
+  static double CrossBearingLast= -1.0;
+  static double WindSpeedLast= -1.0;
+  double CrossBearing;
+  double BestTime;
+  static double HeadWindSqd, CrossWindSqd=0.0;
+
+  MacCreadySolver::result_t result = {};
+
+  CrossBearing = AngleLimit360(Bearing - WindBearing);
+  if ((CrossBearing != CrossBearingLast)||(WindSpeed != WindSpeedLast)) {
+    // saves a few floating point operations
+    HeadWind = WindSpeed * fastcosine(CrossBearing);
+    CrossWind = WindSpeed * fastsine(CrossBearing);
+    HeadWindSqd = HeadWind*HeadWind;
+    CrossWindSqd = CrossWind*CrossWind;
+
+    // save old values
+    CrossBearingLast = CrossBearing;
+    WindSpeedLast = WindSpeed;
+  }
+
+  double sinkrate;
+  double tc; // time spent in cruise
+
+  //Calculate Best Glide Speed
+  BestSpeed = 4; // 4 m/s is less speed for _sinkRatecache
+  BestGlide = 10000;
+  BestTime = 1e6;
+
+  result.cruise_track = Bearing;
+
+  double vtot;
+  // REWRITING DISTANCE!
+  if (Distance<1.0) {
+    Distance = 1;
+  }
+
+  double TimeToDestTotal = ERROR_TIME; // initialise to error value
+  TimeToDestCruise = -1; // initialise to error value
+
+  for(unsigned _i=_Vminsink;_i<=iSAFETYSPEED;_i++) {
+    double vtrack_real = ((double)_i)/2.0; // actual airspeed
+    double vtrack = vtrack_real*cruise_efficiency;
+
+    if (isFinalGlide) {
+      sinkrate = -_SinkRateFast(max(0.0,emcready), _i);
+      tc = 1.0; // assume no circling, e.g. final glide at best LD
+    } else {
+      // WE ARE REWRITING EMCREADY!
+      emcready = max(min_maccready,emcready);
+      sinkrate = -_SinkRateFast(0.0, _i);
+      if ( (sinkrate+emcready)==0 ) sinkrate+=0.1; // to check
+      tc = max(0.0,min(1.0,emcready/(sinkrate+emcready)));
+    }
+
+    // calculate average speed along track relative to wind
+    vtot = (vtrack*vtrack*tc*tc-CrossWindSqd);
+    // if able to advance against crosswind
+    if (vtot>0) {
+      // if able to advance against headwind
+      if (vtot>HeadWindSqd) {
+        // calculate average speed along track relative to ground
+        vtot = sqrt(vtot)-HeadWind;
+      } else {
+        // can't advance at this speed
+        continue;
+      }
+    }
+
+    // can't advance at this speed
+    if (vtot<=0) continue;
+
+    bool bestfound = false;
+
+    if (isFinalGlide) {
+      // inverse glide ratio relative to ground
+      Glide = sinkrate/vtot;
+
+      // best glide angle when in final glide
+      if (Glide <= BestGlide) {
+        bestfound = true;
+        BestGlide = Glide;
+        TimeToDestTotal = Distance/vtot;
+      }
+    } else {
+      // time spent in cruise
+      double Time_cruise = (tc/vtot)*Distance;
+      double Time_climb = sinkrate*(Time_cruise/emcready);
+
+      // total time to destination
+      TimeToDestTotal = max(Time_cruise+Time_climb,0.0001);
+      // best average speed when in maintaining height mode
+      if (TimeToDestTotal <= BestTime) {
+        bestfound = true;
+        BestTime = TimeToDestTotal;
+      }
+    }
+
+    if (bestfound) {
+      BestSpeed = min(SAFTEYSPEED, vtrack_real);
+      result.found = true;
+
+      // best track bearing is the track along cruise that
+      // compensates for the drift during climb
+      result.cruise_track = atan2(CrossWind*(tc-1),vtot
+                                  +HeadWind*(1-tc))*RAD_TO_DEG+Bearing;
+
+      result.speed = BestSpeed;
+
+      // speed along track during cruise component
+      TimeToDestCruise = Distance*tc/vtot;
+
+    } else {
+      // no need to continue search, max already found..
+      break;
+    }
+  }
+
+  BestSinkRate = _SinkRateFast(0, iround(BestSpeed*2));
+
+  result.time = TimeToDestTotal;
+
+  // this is the altitude needed to final glide to destination
+  result.altitude = -BestSinkRate * TimeToDestCruise;
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("MacCreadySolver") {
+  // 15m glider polar ( L/D 40 ), 0.5 m/s speed steps, same as GlidePolar::SetBallast()
+  const double a = -0.001555, b = 0.06192, c = -1.208;
+  double sinkrate[(MAXSPEED + 1) * 2] = {};
+  unsigned vmin = 8;
+  double minsink = 10000;
+  for (unsigned v = 8; v <= MAXSPEED * 2; ++v) {
+    const double speed = v / 2.0;
+    sinkrate[v] = a * speed * speed + b * speed + c;
+    if (-sinkrate[v] <= minsink) {
+      minsink = -sinkrate[v];
+      vmin = v;
+    }
+  }
+  const double safety_speed = 75;
+  const MacCreadySolver solver(sinkrate, std::size(sinkrate), vmin, iround(safety_speed * 2), safety_speed);
+
+  SUBCASE("same result as original MacCreadyAltitude_internal") {
+    unsigned count = 0;
+    for (bool final_glide : { false, true }) {
+      for (double mc : { 0., 0.3, 1., 2.2, 4., 7.5 }) {
+        for (double wind : { 0., 5., 13., 27., 45. }) {
+          for (double wind_bearing : { 30., 245. }) {
+            for (double bearing = 0; bearing < 360; bearing += 15) {
+              for (double efficiency : { 0.8, 1., 1.2 }) {
+                for (double distance : { 0.5, 1000., 150000. }) {
+                  const auto fast = solver.Solve(mc, distance, bearing, wind, wind_bearing, final_glide, efficiency);
+                  const auto ref = MacCreadyAltitude_reference(sinkrate, vmin, iround(safety_speed * 2), safety_speed,
+                                                               mc, distance, bearing, wind, wind_bearing,
+                                                               final_glide, efficiency);
+                  REQUIRE(fast.found == ref.found);
+                  CHECK(fast.altitude == ref.altitude);
+                  CHECK(fast.time == ref.time);
+                  CHECK(fast.cruise_track == ref.cruise_track);
+                  if (ref.found) {
+                    CHECK(fast.speed == ref.speed);
+                  }
+                  ++count;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    CHECK(count == 2 * 6 * 5 * 2 * 24 * 3 * 3);
+  }
+
+  SUBCASE("same result as linear scan") {
+    unsigned count = 0;
+    for (bool final_glide : { false, true }) {
+      for (double mc : { 0., 0.3, 1., 2.2, 4., 7.5 }) {
+        for (double wind : { 0., 5., 13., 27., 45. }) {
+          for (double bearing = 0; bearing < 360; bearing += 15) {
+            for (double efficiency : { 0.8, 1., 1.2 }) {
+              for (double distance : { 0.5, 1000., 150000. }) {
+                const auto fast = solver.Solve(mc, distance, bearing, wind, 30., final_glide, efficiency);
+                const auto ref = solver.SolveScan(mc, distance, bearing, wind, 30., final_glide, efficiency);
+                REQUIRE(fast.found == ref.found);
+                CHECK(fast.altitude == ref.altitude);
+                CHECK(fast.time == ref.time);
+                CHECK(fast.speed == ref.speed);
+                CHECK(fast.cruise_track == ref.cruise_track);
+                ++count;
+              }
+            }
+          }
+        }
+      }
+    }
+    CHECK(count > 0);
+  }
+
+  SUBCASE("glide ratio") {
+    // no wind, mc 0 : best L/D
+    const auto result = solver.Solve(0, 1000., 0, 0, 0, true, 1.);
+    REQUIRE(result.found);
+    CHECK(result.altitude > 1000. / 45);
+    CHECK(result.altitude < 1000. / 35);
+    // head wind : more altitude and more time
+    const auto head_wind = solver.Solve(0, 1000., 0, 10., 0, true, 1.);
+    CHECK(head_wind.altitude > result.altitude);
+    CHECK(head_wind.speed > result.speed);
+    // can't advance
+    const auto no_way = solver.Solve(0, 1000., 0, 80., 0, true, 1.);
+    CHECK_FALSE(no_way.found);
+    CHECK(no_way.time == ERROR_TIME);
+  }
+
+  SUBCASE("batch") {
+    const double distance[] = { 1000., 20000., 5000. };
+    const double bearing[] = { 10., 190., 275. };
+    MacCreadySolver::result_t out[3];
+    solver.Solve(1.5, distance, bearing, 3, 8., 120., false, 1., out);
+    for (unsigned i = 0; i < 3; ++i) {
+      const auto result = solver.Solve(1.5, distance[i], bearing[i], 8., 120., false, 1.);
+      CHECK(out[i].altitude == result.altitude);
+      CHECK(out[i].time == result.time);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   MacCreadySolver.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_MACCREADYSOLVER_H_
+#define _CALC_MACCREADYSOLVER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Best speed to fly and altitude required for one leg, with wind.
+ *
+ * Immutable once built from polar sink rate table ( GlidePolar::SetBallast() ) :
+ * a solver can be used concurrently by calculation and draw threads without lock.
+ *
+ * Best speed is searched on 0.5 m/s steps, like the original linear scan from
+ * min sink speed, but search start from the best speed precomputed for the
+ * nearest MacCready / head wind / cross wind node, then walk to the exact
+ * discrete optimum : result is same as full scan for a few evaluations.
+ */
+class MacCreadySolver final {
+ public:
+  struct result_t {
+    double altitude;      // altitude required (m)
+    double time;          // time to go (s), ERROR_TIME if no speed allow to advance
+    double speed;         // best speed (m/s), only valid if `found`
+    double cruise_track;  // best cruise track (deg), compensate drift while climbing
+    bool found;
+  };
+
+  /**
+   * @sinkrate : sink rate (negative) for each 0.5 m/s speed step, index = speed * 2
+   * @vmin : index of min sink speed, first speed used
+   * @vmax : index of max allowed speed
+   * @safety_speed : max allowed speed (m/s)
+   */
+  MacCreadySolver(const double* sinkrate, size_t size, unsigned vmin, unsigned vmax, double safety_speed);
+
+  MacCreadySolver(const MacCreadySolver&) = delete;
+  MacCreadySolver& operator=(const MacCreadySolver&) = delete;
+
+  /**
+   * same semantic as GlidePolar::MacCreadyAltitude_internal()
+   *  - final glide : best glide ratio relative to ground,
+   *  - otherwise : best average speed including climb at <mc>.
+   */
+  result_t Solve(double mc, double distance, double bearing,
+                 double wind_speed, double wind_bearing,
+                 bool final_glide, double cruise_efficiency) const;
+
+  /**
+   * solve <count> legs with same MacCready and wind.
+   */
+  void Solve(double mc, const double* distance, const double* bearing, size_t count,
+             double wind_speed, double wind_bearing,
+             bool final_glide, double cruise_efficiency, result_t* out) const;
+
+  /**
+   * same as Solve() without precomputed start speed, used as reference.
+   */
+  result_t SolveScan(double mc, double distance, double bearing,
+                     double wind_speed, double wind_bearing,
+                     bool final_glide, double cruise_efficiency) const;
+
+ private:
+  struct context_t;
+  struct eval_t;
+
+  eval_t Evaluate(const context_t& ctx, unsigned v) const;
+
+  // linear scan from min sink speed, as original implementation
+  unsigned Scan(const context_t& ctx) const;
+
+  // walk from <guess> to the same optimum as `Scan()`
+  unsigned Climb(const context_t& ctx, unsigned guess) const;
+
+  unsigned Guess(const context_t& ctx) const;
+
+  result_t Result(const context_t& ctx, unsigned best) const;
+
+  result_t Solve(const context_t& ctx, bool use_table) const;
+
+  double SinkRate(unsigned v) const;
+
+  void BuildTable();
+
+  std::vector<double> _sinkrate;
+  unsigned _vmin;
+  unsigned _vmax;
+  double _safety_speed;
+
+  // best speed index for each table node, 0 if no speed allow to advance.
+  std::vector<uint8_t> _table;
+};
+
+#endif // _CALC_MACCREADYSOLVER_H_
@@ -8,37 +8,23 @@
 
 #include "externs.h"
 #include "magfield.h"
+#include "Calc/geo_grid_cache.h"
 
 
+namespace {
 
-//
-// Accurate also for altitude, far too precise for humans on a plane!
-// Will return 0 if error. Assuming there is always a magnetic variation.
-//
-double CalculateMagneticVariation() {
-
-  double lat=GPS_INFO.Latitude;
-  double lon=GPS_INFO.Longitude;
-
-  if (  GPS_INFO.NAVWarning ||
-	GPS_INFO.Year > 2025 || GPS_INFO.Year < 2020 ||
-	lat == 0 || lon == 0
-     )  return 0.0;
+// 1 degree cells : bilinear error is less than 0.05 degree outside polar areas.
+constexpr double magvar_cell_size = 1.;
 
-  double magvar=0;
-  double h=CALCULATED_INFO.NavAltitude/1000.0;
-
-  if (h<0.5) h=0.5; // 500m 
+// variation change less than 0.01 degree per km, nodes are evaluated at a fixed
+// height so that result don't depend on altitude of aircraft when cell was filled.
+constexpr double magvar_height = 1.; // km
 
+double EvaluateMagneticVariation(long julian_days, double lat, double lon) {
+  double magvar = 0;
   short retry=3;
   while (retry-->0) {
-	magvar =  RAD_TO_DEG*SGMagVar( 
-			DEG_TO_RAD*lat,
-			DEG_TO_RAD*lon,
-			h,
-	        	yymmdd_to_julian_days(GPS_INFO.Year-2000,GPS_INFO.Month, GPS_INFO.Day)
-			);
-
+	magvar = RAD_TO_DEG*SGMagVar(DEG_TO_RAD*lat, DEG_TO_RAD*lon, magvar_height, julian_days);
 	if (magvar != magvar) {
 		#if TESTBENCH
 		StartupStore(_T(".... CalculateMagVar OVERFLOW detected\n"));
@@ -47,6 +33,51 @@ double CalculateMagneticVariation() {
 	}
 	break;
   }
+  return magvar;
+}
+
+geo_grid_cache<64> magvar_cache(magvar_cell_size, EvaluateMagneticVariation);
+
+bool ValidMagneticVariationDate(int year) {
+  return year >= 2020 && year <= 2025;
+}
+
+long MagneticVariationDate(int year, int month, int day) {
+  return yymmdd_to_julian_days(year-2000, month, day);
+}
+
+} // namespace
+
+
+//
+// Evaluate grid nodes around aircraft, called by calculation thread so that
+// CalculateMagneticVariation() only interpolate cached values.
+//
+void PrefetchMagneticVariation(const NMEA_INFO& Basic) {
+  if (Basic.NAVWarning || !ValidMagneticVariationDate(Basic.Year)) {
+	return;
+  }
+  magvar_cache.prefetch(MagneticVariationDate(Basic.Year, Basic.Month, Basic.Day),
+                        Basic.Latitude, Basic.Longitude);
+}
+
+
+//
+// Interpolated from a 1 degree grid, far too precise for humans on a plane!
+// Will return 0 if error. Assuming there is always a magnetic variation.
+//
+double CalculateMagneticVariation() {
+
+  double lat=GPS_INFO.Latitude;
+  double lon=GPS_INFO.Longitude;
+
+  if (  GPS_INFO.NAVWarning ||
+	!ValidMagneticVariationDate(GPS_INFO.Year) ||
+	lat == 0 || lon == 0
+     )  return 0.0;
+
+  const double magvar = magvar_cache.get(
+		MagneticVariationDate(GPS_INFO.Year, GPS_INFO.Month, GPS_INFO.Day), lat, lon);
 
   // Check for a consistent result
   if (magvar != magvar) {
@@ -69,8 +100,8 @@ double CalculateMagneticVariation() {
   }
 
   #if TESTBENCH
-  StartupStore(_T(".... Lat=%f Lon=%f H=%f y=%d m=%d d=%d MAGVAR= %f\n"),
-	GPS_INFO.Latitude, GPS_INFO.Longitude, h, 
+  StartupStore(_T(".... Lat=%f Lon=%f y=%d m=%d d=%d MAGVAR= %f\n"),
+	GPS_INFO.Latitude, GPS_INFO.Longitude,
 	GPS_INFO.Year, GPS_INFO.Month, GPS_INFO.Day, magvar);
   #endif
 
@@ -78,4 +109,3 @@ double CalculateMagneticVariation() {
   return magvar;
 
 }
-
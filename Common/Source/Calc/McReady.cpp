@@ -11,6 +11,8 @@
 #include "DoInits.h"
 #include "utils/stl_utils.h"
 #include "Util/Clamp.hpp"
+#include "MacCreadySolver.h"
+#include <mutex>
 
 
 double GlidePolar::polar_a;
@@ -33,6 +35,8 @@ double GlidePolar::FlapsMass = 0.0;
 
 double GlidePolar::SafetyMacCready= 0.5;
 
+std::shared_ptr<const MacCreadySolver> GlidePolar::_solver;
+
 static unsigned iSAFETYSPEED=0;
 
 // GetAUW is returning gross weight of glider, with pilot and current ballast.
@@ -117,6 +121,14 @@ void GlidePolar::SetBallast() {
      TESTBENCH_DO_ONLY(10, StartupStore(_T(".... SetBallast bestld=%f NOT FOUND! Polar error?%s"),bestld,NEWLINE));
      bestld=1;
   }
+
+  std::shared_ptr<const MacCreadySolver> solver = std::make_shared<MacCreadySolver>(
+      _sinkratecache, std::size(_sinkratecache), _Vminsink, iSAFETYSPEED, SAFTEYSPEED);
+  std::atomic_store(&_solver, std::move(solver));
+}
+
+std::shared_ptr<const MacCreadySolver> GlidePolar::Solver() {
+  return std::atomic_load(&_solver);
 }
 
 inline double GlidePolar::_SinkRateFast(const double &MC, const unsigned &v) {
@@ -172,163 +184,49 @@ double GlidePolar::MacCreadyAltitude_internal(double emcready,
                                             #endif
 {
 
-  double BestSpeed, BestGlide, Glide;
-  double BestSinkRate, TimeToDestCruise;
-  static double HeadWind, CrossWind=0.0;
-  static double CrossBearingLast= -1.0;
-  static double WindSpeedLast= -1.0;
-  double CrossBearing;
-  double BestTime;
-  static double HeadWindSqd, CrossWindSqd=0.0;
-
-  CrossBearing = AngleLimit360(Bearing - WindBearing);
-  if ((CrossBearing != CrossBearingLast)||(WindSpeed != WindSpeedLast)) {
-    // saves a few floating point operations
-    HeadWind = WindSpeed * fastcosine(CrossBearing);
-    CrossWind = WindSpeed * fastsine(CrossBearing);
-    HeadWindSqd = HeadWind*HeadWind;
-    CrossWindSqd = CrossWind*CrossWind;
-
-    // save old values
-    CrossBearingLast = CrossBearing;
-    WindSpeedLast = WindSpeed;
-  }
-
-  double sinkrate;
-  double tc; // time spent in cruise
-
-  // TODO accuracy: extensions to Mc to incorporate real-life issues
-  // - [done] best cruise track and bearing (final glide and for waypoint)
-  // - climb before or after turning waypoints.
-  // - mcready ring changes with height allowing for risk and decreased rate
-  // - cloud streets
-  // - sink rate between thermals
-  // - modify Vtrack for IAS
-
-  //Calculate Best Glide Speed
-  BestSpeed = 4; // 4 m/s is less speed for _sinkRatecache
-  BestGlide = 10000;
-  BestTime = 1e6;
-
-  // The following makes sure BCT gets set to Bearing in the event that
-  // we're unable to advance against the wind with any glide speed.
+  // Best speed search is done by MacCreadySolver : no static state here, this can
+  // be called from any thread.
+  const std::shared_ptr<const MacCreadySolver> solver = Solver();
 
   if (BestCruiseTrack) {
     *BestCruiseTrack = Bearing;
   }
 
-  double vtot;
-  // REWRITING DISTANCE!
-  if (Distance<1.0) {
-    Distance = 1;
-  }
-
-  double TimeToDestTotal = ERROR_TIME; // initialise to error value
-  TimeToDestCruise = -1; // initialise to error value
-
-  #ifdef BCT_ALT_FIX
-  bool SpeedFound = false;
-  #endif
-
-  for(unsigned _i=_Vminsink;_i<=iSAFETYSPEED;_i++) {
-    double vtrack_real = ((double)_i)/2.0; // actual airspeed
-    double vtrack = vtrack_real*cruise_efficiency;
-    // TAS along bearing in cruise
-
-    // glide angle = velocity projected along path / sink rate
-    // need to work out best velocity along path given wind vector
-    // need to work out percent time spent cruising
-    // SinkRate function returns negative value for sink
-
-    if (isFinalGlide) {
-      sinkrate = -_SinkRateFast(max(0.0,emcready), _i);
-      // tc=1 will make wind 0 and not taken into account
-      tc = 1.0; // assume no circling, e.g. final glide at best LD
-      // with no climbs
-    } else {
-	// WE ARE REWRITING EMCREADY!
-      emcready = max(MIN_MACCREADY,emcready);
-      sinkrate = -_SinkRateFast(0.0, _i);
-      BUGSTOP_LKASSERT((sinkrate+emcready)!=0);
-      if ( (sinkrate+emcready)==0 ) sinkrate+=0.1; // to check
-      tc = max(0.0,min(1.0,emcready/(sinkrate+emcready)));
-    }
-
-    // calculate average speed along track relative to wind
-    vtot = (vtrack*vtrack*tc*tc-CrossWindSqd);
-    // if able to advance against crosswind
-    if (vtot>0) {
-      // if able to advance against headwind
-      if (vtot>HeadWindSqd) {
-	// calculate average speed along track relative to ground
-	vtot = sqrt(vtot)-HeadWind;
-      } else {
-	// can't advance at this speed
-	continue;
-      }
+  if (!solver) {
+    // polar not yet initialized.
+    if (TimeToGo) {
+      *TimeToGo = ERROR_TIME;
     }
+    return 0;
+  }
 
-    // can't advance at this speed
-    if (vtot<=0) continue;
-
-    bool bestfound = false;
-
-    if (isFinalGlide) {
-      // inverse glide ratio relative to ground
-      Glide = sinkrate/vtot;
+  const MacCreadySolver::result_t result = solver->Solve(emcready, Distance, Bearing,
+                                                         WindSpeed, WindBearing,
+                                                         isFinalGlide, cruise_efficiency);
 
-      // best glide angle when in final glide
-      if (Glide <= BestGlide) {
-	bestfound = true;
-	BestGlide = Glide;
-	TimeToDestTotal = Distance/vtot;
-      }
-    } else {
-      // time spent in cruise
-      double Time_cruise = (tc/vtot)*Distance;
-      BUGSTOP_LKASSERT(emcready!=0);
-      if (emcready==0) emcready=0.1;
-      double Time_climb = sinkrate*(Time_cruise/emcready);
-
-      // total time to destination
-      TimeToDestTotal = max(Time_cruise+Time_climb,0.0001);
-      // best average speed when in maintaining height mode
-      if (TimeToDestTotal <= BestTime) {
-	bestfound = true;
-	BestTime = TimeToDestTotal;
-      }
+  if (result.found) {
+  #ifndef BCT_ALT_FIX
+    if (BestCruiseTrack) {
+      *BestCruiseTrack = result.cruise_track;
     }
-
-    if (bestfound) {
-      BestSpeed = min(SAFTEYSPEED, vtrack_real);
-      #ifdef BCT_ALT_FIX
-      SpeedFound = true;
-      #else
-
-      if (BestCruiseTrack) {
-	// best track bearing is the track along cruise that
-	// compensates for the drift during climb
-
-	*BestCruiseTrack =
-	  atan2(CrossWind*(tc-1),vtot
-		+HeadWind*(1-tc))*RAD_TO_DEG+Bearing;
-      }
-      #endif
-
-      if (VMacCready) {
-	*VMacCready = BestSpeed;
-      }
-
-      // speed along track during cruise component
-      TimeToDestCruise = Distance*tc/vtot;
-
-    } else {
-	// no need to continue search, max already found..
-	break;
+  #endif
+    if (VMacCready) {
+      *VMacCready = result.speed;
     }
   }
 
   #ifdef BCT_ALT_FIX
+  const bool SpeedFound = result.found;
+  if (!isFinalGlide) {
+    emcready = max(MIN_MACCREADY,emcready);
+  }
+  if (Distance<1.0) {
+    Distance = 1;
+  }
+  const double CrossBearing = AngleLimit360(Bearing - WindBearing);
+  const double HeadWind = WindSpeed * fastcosine(CrossBearing);
+  const double CrossWind = WindSpeed * fastsine(CrossBearing);
+
   if (SpeedFound && BestCruiseTrack && !isFinalGlide) {
 
     // Calculate "best cruise track", the track along cruise that
@@ -488,14 +386,12 @@ double GlidePolar::MacCreadyAltitude_internal(double emcready,
 
   #endif // BCT_ALT_FIX
 
-  BestSinkRate = SinkRateFast(0,BestSpeed);
-
   if (TimeToGo) {
-    *TimeToGo = TimeToDestTotal;
+    *TimeToGo = result.time;
   }
 
   // this is the altitude needed to final glide to destination
-  return -BestSinkRate * TimeToDestCruise;
+  return result.altitude;
 }
 
 
@@ -727,9 +623,9 @@ double GlidePolar::MacCreadyAltitude(double emcready,
 #endif
 
 #ifndef BCT_ALT_FIX
-  static double cur_BestCruiseTrack;
+  double cur_BestCruiseTrack = BestCruiseTrack ? *BestCruiseTrack : Bearing;
 #endif
-  static double cur_VMacCready;
+  double cur_VMacCready = VMacCready ? *VMacCready : 0;
 
   static double cache_checksum[CASIZE];
   static double cache_altitude[CASIZE];
@@ -750,6 +646,10 @@ double GlidePolar::MacCreadyAltitude(double emcready,
   static double cache_TaskAltDiff[CASIZE];
 #endif
 
+  // cache is shared by calculation and draw threads, result is computed without lock.
+  static FastMutex cache_mutex;
+  std::unique_lock<FastMutex> cache_lock(cache_mutex);
+
   if (DoInit[MDI_MCREADYCACHE]) {
 	for (i=0; i<CASIZE; i++) {
 		cache_checksum[i]=0;
@@ -905,6 +805,7 @@ double GlidePolar::MacCreadyAltitude(double emcready,
 	Cache_Fail_MCA++;
 	#endif
   }
+  cache_lock.unlock();
 
 #endif
 
@@ -1010,6 +911,7 @@ double GlidePolar::MacCreadyAltitude(double emcready,
 
 #if (LK_CACHECALC && LK_CACHECALC_MCA)
   if (!cacheFound) {
+	cache_lock.lock();
 	// add inside cache
 	if (++cacheIndex>=CASIZE) cacheIndex=0;
 
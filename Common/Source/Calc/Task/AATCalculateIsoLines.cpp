@@ -8,120 +8,152 @@
 
 #include "externs.h"
 #include "CalcTask.h"
+#include "task_zone.h"
+#include "aat_isoline.h"
+#include <array>
+#include <vector>
 
+namespace {
 
+task::isoline_zone to_isoline_zone(const task::sector_data& data) {
+  return { task::isoline_zone::sector, data.center, data.max_radius, data.start_radial, data.end_radial, 0., 0. };
+}
+
+task::isoline_zone to_isoline_zone(const task::circle_data& data) {
+  return { task::isoline_zone::circle, data.center, data.radius, 0., 0., 0., 0. };
+}
+
+task::isoline_zone to_isoline_zone(const task::dae_data& data) {
+  return { task::isoline_zone::dae, data.center, 0., 0., 0., data.bisector, 0. };
+}
+
+task::isoline_zone to_isoline_zone(const task::line_data& data) {
+  return { task::isoline_zone::line, data.center, data.radius, 0., 0., data.bisector, data.inbound };
+}
+
+template <sector_type_t type, int task_type>
+task::isoline_zone GetIsolineZone(int tp_index) {
+  return to_isoline_zone(task::zone_data<type, task_type>::get(tp_index));
+}
+
+/**
+ * copy of turnpoint zone, same data as `InTurnSector()`
+ */
+struct GetIsolineZone_t {
+  using result_type = task::isoline_zone;
+
+  static task::isoline_zone invalid() {
+    return { task::isoline_zone::none, {}, 0., 0., 0., 0., 0. };
+  }
+
+  template <sector_type_t type>
+  static task::isoline_zone invoke(int tp_index) {
+    if (UseAATTarget()) {
+      return GetIsolineZone<type, TSK_AAT>(tp_index);
+    } else {
+      return GetIsolineZone<type, TSK_DEFAULT>(tp_index);
+    }
+  }
+};
+
+struct isoline_cache_t {
+  bool computed = false;
+  task::isoline_input input;
+  GeoPoint points[MAXISOLINES];
+  bool valid[MAXISOLINES];
+};
+
+/**
+ * last computed isolines of each turnpoint.
+ *
+ * `CalculateAATIsoLines()` is called from calculation, draw and main thread :
+ * only read or written with task data locked.
+ */
+std::array<isoline_cache_t, MAXTASKPOINTS> isoline_cache;
+
+/**
+ * copy of task data needed to compute isolines of turnpoint <i>
+ * must be called with task data locked.
+ */
+task::isoline_input GetIsolineInput(int i) {
+  return {
+    { Task[i-1].AATTargetLat, Task[i-1].AATTargetLon },
+    { Task[i].AATTargetLat, Task[i].AATTargetLon },
+    { Task[i+1].AATTargetLat, Task[i+1].AATTargetLon },
+    (Task[i].AATType == sector_type_t::SECTOR) ? Task[i].AATSectorRadius : Task[i].AATCircleRadius,
+    task::invoke_for_task_point<GetIsolineZone_t>(i)
+  };
+}
+
+} // namespace
+
+/**
+ * Isolines are computed from a copy of task data : only turnpoints with a
+ * moved target, a moved neighbour target or a changed zone are computed
+ * again, concurrently and without task lock, into a private copy.
+ * Results are published to the cache with task lock, only if task data
+ * have not changed in the meantime.
+ */
 void CalculateAATIsoLines(void) {
-  int i;
-  int awp = ActiveTaskPoint;
-  double stepsize = 25.0;
 
   if(gTaskType==TSK_AAT)
     return;
 
+  std::array<int, MAXTASKPOINTS> updated;
+  size_t updated_count = 0;
+  std::vector<std::pair<int, isoline_cache_t>> changed;
+
   LockTaskData();
+  const int awp = ActiveTaskPoint;
+  for(int i=1;i<MAXTASKPOINTS;i++) {
+    if (!ValidTaskPoint(i) || !ValidTaskPoint(i+1)) {
+      // This must be the final waypoint, so it's not an AAT OZ
+      continue;
+    }
+    // JMWAAT: if locked, don't move it
+    if (i<awp) {
+      // only update targets for current/later waypoints
+      continue;
+    }
 
-  for(i=1;i<MAXTASKPOINTS;i++) {
-
-    if(ValidTaskPoint(i)) {
-      if (!ValidTaskPoint(i+1)) {
-        // This must be the final waypoint, so it's not an AAT OZ
-        continue;
-      }
-      // JMWAAT: if locked, don't move it
-      if (i<awp) {
-        // only update targets for current/later waypoints
-        continue;
-      }
-
-      int j;
-      for (j=0; j<MAXISOLINES; j++) {
-        TaskStats[i].IsoLine_valid[j] = false;
-      }
-
-      double latitude = Task[i].AATTargetLat;
-      double longitude = Task[i].AATTargetLon;
-      double dist_0, dist_north, dist_east;
-      bool in_sector = true;
-
-      double max_distance, delta;
-      if(Task[i].AATType == sector_type_t::SECTOR) {
-        max_distance = Task[i].AATSectorRadius;
-      } else {
-        max_distance = Task[i].AATCircleRadius;
-      }
-      delta = max_distance*2.4 / (MAXISOLINES);
-      bool left = false;
-
-      /*
-      double distance_glider=0;
-      if ((i==ActiveTaskPoint) && (CALCULATED_INFO.IsInSector)) {
-        distance_glider = DoubleLegDistance(i, GPS_INFO.Longitude, GPS_INFO.Latitude);
-      }
-      */
-
-      // fill
-      j=0;
-      // insert start point
-      TaskStats[i].IsoLine_Latitude[j] = latitude;
-      TaskStats[i].IsoLine_Longitude[j] = longitude;
-      TaskStats[i].IsoLine_valid[j] = true;
-      j++;
-
-      do {
-        dist_0 = DoubleLegDistance(i, longitude, latitude);
-
-        double latitude_north, longitude_north;
-        FindLatitudeLongitude(latitude, longitude,
-                              0, stepsize,
-                              &latitude_north,
-                              &longitude_north);
-        dist_north = DoubleLegDistance(i, longitude_north, latitude_north);
-
-        double latitude_east, longitude_east;
-        FindLatitudeLongitude(latitude, longitude,
-                              90, stepsize,
-                              &latitude_east,
-                              &longitude_east);
-        dist_east = DoubleLegDistance(i, longitude_east, latitude_east);
-
-        double angle = AngleLimit360(RAD_TO_DEG*atan2(dist_east-dist_0, dist_north-dist_0)+90);
-        if (left) {
-          angle += 180;
-        }
-
-        FindLatitudeLongitude(latitude, longitude,
-                              angle, delta,
-                              &latitude,
-                              &longitude);
-
-        in_sector = InTurnSector({{latitude, longitude}, 0}, i);
-        /*
-        if (dist_0 < distance_glider) {
-          in_sector = false;
-        }
-        */
-        if (in_sector) {
-          TaskStats[i].IsoLine_Latitude[j] = latitude;
-          TaskStats[i].IsoLine_Longitude[j] = longitude;
-          TaskStats[i].IsoLine_valid[j] = true;
-          j++;
-        } else {
-          j++;
-          if (!left && (j<MAXISOLINES-2))  {
-            left = true;
-            latitude = Task[i].AATTargetLat;
-            longitude = Task[i].AATTargetLon;
-            in_sector = true; // cheat to prevent early exit
-
-            // insert start point (again)
-            TaskStats[i].IsoLine_Latitude[j] = latitude;
-            TaskStats[i].IsoLine_Longitude[j] = longitude;
-            TaskStats[i].IsoLine_valid[j] = true;
-            j++;
-          }
-        }
-      } while (in_sector && (j<MAXISOLINES));
+    const task::isoline_input input = GetIsolineInput(i);
+    const isoline_cache_t& cache = isoline_cache[i];
+    if (!cache.computed || cache.input != input) {
+      changed.emplace_back();
+      changed.back().first = i;
+      changed.back().second.input = input;
+    }
+    updated[updated_count++] = i;
+  }
+  UnlockTaskData();
+
+  const size_t changed_count = changed.size();
+#if defined(_OPENMP)
+  #pragma omp parallel for schedule(dynamic) if(changed_count > 1)
+#endif
+  for (size_t k = 0; k < changed_count; ++k) {
+    isoline_cache_t& result = changed[k].second;
+    task::compute_isoline(result.input, result.points, result.valid);
+    result.computed = true;
+  }
 
+  LockTaskData();
+  for (const auto& [i, result] : changed) {
+    // task changed while computing : keep cache outdated, next call will compute it again.
+    if (ValidTaskPoint(i) && ValidTaskPoint(i+1) && GetIsolineInput(i) == result.input) {
+      isoline_cache[i] = result;
+    }
+  }
+  for (size_t k = 0; k < updated_count; ++k) {
+    const isoline_cache_t& cache = isoline_cache[updated[k]];
+    if (!cache.computed) {
+      continue;
+    }
+    TASKSTATS_POINT& stats = TaskStats[updated[k]];
+    for (int j=0; j<MAXISOLINES; j++) {
+      stats.IsoLine_Latitude[j] = cache.points[j].latitude;
+      stats.IsoLine_Longitude[j] = cache.points[j].longitude;
+      stats.IsoLine_valid[j] = cache.valid[j];
     }
   }
   UnlockTaskData();
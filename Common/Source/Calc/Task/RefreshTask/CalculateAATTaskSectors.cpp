@@ -156,11 +156,13 @@ void CalculateAATTaskSectors()
     }
   }
 
-  CalculateAATIsoLines();
   if (!TargetDialogOpen) {
     TargetModified = false;
     // allow target dialog to detect externally changed targets
   }
 
   UnlockTaskData();
+
+  // isolines are computed from a copy of task data, without task lock
+  CalculateAATIsoLines();
 }
@@ -0,0 +1,240 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   aat_isoline.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_TASK_AAT_ISOLINE_H_
+#define _CALC_TASK_AAT_ISOLINE_H_
+
+#include "Geographic/SphereBatch.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Isoline of a turnpoint : positions inside the zone giving the same distance
+ * ( previous target -> position -> next target ) as current target.
+ *
+ * Computation only use a copy of task data ( `isoline_input` ), so it can run
+ * without task lock, and be skipped as long as this copy doesn't change.
+ *
+ * Isoline is walked in a plane centred on target : previous target, next
+ * target and zone center are placed at their true distance and bearing from
+ * target ( azimuthal equidistant ), gradient of the double leg distance is
+ * the sum of unit vectors from both targets, so each step is a few
+ * multiplications and one square root instead of three geodesic problems.
+ */
+namespace task {
+
+/**
+ * turnpoint zone, same checks as `InTurnSector()`
+ */
+struct isoline_zone {
+  enum kind_t {
+    none,
+    circle,
+    sector,
+    dae,
+    line,
+  };
+
+  kind_t kind;
+  GeoPoint center;
+  double radius;        // circle radius, sector max radius
+  double start_radial;  // sector
+  double end_radial;    // sector
+  double bisector;      // dae, line
+  double inbound;       // line
+
+  bool operator==(const isoline_zone& other) const {
+    return kind == other.kind
+        && center.latitude == other.center.latitude
+        && center.longitude == other.center.longitude
+        && radius == other.radius
+        && start_radial == other.start_radial
+        && end_radial == other.end_radial
+        && bisector == other.bisector
+        && inbound == other.inbound;
+  }
+};
+
+struct isoline_input {
+  GeoPoint previous;   // previous target
+  GeoPoint target;
+  GeoPoint next;       // next target
+  double max_distance; // zone size, define spacing of isoline points
+  isoline_zone zone;
+
+  bool operator==(const isoline_input& other) const {
+    return previous.latitude == other.previous.latitude
+        && previous.longitude == other.previous.longitude
+        && target.latitude == other.target.latitude
+        && target.longitude == other.target.longitude
+        && next.latitude == other.next.latitude
+        && next.longitude == other.next.longitude
+        && max_distance == other.max_distance
+        && zone == other.zone;
+  }
+
+  bool operator!=(const isoline_input& other) const {
+    return !(*this == other);
+  }
+};
+
+namespace detail {
+
+struct vector_t {
+  double x; // East (m)
+  double y; // North (m)
+};
+
+inline double angle_360(double angle) {
+  angle = std::fmod(angle, 360.);
+  return (angle < 0.) ? angle + 360. : angle;
+}
+
+inline double angle_180(double angle) {
+  angle = angle_360(angle);
+  return (angle > 180.) ? angle - 360. : angle;
+}
+
+// same as `AngleInRange(start, end, angle, true)`
+inline bool angle_in_range(double start, double end, double angle) {
+  start = angle_360(start);
+  end = angle_360(end);
+  angle = angle_360(angle);
+  if (end >= start) {
+    return angle >= start && angle <= end;
+  }
+  return angle >= start || angle <= end;
+}
+
+// bearing of <v> ( deg, 0 is North )
+inline double bearing(const vector_t& v) {
+  return angle_360(std::atan2(v.x, v.y) * sphere::detail::rad_to_deg);
+}
+
+inline bool inside(const isoline_zone& zone, const vector_t& center, const vector_t& position) {
+  const vector_t v = { position.x - center.x, position.y - center.y };
+  const double distance = std::hypot(v.x, v.y);
+  switch (zone.kind) {
+    case isoline_zone::circle:
+      return distance < zone.radius;
+    case isoline_zone::sector:
+      return distance < zone.radius && angle_in_range(zone.start_radial, zone.end_radial, bearing(v));
+    case isoline_zone::dae:
+      return distance < 500.
+          || (distance < 10000. && std::fabs(angle_180(bearing(v) - zone.bisector)) <= 45.);
+    case isoline_zone::line: {
+      // bearing from position to zone center
+      const double to_center = bearing({ -v.x, -v.y });
+      const double reciprocal = angle_360(zone.bisector + 180.);
+      if (angle_360(zone.inbound - zone.bisector) < 180.) {
+        return angle_in_range(reciprocal, zone.bisector, to_center);
+      }
+      return angle_in_range(zone.bisector, reciprocal, to_center);
+    }
+    case isoline_zone::none:
+      break;
+  }
+  return false;
+}
+
+} // namespace detail
+
+/**
+ * fill <Count> isoline points of task point described by <input>.
+ * Walk from target in both direction, until the zone border, perpendicular to
+ * gradient of double leg distance. Steps outside the zone are left invalid.
+ */
+template<size_t Count>
+void compute_isoline(const isoline_input& input, GeoPoint (&points)[Count], bool (&valid)[Count]) {
+  static_assert(Count > 2, "too few isoline points");
+  using detail::vector_t;
+
+  constexpr size_t count = Count;
+  std::fill_n(valid, count, false);
+
+  // previous target, next target, zone center in target plane
+  const GeoPoint references[] = { input.previous, input.next, input.zone.center };
+  double distances[3], bearings[3];
+  sphere::DistanceBearing(input.target, references, 3, distances, bearings);
+  vector_t plane[3];
+  for (size_t i = 0; i < 3; ++i) {
+    const double angle = bearings[i] * sphere::detail::deg_to_rad;
+    plane[i] = { distances[i] * std::sin(angle), distances[i] * std::cos(angle) };
+  }
+  const vector_t& previous = plane[0];
+  const vector_t& next = plane[1];
+  const vector_t& center = plane[2];
+
+  // unit vector from <from> to <to>, null if both are the same
+  auto unit = [](const vector_t& from, const vector_t& to) -> vector_t {
+    const vector_t v = { to.x - from.x, to.y - from.y };
+    const double norm = std::hypot(v.x, v.y);
+    return (norm > 0.) ? vector_t{ v.x / norm, v.y / norm } : vector_t{ 0., 0. };
+  };
+
+  const double delta = input.max_distance * 2.4 / count;
+
+  std::array<vector_t, count> walk;
+
+  vector_t position = { 0., 0. };
+  bool left = false;
+  bool in_sector = true;
+
+  size_t j = 0;
+  walk[j] = position;
+  valid[j++] = true;
+
+  do {
+    // gradient of distance (previous -> position -> next)
+    const vector_t from_previous = unit(previous, position);
+    const vector_t from_next = unit(next, position);
+    vector_t gradient = { from_previous.x + from_next.x, from_previous.y + from_next.y };
+    const double norm = std::hypot(gradient.x, gradient.y);
+    gradient = (norm > 0.) ? vector_t{ gradient.x / norm, gradient.y / norm } : vector_t{ 0., 1. };
+
+    // step perpendicular to gradient : 90° right, or 90° left
+    const double side = left ? -1. : 1.;
+    position.x += side * delta * gradient.y;
+    position.y -= side * delta * gradient.x;
+
+    in_sector = detail::inside(input.zone, center, position);
+    if (in_sector) {
+      walk[j] = position;
+      valid[j++] = true;
+    } else {
+      j++;
+      if (!left && (j < count - 2)) {
+        left = true;
+        position = { 0., 0. };
+        in_sector = true; // cheat to prevent early exit
+
+        // insert start point (again)
+        walk[j] = position;
+        valid[j++] = true;
+      }
+    }
+  } while (in_sector && (j < count));
+
+  // back to geographic coordinates, all points at once.
+  double walk_distances[count];
+  double walk_bearings[count];
+  for (size_t i = 0; i < count; ++i) {
+    const vector_t v = valid[i] ? walk[i] : vector_t{ 0., 0. };
+    walk_distances[i] = std::hypot(v.x, v.y);
+    walk_bearings[i] = detail::bearing(v);
+  }
+  sphere::FindLatitudeLongitude(input.target, walk_bearings, walk_distances, count, points);
+}
+
+} // namespace task
+
+#endif // _CALC_TASK_AAT_ISOLINE_H_
@@ -8,24 +8,169 @@
 
 #include "externs.h"
 #include "NavFunctions.h"
+#include "Geographic/GeoPoint.h"
+#include "McReady.h"
+#include "RasterTerrain.h"
+#include <array>
 
-void FillGlideFootPrint(double latitude, double longitude, double altitude, DERIVED_INFO *Calculated, double max_range,  pointObj* out, size_t count) {
+namespace {
 
-  const pointObj* first_out = out; // this is first polygon point (OpenGL or not), used for close polygon.
-  for (size_t i = 0; i < count; ++i) {
-    const double bearing = (i*360.0)/count;
-    double lat, lon;
+/**
+ * Terrain glide range around one point, computed for NUMTERRAINSWEEPS bearings.
+ *
+ * Sweeps are independent : they are computed concurrently (OpenMP) while
+ * RasterTerrain lock is held by calculation thread, each sweep reads terrain
+ * with its own sampling resolution so no lock is needed inside sweeps.
+ *
+ * To limit cost of a high sweep count, only even sweeps are always computed,
+ * odd ones are computed again only if one of their neighbours has changed since
+ * previous footprint, otherwise previous range is reused from the new center.
+ * Full footprint is computed again every `full_refresh_period` call.
+ *
+ * Position of sweeps ending out of range or reused from previous footprint
+ * are computed at end, with one batch FindLatitudeLongitude call.
+ */
+class GlideFootPrintSweeps final {
+  static constexpr size_t sweep_count = NUMTERRAINSWEEPS;
+  static_assert((sweep_count % 2) == 0, "NUMTERRAINSWEEPS must be even");
+
+  static constexpr unsigned full_refresh_period = 8;
+
+  // neighbour sweep range change that require to compute odd sweep again.
+  static constexpr double min_change = 100.; // m
+  static constexpr double min_change_ratio = 0.02;
+
+ public:
+  void Reset() {
+    _age = full_refresh_period;
+  }
+
+  void Fill(double latitude, double longitude, double altitude, DERIVED_INFO *Calculated, double max_range, pointObj* out);
+
+ private:
+  struct sweep_t {
+    double bearing;
+    double irange;
+    double distance;
+    double latitude;
+    double longitude;
+    bool project; // position to compute from bearing and distance
+  };
+
+  static bool Changed(double previous, double current) {
+    return fabs(current - previous) > std::max(min_change, previous * min_change_ratio);
+  }
+
+  void Compute(const size_t* index, size_t count, double latitude, double longitude, double altitude, double max_range);
+  void Project(double latitude, double longitude);
+
+  std::array<sweep_t, sweep_count> _sweeps = {};
+  std::array<double, sweep_count> _previous = {}; // range of previous footprint
+  unsigned _age = full_refresh_period;
+};
+
+void GlideFootPrintSweeps::Compute(const size_t* index, size_t count,
+                                   double latitude, double longitude, double altitude, double max_range) {
+
+  ScopeLock lock(RasterTerrain::mutex);
+  const RasterMap* map = RasterTerrain::TerrainMap.get();
+
+#if defined(_OPENMP)
+  #pragma omp parallel for schedule(dynamic)
+#endif
+  for (size_t k = 0; k < count; ++k) {
+    sweep_t& sweep = _sweeps[index[k]];
     bool out_of_range = false;
-    const double distance = FinalGlideThroughTerrain(bearing, latitude, longitude, altitude,
-                                        Calculated, &lat, &lon, max_range, &out_of_range, nullptr );
-    if (out_of_range) {
-      FindLatitudeLongitude(latitude, longitude, bearing, distance, &lat, &lon);
+    sweep.distance = FinalGlideThroughTerrain(map, sweep.irange, sweep.bearing, latitude, longitude, altitude,
+                                              &sweep.latitude, &sweep.longitude, max_range, &out_of_range, nullptr);
+    sweep.project = out_of_range;
+  }
+}
+
+void GlideFootPrintSweeps::Project(double latitude, double longitude) {
+  std::array<size_t, sweep_count> index;
+  std::array<double, sweep_count> bearings;
+  std::array<double, sweep_count> distances;
+  std::array<GeoPoint, sweep_count> points;
+
+  size_t count = 0;
+  for (size_t i = 0; i < sweep_count; ++i) {
+    const sweep_t& sweep = _sweeps[i];
+    if (sweep.project) {
+      index[count] = i;
+      bearings[count] = sweep.bearing;
+      distances[count] = sweep.distance;
+      ++count;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+
+  FindLatitudeLongitude({latitude, longitude}, bearings.data(), distances.data(), count, points.data());
+
+  for (size_t k = 0; k < count; ++k) {
+    sweep_t& sweep = _sweeps[index[k]];
+    sweep.latitude = points[k].latitude;
+    sweep.longitude = points[k].longitude;
+  }
+}
+
+void GlideFootPrintSweeps::Fill(double latitude, double longitude, double altitude, DERIVED_INFO *Calculated, double max_range, pointObj* out) {
+
+  // glide ratio for each bearing, shared by both passes.
+  for (size_t i = 0; i < sweep_count; ++i) {
+    sweep_t& sweep = _sweeps[i];
+    sweep.bearing = (i*360.0)/sweep_count;
+    sweep.irange = GlidePolar::MacCreadyAltitude(MACCREADY, 1.0, sweep.bearing,
+                                                 Calculated->WindSpeed, Calculated->WindBearing,
+                                                 0, 0, true, 0);
+  }
+
+  std::array<size_t, sweep_count> index;
+  size_t count = 0;
+
+  const bool full_refresh = (++_age >= full_refresh_period);
+  if (full_refresh) {
+    for (size_t i = 0; i < sweep_count; ++i) {
+      index[count++] = i;
+    }
+    Compute(index.data(), count, latitude, longitude, altitude, max_range);
+    _age = 0;
+  } else {
+    for (size_t i = 0; i < sweep_count; i += 2) {
+      index[count++] = i;
+    }
+    Compute(index.data(), count, latitude, longitude, altitude, max_range);
+
+    count = 0;
+    for (size_t i = 1; i < sweep_count; i += 2) {
+      const size_t next = (i + 1) % sweep_count;
+      if (Changed(_previous[i - 1], _sweeps[i - 1].distance) || Changed(_previous[next], _sweeps[next].distance)) {
+        index[count++] = i;
+      } else {
+        sweep_t& sweep = _sweeps[i];
+        sweep.distance = _previous[i];
+        sweep.project = true;
+      }
     }
-    *(out++) = (pointObj){lon, lat};
+    Compute(index.data(), count, latitude, longitude, altitude, max_range);
+  }
+  Project(latitude, longitude);
+
+  const pointObj* first_out = out; // this is first polygon point (OpenGL or not), used for close polygon.
+  for (size_t i = 0; i < sweep_count; ++i) {
+    const sweep_t& sweep = _sweeps[i];
+    _previous[i] = sweep.distance;
+    *(out++) = (pointObj){sweep.longitude, sweep.latitude};
   }
   (*out) = (*first_out); // close polygon
 }
 
+GlideFootPrintSweeps GlideFootPrint;
+GlideFootPrintSweeps GlideFootPrint2;
+
+} // namespace
 
 void TerrainFootprint(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
 
@@ -52,9 +197,10 @@ void TerrainFootprint(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
 #endif
   
   if(FinalGlideTerrain) {
-    FillGlideFootPrint(Basic->Latitude, Basic->Longitude, Calculated->NavAltitude, Calculated, mymaxrange, out, NUMTERRAINSWEEPS);
+    GlideFootPrint.Fill(Basic->Latitude, Basic->Longitude, Calculated->NavAltitude, Calculated, mymaxrange, out);
     Calculated->GlideFootPrint_valid = true;
   } else {
+    GlideFootPrint.Reset();
     Calculated->GlideFootPrint_valid = false;  
   }
 
@@ -120,11 +266,14 @@ void TerrainFootprint(NMEA_INFO *Basic, DERIVED_INFO *Calculated) {
                       PanLongitude, &mymaxrange, NULL);
       mymaxrange += ScreenRange;
    
-      FillGlideFootPrint(lat_wp, lon_wp, alt_arriv_msl, Calculated, mymaxrange, Calculated->GlideFootPrint2, NUMTERRAINSWEEPS);
+      GlideFootPrint2.Fill(lat_wp, lon_wp, alt_arriv_msl, Calculated, mymaxrange, Calculated->GlideFootPrint2);
       GlideFootPrint2_valid = true;
 
     } // if reachable above "terrain height"
   } // if valid task point
+  if (!GlideFootPrint2_valid) {
+    GlideFootPrint2.Reset();
+  }
   Calculated->GlideFootPrint2_valid = GlideFootPrint2_valid;
   
   UnlockTaskData();
@@ -0,0 +1,157 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   geo_grid_cache.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_GEO_GRID_CACHE_H_
+#define _CALC_GEO_GRID_CACHE_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+/**
+ * Slowly varying geographic field ( magnetic variation ... ) sampled on the
+ * nodes of a regular latitude/longitude grid : value at any position is the
+ * bilinear interpolation of the 4 nodes of its cell.
+ *
+ * Node values only depend on node position and <key> ( date ... ), so result
+ * never depend on cache content nor on order of requests.
+ *
+ * `prefetch` evaluate all nodes of cells around a position, it's called by
+ * calculation thread while aircraft moves, so other users of `get` only
+ * interpolate cached nodes.
+ *
+ * Non finite node values are never cached.
+ *
+ * Thread safe. Evaluations are serialized by their own lock, <evaluate> don't
+ * need to be reentrant and cached nodes can be read while evaluating.
+ */
+template<size_t Capacity>
+class geo_grid_cache final {
+ public:
+  using evaluate_t = std::function<double(long key, double latitude, double longitude)>;
+
+  // cells around aircraft evaluated by `prefetch` : 3x3 cells, 16 nodes
+  static constexpr int prefetch_radius = 1;
+
+  static_assert(Capacity >= 2 * (2 * prefetch_radius + 2) * (2 * prefetch_radius + 2),
+                "capacity must hold prefetched nodes around two positions");
+
+  geo_grid_cache(double cell_size, evaluate_t evaluate)
+      : _cell_size(cell_size), _evaluate(std::move(evaluate)) {}
+
+  double get(long key, double latitude, double longitude) {
+    const double y = latitude / _cell_size;
+    const double x = longitude / _cell_size;
+    const int lat = static_cast<int>(std::floor(y));
+    const int lon = static_cast<int>(std::floor(x));
+    const double fy = y - lat;
+    const double fx = x - lon;
+
+    const double v00 = node(key, lat, lon);
+    const double v01 = node(key, lat, lon + 1);
+    const double v10 = node(key, lat + 1, lon);
+    const double v11 = node(key, lat + 1, lon + 1);
+
+    return (v00 * (1. - fx) + v01 * fx) * (1. - fy) + (v10 * (1. - fx) + v11 * fx) * fy;
+  }
+
+  void prefetch(long key, double latitude, double longitude) {
+    const int lat = static_cast<int>(std::floor(latitude / _cell_size));
+    const int lon = static_cast<int>(std::floor(longitude / _cell_size));
+    for (int i = lat - prefetch_radius; i <= lat + prefetch_radius + 1; ++i) {
+      for (int j = lon - prefetch_radius; j <= lon + prefetch_radius + 1; ++j) {
+        node(key, i, j);
+      }
+    }
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    for (auto& n : _nodes) {
+      n.valid = false;
+    }
+  }
+
+  // number of <evaluate> call since creation
+  size_t evaluate_count() const {
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    return _evaluate_count;
+  }
+
+ private:
+  struct node_t {
+    long key;
+    int lat;
+    int lon;
+    double value;
+    unsigned last_use;
+    bool valid;
+  };
+
+  double node(long key, int lat, int lon) {
+    {
+      std::lock_guard<std::mutex> lock(_cache_mutex);
+      if (const node_t* n = find(key, lat, lon)) {
+        return n->value;
+      }
+    }
+
+    std::lock_guard<std::mutex> evaluate_lock(_evaluate_mutex);
+    {
+      // already evaluated by another thread while waiting
+      std::lock_guard<std::mutex> lock(_cache_mutex);
+      if (const node_t* n = find(key, lat, lon)) {
+        return n->value;
+      }
+    }
+
+    const double latitude = std::clamp(lat * _cell_size, -90., 90.);
+    const double longitude = lon * _cell_size;
+    const double value = _evaluate(key, latitude, longitude);
+
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    ++_evaluate_count;
+    if (!std::isfinite(value)) {
+      // evaluation failure is not cached : node is evaluated again on next request.
+      return value;
+    }
+    // replace invalid or least recently used node
+    node_t& n = *std::min_element(_nodes.begin(), _nodes.end(), [](const node_t& a, const node_t& b) {
+      return a.valid == b.valid ? a.last_use < b.last_use : !a.valid;
+    });
+    n = { key, lat, lon, value, ++_use_count, true };
+    return value;
+  }
+
+  node_t* find(long key, int lat, int lon) {
+    for (auto& n : _nodes) {
+      if (n.valid && n.lat == lat && n.lon == lon && n.key == key) {
+        n.last_use = ++_use_count;
+        return &n;
+      }
+    }
+    return nullptr;
+  }
+
+  const double _cell_size; // degree
+  const evaluate_t _evaluate;
+
+  mutable std::mutex _cache_mutex;
+  std::mutex _evaluate_mutex;
+
+  std::array<node_t, Capacity> _nodes = {};
+  unsigned _use_count = 0;
+  size_t _evaluate_count = 0;
+};
+
+#endif // _CALC_GEO_GRID_CACHE_H_
@@ -0,0 +1,116 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   thermal_estimator.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_THERMAL_ESTIMATOR_H_
+#define _CALC_THERMAL_ESTIMATOR_H_
+
+#include "Math/Point2D.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Thermal centre : lift weighted mean of circling positions, with an
+ * exponential forgetting of old positions. Old positions drift with the air
+ * mass, so the centre follow the thermal drift.
+ *
+ * Only sums are kept : each sample decay and drift the sums once, then add
+ * itself, whatever the number of samples already used.
+ *
+ * Positions are in a local metric frame ( m, x East, y North ).
+ */
+class thermal_estimator final {
+ public:
+  using vector_t = Point2D<double>;
+
+  // weight of a sample is exp(-decay_rate * age)
+  static constexpr double decay_rate = 1.5 / 60.; // 1/s
+  // minimum lift weight, sink only move center away slightly
+  static constexpr double min_lift = -0.1;        // m/s
+  static constexpr unsigned min_samples = 5;
+
+  void reset() {
+    _sum_position = {};
+    _sum_weight = 0.;
+    _samples = 0;
+  }
+
+  /**
+   * @time : s
+   * @position : m, aircraft position
+   * @drift : m/s, air mass motion since previous sample ( downwind )
+   * @lift : m/s, netto vario
+   */
+  void add(double time, const vector_t& position, const vector_t& drift, double lift) {
+    if (_samples > 0) {
+      const double dt = time - _time;
+      if (dt < 0.) {
+        reset();
+      } else {
+        const double decay = std::exp(-decay_rate * dt);
+        _sum_position = (_sum_position + drift * (dt * _sum_weight)) * decay;
+        _sum_weight *= decay;
+      }
+    }
+    const double weight = std::max(lift, min_lift);
+    _sum_position += position * weight;
+    _sum_weight += weight;
+    _time = time;
+    ++_samples;
+  }
+
+  /**
+   * @return false if there is not enough sample, or no lift.
+   */
+  bool center(vector_t& out) const {
+    if (_samples < min_samples || _sum_weight <= 0.) {
+      return false;
+    }
+    out = _sum_position / _sum_weight;
+    return true;
+  }
+
+ private:
+  vector_t _sum_position = {};
+  double _sum_weight = 0.;
+  double _time = 0.;
+  unsigned _samples = 0;
+};
+
+/**
+ * Time for a thermal to rise from ground to <altitude> at <lift> speed.
+ *
+ * @heights : terrain height along the drift line, <count> samples equally
+ *            spaced in time from 0 ( thermal at <altitude> ) to <t_max>.
+ *
+ * Thermal and terrain are linear between samples : intersection with first
+ * segment crossing terrain is exact. If the drift line never cross terrain,
+ * return <t_max>.
+ */
+inline double thermal_base_time(double altitude, double lift, const double* heights, size_t count, double t_max) {
+  if (count < 2) {
+    return t_max;
+  }
+  const double dt = t_max / (count - 1);
+  double previous = altitude - heights[0]; // thermal height above ground
+  if (previous <= 0.) {
+    return 0.;
+  }
+  for (size_t i = 1; i < count; ++i) {
+    const double above = altitude - lift * dt * i - heights[i];
+    if (above <= 0.) {
+      return dt * (i - 1 + previous / (previous - above));
+    }
+    previous = above;
+  }
+  return t_max;
+}
+
+#endif // _CALC_THERMAL_ESTIMATOR_H_
@@ -0,0 +1,204 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   trail_store.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_TRAIL_STORE_H_
+#define _CALC_TRAIL_STORE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * Whole flight trail within `Capacity` points.
+ *
+ * Points are added at the end. When the store is full, the inner point whose
+ * removal change the trail the least is removed : the one nearest to the
+ * segment joining its neighbours. Straight legs are reduced first, then turns,
+ * so the trail always keep the shape of the whole flight at the best
+ * resolution allowed by memory.
+ *
+ * Each point keep its `tolerance` : distance between the point and the
+ * trail without it, never less than tolerance of points already removed
+ * around it. After `rank` of a copy, drawing only points with tolerance
+ * higher than pixel size give a zoom dependent level of detail, first and
+ * last points are always drawn.
+ *
+ * `add` is called by calculation thread, `copy` by draw thread.
+ */
+template<size_t Capacity>
+class trail_store final {
+ public:
+  static_assert(Capacity >= 3, "at least one inner point is needed");
+
+  struct point_t {
+    float latitude;
+    float longitude;
+    float tolerance; // m
+  };
+
+  static constexpr float always_visible = std::numeric_limits<float>::max();
+
+  trail_store() {
+    _points.reserve(Capacity + 1);
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _points.clear();
+    ++_version;
+  }
+
+  void add(double latitude, double longitude) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _points.push_back({ static_cast<float>(latitude), static_cast<float>(longitude), always_visible });
+    if (_points.size() > 2) {
+      // previous last point become an inner point
+      const size_t i = _points.size() - 2;
+      _points[i].tolerance = error(i);
+    }
+    if (_points.size() > Capacity) {
+      remove_one();
+    }
+    ++_version;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _points.size();
+  }
+
+  /**
+   * copy points to <out> if they have changed since <version>
+   * @return true if <out> and <version> are updated
+   */
+  bool copy(std::vector<point_t>& out, unsigned& version) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (version == _version) {
+      return false;
+    }
+    out.assign(_points.begin(), _points.end());
+    version = _version;
+    return true;
+  }
+
+  /**
+   * Level of detail of a copy : decimate <points> down to first and last one,
+   * and set tolerance of each point to the one at which it's removed.
+   * Removing points by increasing tolerance is the decimation order, so
+   * skipping all points below a tolerance give the same trail as decimation.
+   */
+  static void rank(std::vector<point_t>& points) {
+    const size_t size = points.size();
+    if (size < 3) {
+      return;
+    }
+    std::vector<size_t> prev(size), next(size);
+    using item_t = std::pair<float, size_t>; // tolerance, point
+    std::vector<item_t> heap;
+    heap.reserve(size);
+    for (size_t i = 1; i + 1 < size; ++i) {
+      prev[i] = i - 1;
+      next[i] = i + 1;
+      points[i].tolerance = distance(points[i - 1], points[i], points[i + 1]);
+      heap.emplace_back(points[i].tolerance, i);
+    }
+    const auto greater = std::greater<item_t>();
+    std::make_heap(heap.begin(), heap.end(), greater);
+
+    std::vector<bool> removed(size, false);
+    float tolerance = 0.f;
+    auto update = [&](size_t i) {
+      if (i == 0 || i + 1 == size) {
+        return;
+      }
+      points[i].tolerance = std::max(distance(points[prev[i]], points[i], points[next[i]]), tolerance);
+      heap.emplace_back(points[i].tolerance, i);
+      std::push_heap(heap.begin(), heap.end(), greater);
+    };
+
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), greater);
+      const item_t item = heap.back();
+      heap.pop_back();
+      const size_t i = item.second;
+      if (removed[i] || item.first != points[i].tolerance) {
+        continue; // outdated
+      }
+      removed[i] = true;
+      tolerance = item.first;
+      next[prev[i]] = next[i];
+      prev[next[i]] = prev[i];
+      update(prev[i]);
+      update(next[i]);
+    }
+  }
+
+  /**
+   * invoke <fn> for each point of <points> needed to draw the trail within
+   * <tolerance> ( m ), in reverse order : last point first.
+   */
+  template<typename Fn>
+  static void for_each_visible(const std::vector<point_t>& points, float tolerance, Fn&& fn) {
+    for (auto it = points.rbegin(); it != points.rend(); ++it) {
+      if (it->tolerance >= tolerance) {
+        fn(*it);
+      }
+    }
+  }
+
+ private:
+  // distance in m between point <i> and the segment joining its neighbours
+  float error(size_t i) const {
+    return distance(_points[i - 1], _points[i], _points[i + 1]);
+  }
+
+  // distance in m between <p> and segment [a, b]
+  static float distance(const point_t& a, const point_t& p, const point_t& b) {
+    constexpr double meter_by_degree = 111195.;
+    const double x_scale = std::cos(p.latitude * M_PI / 180.) * meter_by_degree;
+    const double abx = (b.longitude - a.longitude) * x_scale;
+    const double aby = (b.latitude - a.latitude) * meter_by_degree;
+    const double apx = (p.longitude - a.longitude) * x_scale;
+    const double apy = (p.latitude - a.latitude) * meter_by_degree;
+
+    const double length_sq = abx * abx + aby * aby;
+    const double ratio = (length_sq > 0.) ? std::clamp((apx * abx + apy * aby) / length_sq, 0., 1.) : 0.;
+    return std::hypot(apx - abx * ratio, apy - aby * ratio);
+  }
+
+  void remove_one() {
+    const auto first = std::next(_points.begin());
+    const auto last = std::prev(_points.end());
+    const auto it = std::min_element(first, last, [](const point_t& a, const point_t& b) {
+      return a.tolerance < b.tolerance;
+    });
+    const float removed = it->tolerance;
+    const size_t i = std::distance(_points.begin(), _points.erase(it));
+
+    // <i> is next point of removed one, <i - 1> is previous
+    if (i - 1 > 0) {
+      _points[i - 1].tolerance = std::max(error(i - 1), removed);
+    }
+    if (i + 1 < _points.size()) {
+      _points[i].tolerance = std::max(error(i), removed);
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::vector<point_t> _points;
+  unsigned _version = 0;
+};
+
+#endif // _CALC_TRAIL_STORE_H_
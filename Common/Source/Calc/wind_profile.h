@@ -0,0 +1,142 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   wind_profile.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _CALC_WIND_PROFILE_H_
+#define _CALC_WIND_PROFILE_H_
+
+#include "Math/Point2D.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * Wind measurements stored by fixed altitude bands.
+ *
+ * Each band hold a weighted sum of all measurements within `altitude_range`
+ * of its center, with the weights of the former measurement list :
+ *  - quality : quality / 5
+ *  - altitude : 2 / (d² + 1) - 1, d = altitude difference / altitude_range
+ *  - time : exponential decay, `half_life` is fitted on former time weight.
+ *
+ * Decay is applied lazily : both sums of a band are only scaled when a new
+ * measurement is added. Adding a measurement update the same number of bands
+ * whatever the number of measurements, reading a band is only a division.
+ *
+ * quality 6 is a wind set by pilot, it override older measurements until a
+ * newer one is added.
+ */
+class wind_profile final {
+ public:
+  using vector_t = Point2D<double>;
+
+  static constexpr double min_altitude = -1000.; // m
+  static constexpr double band_height = 100.;    // m
+  static constexpr size_t band_count = 171;      // up to 16000 m
+
+  static constexpr double altitude_range = 1000.; // m
+  static constexpr double time_range = 3600.;     // s
+  static constexpr double half_life = 240.;       // s
+
+  static constexpr int override_quality = 6;
+
+  void add(double time, const vector_t& wind, double altitude, int quality) {
+    const double quality_weight = std::min(5, quality) / 5.;
+    if (quality_weight <= 0.) {
+      return;
+    }
+
+    const size_t first = band_index(altitude - altitude_range);
+    const size_t last = band_index(altitude + altitude_range);
+    for (size_t i = first; i <= last; ++i) {
+      const double altitude_diff = (band_altitude(i) - altitude) / altitude_range;
+      if (std::fabs(altitude_diff) >= 1.) {
+        continue;
+      }
+      const double weight = quality_weight * (2. / (altitude_diff * altitude_diff + 1.) - 1.);
+
+      band_t& band = bands[i];
+      if (band.weight > 0. && time >= band.time
+              && quality != override_quality && !band.overridden) {
+        const double decay = decay_factor(time - band.time);
+        band.wind = band.wind * decay;
+        band.weight *= decay;
+      } else {
+        // first measurement, time goes backward, new override or first
+        // measurement after override
+        band.wind = {};
+        band.weight = 0.;
+      }
+      band.wind += wind * weight;
+      band.weight += weight;
+      band.time = time;
+      band.overridden = (quality == override_quality);
+    }
+  }
+
+  /**
+   * mean wind at <altitude>, linear interpolation between band centers.
+   * <found> is false if no measurement was added within `altitude_range`
+   * and `time_range`.
+   */
+  vector_t get(double time, double altitude, bool* found) const {
+    const double position = std::clamp((altitude - min_altitude) / band_height - 0.5,
+                                       0., static_cast<double>(band_count - 1));
+    const size_t index = std::min(static_cast<size_t>(position), band_count - 2);
+    const double ratio = position - index;
+
+    vector_t wind = {};
+    double weight = 0.;
+    for (size_t i : { index, index + 1 }) {
+      const band_t& band = bands[i];
+      if (band.weight > 0. && std::fabs(time - band.time) < time_range) {
+        const double factor = ((i == index) ? 1. - ratio : ratio) * decay_factor(std::fabs(time - band.time));
+        wind += band.wind * factor;
+        weight += band.weight * factor;
+      }
+    }
+
+    *found = (weight > 0.);
+    return (*found) ? wind / weight : vector_t{};
+  }
+
+  /**
+   * mean wind of band <index>, without interpolation.
+   */
+  vector_t get_band(size_t index, double time, bool* found) const {
+    const band_t& band = bands[std::min(index, band_count - 1)];
+    *found = band.weight > 0. && std::fabs(time - band.time) < time_range;
+    return (*found) ? band.wind / band.weight : vector_t{};
+  }
+
+  static size_t band_index(double altitude) {
+    const double index = std::floor((altitude - min_altitude) / band_height);
+    return std::clamp(index, 0., static_cast<double>(band_count - 1));
+  }
+
+  static double band_altitude(size_t index) {
+    return min_altitude + (index + 0.5) * band_height;
+  }
+
+ private:
+  static double decay_factor(double elapsed) {
+    return std::exp2(-elapsed / half_life);
+  }
+
+  struct band_t {
+    vector_t wind = {};  // sum of weighted measurements
+    double weight = 0.;  // sum of weights
+    double time = 0.;    // time of last measurement, both sums are decayed to this time
+    bool overridden = false;
+  };
+
+  std::array<band_t, band_count> bands = {};
+};
+
+#endif // _CALC_WIND_PROFILE_H_
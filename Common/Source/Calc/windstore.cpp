@@ -28,7 +28,7 @@ void WindStore::slot_measurement(NMEA_INFO *nmeaInfo,
                                  DERIVED_INFO *derivedInfo,
                                  Vector windvector, int quality){
   updated = true;
-  windlist.addMeasurement(nmeaInfo->Time, windvector, nmeaInfo->Altitude, quality);
+  windlist.add(nmeaInfo->Time, windvector, nmeaInfo->Altitude, quality);
   //we may have a new wind value, so make sure it's emitted if needed!
   recalculateWind(nmeaInfo, derivedInfo);
 }
@@ -54,7 +54,7 @@ void WindStore::slot_Altitude(NMEA_INFO *nmeaInfo,
 
 
 Vector WindStore::getWind(double Time, double h, bool *found) {
-  return windlist.getWind(Time, h, found);
+  return windlist.get(Time, h, found);
 }
 
 /** Recalculates the wind from the stored measurements.
@@ -63,7 +63,7 @@ Vector WindStore::getWind(double Time, double h, bool *found) {
 void WindStore::recalculateWind(NMEA_INFO *nmeaInfo,
                                 DERIVED_INFO *derivedInfo) {
   bool found;
-  Vector CurWind = windlist.getWind(nmeaInfo->Time,
+  Vector CurWind = windlist.get(nmeaInfo->Time,
                                     nmeaInfo->Altitude, &found);
 
   if (found) {
@@ -25,7 +25,7 @@ void FLARM_RefreshSlots(NMEA_INFO *pGPS) {
 	StartupStore(_T("... [CALC thread] RefreshSlots\n"));
 #endif
 
-	for (unsigned i = 0; i < FLARM_MAX_TRAFFIC; i++) {
+	for (unsigned i = 0; i < pGPS->FLARM_TrafficEnd; i++) {
 		if (pGPS->FLARM_Traffic[i].RadioId > 0) {
 
 			if ( pGPS->Time< pGPS->FLARM_Traffic[i].Time_Fix) {
@@ -116,6 +116,11 @@ void FLARM_RefreshSlots(NMEA_INFO *pGPS) {
 		} // ID >0
 	} // for all traffic
 
+	// keep empty slots out of snapshot copies
+	while (pGPS->FLARM_TrafficEnd > 0 && pGPS->FLARM_Traffic[pGPS->FLARM_TrafficEnd - 1].RadioId == 0) {
+		--pGPS->FLARM_TrafficEnd;
+	}
+
 #ifdef OWN_FLARM_TRACES
 	double Vario=0 ;
 
@@ -160,6 +165,8 @@ void FLARM_EmptySlot(NMEA_INFO *pGPS,int i) {
 #endif
 
 	if (i<0 || i>=FLARM_MAX_TRAFFIC) return;
+	pGPS->FLARM_SlotIndex.erase(pGPS->FLARM_Traffic[i].RadioId);
+	flarmCalculations.Remove(pGPS->FLARM_Traffic[i].RadioId);
 	pGPS->FLARM_Traffic[i].RadioId = 0;
 	pGPS->FLARM_Traffic[i].Name[0] = 0;
 	pGPS->FLARM_Traffic[i].Cn[0] = 0;
@@ -399,18 +406,27 @@ BOOL NMEAParser::PFLAU(const char *String, char **params, size_t nparams, NMEA_I
 
 
 
-int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
-{
+// rebuild RadioId index from slots content
+static void FLARM_RebuildSlotIndex(NMEA_INFO *pGPS) {
+	pGPS->FLARM_SlotIndex.clear();
 	for (unsigned i=0; i<FLARM_MAX_TRAFFIC; i++) {
-		// find position in existing slot
-		if (RadioId == pGPS->FLARM_Traffic[i].RadioId) {
-			//#ifdef DEBUG_LKT
-			//StartupStore(_T("... FindSlot ID=%lx found in slot %d\n"),Id,i);
-			//#endif
-			return i;
+		pGPS->FLARM_SlotIndex.insert(pGPS->FLARM_Traffic[i].RadioId, i);
+	}
+}
+
+// find existing slot or an empty one, without removing any traffic
+static int FLARM_FindSlotOrEmpty(NMEA_INFO *pGPS, uint32_t RadioId) {
+	// find position in existing slot
+	int slot = pGPS->FLARM_SlotIndex.find(RadioId);
+	if (slot >= 0) {
+		const uint32_t SlotId = pGPS->FLARM_Traffic[slot].RadioId;
+		if (SlotId == RadioId || SlotId == 0) {
+			return slot;
 		}
-		// find old empty slot
+		// slot was given to this id but never filled, and reused since.
+		pGPS->FLARM_SlotIndex.erase(RadioId);
 	}
+
 	// not found, so try to find an empty slot
 	for (unsigned i=0; i<FLARM_MAX_TRAFFIC; i++) {
 		if (pGPS->FLARM_Traffic[i].RadioId <=0 ) { // 100327 <= was ==
@@ -418,9 +434,23 @@ int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
 #ifdef DEBUG_LKT
 			StartupStore(_T("... FLARM ID=%lx assigned NEW SLOT=%d\n"),Id,i);
 #endif
+			if (pGPS->FLARM_SlotIndex.full()) {
+				// only possible with slots never filled by caller.
+				FLARM_RebuildSlotIndex(pGPS);
+			}
+			pGPS->FLARM_SlotIndex.insert(RadioId, i);
 			return i;
 		}
 	}
+	return -1;
+}
+
+static int FLARM_FindOrFreeSlot(NMEA_INFO *pGPS, uint32_t RadioId)
+{
+	int slot = FLARM_FindSlotOrEmpty(pGPS, RadioId);
+	if (slot >= 0) {
+		return slot;
+	}
 	// remove a zombie to make place
 	int toremove=-1;
 	for (unsigned i=0; i<FLARM_MAX_TRAFFIC; i++) {
@@ -444,6 +474,7 @@ int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
 		FLARM_DumpSlot(pGPS,toremove);
 		#endif
 		FLARM_EmptySlot(pGPS,toremove);
+		pGPS->FLARM_SlotIndex.insert(RadioId, toremove);
 		return toremove;
 	}
 	// remove a ghost to make place
@@ -470,6 +501,7 @@ int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
 		FLARM_DumpSlot(pGPS,toremove);
 #endif
 		FLARM_EmptySlot(pGPS,toremove);
+		pGPS->FLARM_SlotIndex.insert(RadioId, toremove);
 		return toremove;
 	}
 
@@ -480,6 +512,16 @@ int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
 	return -1;
 }
 
+int FLARM_FindSlot(NMEA_INFO *pGPS, uint32_t RadioId)
+{
+	const int slot = FLARM_FindOrFreeSlot(pGPS, RadioId);
+	if (slot >= 0 && static_cast<unsigned>(slot) >= pGPS->FLARM_TrafficEnd) {
+		// filled by caller; end is lowered by FLARM_RefreshSlots if never filled.
+		pGPS->FLARM_TrafficEnd = slot + 1;
+	}
+	return slot;
+}
+
 
 // calculate relative east and north projection to lat/lon
 void NMEAParser::UpdateFlarmScale( NMEA_INFO *pGPS) {
@@ -16,6 +16,7 @@ bool CommandResolution=false;
 extern unsigned short LcdSize, DpiSize;
 extern unsigned short ReferenceDpi;
 extern unsigned int CommandQuantization;
+extern unsigned SimTrafficLoad;
 
 //
 //  true,  continue normally
@@ -60,6 +61,8 @@ bool LK8000GetOpts(const TCHAR *MyCommandLine) {
           force terrain quantization=n\n\
  -sysop\n\
           start with sysop mode active\n\
+ -simtraffic=n\n\
+          simulator: add n synthetic traffic targets, example -simtraffic=500\n\
 \n");
 
   return false; 
@@ -229,6 +232,30 @@ bool LK8000GetOpts(const TCHAR *MyCommandLine) {
      }
   }
 
+  pC = _tcsstr(MyCommandLine, TEXT("-simtraffic="));
+  if (pC != NULL){
+     _tcscpy(mytext1,_T(""));
+     pC += strlen("-simtraffic=");
+     if (*pC == '"'){
+        pC++;
+        pCe = pC;
+        while (*pCe != '"' && *pCe != '\0') pCe++;
+     } else{
+        pCe = pC;
+        while (*pCe != ' ' && *pCe != '\0') pCe++;
+     }
+     if (pCe != NULL && pCe > pC) {
+        LK_tcsncpy(mytext1, pC, pCe-pC);
+        int s=_tcstol(mytext1, nullptr, 10);
+        if (s<0 || s>FLARM_MAX_TRAFFIC) {
+           StartupStore(_T(". CommandLine simtraffic=%d is out of range 0-%d%s"),s,FLARM_MAX_TRAFFIC,NEWLINE);
+        } else {
+           StartupStore(_T(". CommandLine simulated traffic load=%d %s"),s,NEWLINE);
+           SimTrafficLoad=s;
+        }
+     }
+  }
+
   return true;
 }
 
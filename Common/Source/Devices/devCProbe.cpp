@@ -428,8 +428,10 @@ void CDevCProbe::OnZeroDeltaPressClicked(WndButton* pWnd) {
 void CDevCProbe::Update(WndForm* pWnd) {
 	TCHAR Temp[50] = {0};
 
+	// too large for stack, and only used by this dialog
+	static NMEA_INFO _INFO;
 	LockFlightData();
-	NMEA_INFO _INFO = GPS_INFO;
+	CopyInfo(_INFO, GPS_INFO);
 	UnlockFlightData();
 
 	LockDeviceData();
@@ -9,6 +9,24 @@
 #include "Sideview.h"
 #include "Asset.hpp"
 
+namespace {
+
+/**
+ * points of <lsdata> merged to one bucket by pixel of graph width, drawing
+ * cost does not depend on flight duration.
+ */
+const std::vector<time_series::bucket_t>& GraphBuckets(const RECT& rc, const LeastSquares* lsdata) {
+  static std::vector<time_series::bucket_t> buckets;
+  lsdata->series.resample(std::max<int>(1, rc.right - rc.left - BORDER_X), buckets);
+  return buckets;
+}
+
+double BucketX(const time_series::bucket_t& bucket) {
+  return (bucket.x_first + bucket.x_last) / 2.;
+}
+
+} // namespace
+
 void Statistics::DrawLabel(LKSurface& Surface, const RECT& rc, const TCHAR *text,
 			   const double xv, const double yv) {
 
@@ -156,7 +174,6 @@ void Statistics::DrawLine(LKSurface& Surface, const RECT& rc,
 
 
 void Statistics::DrawBarChart(LKSurface& Surface, const RECT& rc, LeastSquares* lsdata) {
-  int i;
   LKColor Col;
   if (unscaled_x || unscaled_y) {
     return;
@@ -176,11 +193,12 @@ void Statistics::DrawBarChart(LKSurface& Surface, const RECT& rc, LeastSquares*
 
   int xmin, ymin, xmax, ymax;
 
-  for (i= 0; i<lsdata->sum_n; i++) {
-    xmin = (int)((i+1+0.2)*xscale)+rc.left+BORDER_X;
+  // x is sample number, a bucket is a bar covering all its samples.
+  for (const auto& bar : GraphBuckets(rc, lsdata)) {
+    xmin = (int)((bar.x_first+0.2)*xscale)+rc.left+BORDER_X;
     ymin = (int)((y_max-y_min)*yscale)+rc.top;
-    xmax = (int)((i+1+0.8)*xscale)+rc.left+BORDER_X;
-    ymax = (int)((y_max-lsdata->ystore[i])*yscale)+rc.top;
+    xmax = (int)((bar.x_last+0.8)*xscale)+rc.left+BORDER_X;
+    ymax = (int)((y_max-bar.y_mean())*yscale)+rc.top;
     Surface.Rectangle(xmin, ymin, xmax, ymax);
   }
 
@@ -193,19 +211,26 @@ void Statistics::DrawFilledLineGraph(LKSurface& Surface, const RECT& rc,
 				     LeastSquares* lsdata,
 				     const LKColor& color) {
 
+  const auto& buckets = GraphBuckets(rc, lsdata);
+  if (buckets.empty()) {
+    return;
+  }
+  const size_t n = buckets.size();
+
   static std::vector<RasterPoint> line;
-  line.resize(lsdata->sum_n + 3);
+  line.resize(n + 3);
 
-  for (int i=0; i<lsdata->sum_n; i++) {
-    line[i].x = ((lsdata->xstore[i]-x_min)*xscale)+rc.left+BORDER_X;
-    line[i].y = ((y_max-lsdata->ystore[i])*yscale)+rc.top;
+  // highest point of each pixel column, like the full resolution graph.
+  for (size_t i=0; i<n; i++) {
+    line[i].x = ((BucketX(buckets[i])-x_min)*xscale)+rc.left+BORDER_X;
+    line[i].y = ((y_max-buckets[i].y_max)*yscale)+rc.top;
   }
 
-  line[lsdata->sum_n].x = line[lsdata->sum_n - 1].x;
-  line[lsdata->sum_n].y = rc.bottom-BORDER_Y;
-  line[lsdata->sum_n+1].x = line[0].x;
-  line[lsdata->sum_n+1].y = rc.bottom-BORDER_Y;
-  line[lsdata->sum_n+2] = line[0];
+  line[n].x = line[n - 1].x;
+  line[n].y = rc.bottom-BORDER_Y;
+  line[n+1].x = line[0].x;
+  line[n+1].y = rc.bottom-BORDER_Y;
+  line[n+2] = line[0];
 
   Surface.Polygon(line.data(), line.size());
 }
@@ -217,11 +242,12 @@ void Statistics::DrawLineGraph(LKSurface& Surface, const RECT& rc, LeastSquares*
 
   POINT line[2];
 
-  for (int i=0; i<lsdata->sum_n-1; i++) {
-    line[0].x = (int)((lsdata->xstore[i]-x_min)*xscale)+rc.left+BORDER_X;
-    line[0].y = (int)((y_max-lsdata->ystore[i])*yscale)+rc.top;
-    line[1].x = (int)((lsdata->xstore[i+1]-x_min)*xscale)+rc.left+BORDER_X;
-    line[1].y = (int)((y_max-lsdata->ystore[i+1])*yscale)+rc.top;
+  const auto& buckets = GraphBuckets(rc, lsdata);
+  for (size_t i=0; i+1<buckets.size(); i++) {
+    line[0].x = (int)((BucketX(buckets[i])-x_min)*xscale)+rc.left+BORDER_X;
+    line[0].y = (int)((y_max-buckets[i].y_mean())*yscale)+rc.top;
+    line[1].x = (int)((BucketX(buckets[i+1])-x_min)*xscale)+rc.left+BORDER_X;
+    line[1].y = (int)((y_max-buckets[i+1].y_mean())*yscale)+rc.top;
 
     // STYLE_DASHGREEN
     // STYLE_MEDIUMBLACK
@@ -72,7 +72,7 @@ static bool snailchanged= false;
 static short configMode=0;  // current configuration mode, see above
 static short config_page[4]={0,0,0,0}; // remember last page we were using, for each profile
 
-#define NUMOFCONFIGPAGES 22 // total number of config pages including engineering
+#define NUMOFCONFIGPAGES 23 // total number of config pages including engineering
 #define NUMENGPAGES 1       // number of engineering hidden pages, part of NUMOFCONFIGPAGES
 #define FIRST_INFOBOX_PAGE 13 
 #define MAXNUMDEVICES 6     // A B C D E F
@@ -112,7 +112,8 @@ const ConfigPageNames_t ConfigPageNames[4][NUMOFCONFIGPAGES] = {
       /*18*/  { _T("frmWaypointEdit"),        _T("_@M25_"), false },  // "21 Waypoint Edit" 
       /*19*/  { _T("frmSpecials1"),           _T("_@M26_"), false },  // "22 System" 
       /*20*/  { _T("frmSpecials2"),           _T("_@M94_"), false },  // "23 Map Scale"
-      /*21*/  { _T("frmEngineering1"),        _T("24 Engineering Menu"), false },
+      /*21*/  { _T("frmAudioVario"),          _T("_@M2502_"), false },// "24 Audio Vario"
+      /*22*/  { _T("frmEngineering1"),        _T("25 Engineering Menu"), false },
     }, 
     { // config Pilot
       /*0 */  { _T("frmPilot"),                _T("_@M1785_"), false }, // pilot configuration
@@ -3171,13 +3172,69 @@ wp->RefreshDisplay();
 
   wp = pForm->FindByName<WndProperty>(TEXT("prpAndroidAudioVario"));
   if (wp) {
-#ifndef ANDROID
+#if !defined(ANDROID) && !defined(USE_ALSA)
     wp->SetVisible(false);
 #endif
     wp->GetDataField()->Set(EnableAudioVario);
     wp->RefreshDisplay();
   }
 
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftThreshold"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->Set(Units::ToVerticalSpeed(AudioVarioLiftThreshold));
+    wp->GetDataField()->SetUnits(Units::GetVerticalSpeedName());
+    wp->RefreshDisplay();
+  }
+
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioSinkThreshold"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->Set(Units::ToVerticalSpeed(AudioVarioSinkThreshold));
+    wp->GetDataField()->SetUnits(Units::GetVerticalSpeedName());
+    wp->RefreshDisplay();
+  }
+
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftToneLow"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->SetAsFloat(AudioVarioLiftToneLow);
+    wp->RefreshDisplay();
+  }
+
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftToneHigh"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->SetAsFloat(AudioVarioLiftToneHigh);
+    wp->RefreshDisplay();
+  }
+
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioSinkTone"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->SetAsFloat(AudioVarioSinkTone);
+    wp->RefreshDisplay();
+  }
+
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioVolume"));
+  if (wp) {
+#ifndef USE_ALSA
+    wp->SetVisible(false);
+#endif
+    wp->GetDataField()->SetAsFloat(AudioVarioVolume);
+    wp->RefreshDisplay();
+  }
+
   for (int i=0; i<4; i++) {
     for (int j=0; j<8; j++) {
       SetInfoBoxSelector(pForm, j, i);
@@ -4471,6 +4528,32 @@ int ival;
     }
   }
 
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftThreshold"));
+  if (wp) {
+    AudioVarioLiftThreshold = Units::FromVerticalSpeed(wp->GetDataField()->GetAsFloat());
+  }
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioSinkThreshold"));
+  if (wp) {
+    AudioVarioSinkThreshold = Units::FromVerticalSpeed(wp->GetDataField()->GetAsFloat());
+  }
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftToneLow"));
+  if (wp) {
+    AudioVarioLiftToneLow = wp->GetDataField()->GetAsInteger();
+  }
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioLiftToneHigh"));
+  if (wp) {
+    AudioVarioLiftToneHigh = wp->GetDataField()->GetAsInteger();
+  }
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioSinkTone"));
+  if (wp) {
+    AudioVarioSinkTone = wp->GetDataField()->GetAsInteger();
+  }
+  wp = pForm->FindByName<WndProperty>(TEXT("prpAudioVarioVolume"));
+  if (wp) {
+    AudioVarioVolume = wp->GetDataField()->GetAsInteger();
+  }
+  AudioVarioConfigure();
+
   UpdateAircraftConfig(pForm.get());
 
   int i,j;
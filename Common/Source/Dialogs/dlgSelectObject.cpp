@@ -18,8 +18,9 @@
 #include "dlgSelectObject.h"
 #include "utils/stringext.h"
 #include "Event/Key.h"
-#include "dlgSelectObject.h"
+#include "utils/name_search_index.h"
 #include <functional>
+#include <numeric>
 
 namespace {
 
@@ -121,7 +122,13 @@ void dlgSelectObject::ResetFilter(WndForm* pForm) {
 
 struct key_filter : public key_filter_interface {
 
-  key_filter(dlgSelectObject& _dlg) : dlg(_dlg) {}
+  key_filter(dlgSelectObject& _dlg) : dlg(_dlg) {
+    // array order is not changed while text entry dialog is open : index use array position as id.
+    for (const auto& object : dlg.GetArrayInfo()) {
+      index.add(object.Name());
+    }
+    index.build();
+  }
 
   constexpr static size_t npos = ObjectSelectInfo_t::npos;
 
@@ -141,21 +148,39 @@ struct key_filter : public key_filter_interface {
     best_match_idx = npos;
     key_list.clear();
 
-    if (!all_keys) {
-      match_count = 0;
-      size_t min_match_pos = npos;
-      for (size_t i = 0; i < array.size(); ++i) {
-        const ObjectSelectInfo_t& object = array[i];
-        size_t match_pos = object.MatchUpdate(filter, key_list);
-        if(match_pos < min_match_pos) {
-          min_match_pos = match_pos;
-          best_match_idx = i;
-        }
-        if(match_pos < array.size()) {
-          ++match_count;
-        }
+    if (all_keys) {
+      last_filter.clear();
+      return;
+    }
+
+    if (!last_filter.empty() && _tcsncmp(filter, last_filter.c_str(), last_filter.size()) == 0) {
+      // character added : only previous matches can still match.
+      std::swap(candidates, matches);
+    } else if (!index.candidates(filter, candidates)) {
+      // filter too short for index
+      candidates.resize(array.size());
+      std::iota(candidates.begin(), candidates.end(), 0);
+    }
+
+    matches.clear();
+    match_count = 0;
+    size_t min_match_pos = npos;
+    for (unsigned i : candidates) {
+      const ObjectSelectInfo_t& object = array[i];
+      size_t match_pos = object.MatchUpdate(filter, key_list);
+      if (match_pos == npos) {
+        continue;
+      }
+      matches.push_back(i);
+      if(match_pos < min_match_pos) {
+        min_match_pos = match_pos;
+        best_match_idx = i;
+      }
+      if(match_pos < array.size()) {
+        ++match_count;
       }
     }
+    last_filter = filter;
   }
 
   unsigned GetMatchCount() const override {
@@ -177,6 +202,12 @@ struct key_filter : public key_filter_interface {
   bool all_keys = true;
 
   dlgSelectObject& dlg;
+
+  name_search_index index;
+
+  tstring last_filter; // filter used to build `matches`
+  std::vector<unsigned> matches; // position of object matching `last_filter`, in ascending order
+  std::vector<unsigned> candidates;
 };
 
 
@@ -531,6 +562,21 @@ void dlgSelectObject::SetNameFilter(const TCHAR (&filter)[dlgSelectObject::NAMEF
 }
 
 
+void dlgSelectObject::SortNames() {
+  std::vector<ObjectSelectInfo_t*> sorted;
+  sorted.reserve(array_info.size());
+  for (auto& info : array_info) {
+    sorted.push_back(&info);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+    return _tcsicmp(a->Name(), b->Name()) < 0;
+  });
+  for (unsigned i = 0; i < sorted.size(); ++i) {
+    sorted[i]->NameOrder = i;
+  }
+}
+
+
 void dlgSelectObject::UpdateList() {
 
   auto begin = array_info.begin();
@@ -581,7 +627,7 @@ void dlgSelectObject::UpdateList() {
 
   std::sort(begin, end, [&](const auto &a, const auto &b) {
     if (!sort_by_distance || a.Distance == b.Distance) {
-      return _tcsicmp(a.Name(), b.Name()) < 0;
+      return a.NameOrder < b.NameOrder;
     }
     return a.Distance < b.Distance;
   });
@@ -605,6 +651,8 @@ int dlgSelectObject::DoModal() {
     return mrCancel;
   }
 
+  SortNames();
+
   AtScopeExit(&) {
       pWndList = nullptr; // to be sure this pointing will be null after pForm delete;
   };
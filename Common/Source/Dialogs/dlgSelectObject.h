@@ -64,6 +64,7 @@ struct ObjectSelectInfo_t {
   double Distance;
   double Direction;
   std::unique_ptr<ObjectAdaptor_t> object;
+  unsigned NameOrder = 0; // rank in list sorted by name, set by `dlgSelectObject::SortNames()`
 
   void Select() const {
     object->Select();
@@ -154,6 +155,9 @@ protected:
 
   virtual array_info_t PrepareData(const GeoPoint& position) = 0;
 
+  // sort by name only once, list is then sorted by `NameOrder`
+  void SortNames();
+
   void OnFilterDistance(DataField *Sender, DataField::DataAccessKind_t Mode);
   void OnFilterDirection(DataField *Sender, DataField::DataAccessKind_t Mode);
   void OnFilterType(DataField *Sender, DataField::DataAccessKind_t Mode);
@@ -125,20 +125,30 @@ protected:
   array_info_t PrepareData(const GeoPoint& position) override {
     array_info_t data;
     try {
-      data.reserve(WayPointList.size());
+      std::vector<size_t> index;
+      std::vector<GeoPoint> points;
+      index.reserve(WayPointList.size());
+      points.reserve(WayPointList.size());
 
       for (size_t i = 0; i < WayPointList.size(); ++i) {
-        WAYPOINT& Tp = WayPointList[i];
-        
+        const WAYPOINT& Tp = WayPointList[i];
         if(Tp.Latitude!=RESWP_INVALIDNUMBER) {
-          double direction = 0;
-          double distance = 0;
-          position.Reverse({Tp.Latitude, Tp.Longitude}, direction, distance);
-         
-          data.push_back({Units::ToDistance(distance), direction, std::make_unique<WaypointInfo_t>(i, Tp)});
+          index.push_back(i);
+          points.push_back({Tp.Latitude, Tp.Longitude});
         }
       }
 
+      // all distance and bearing in one batch
+      std::vector<double> distance(points.size());
+      std::vector<double> direction(points.size());
+      DistanceBearing(position, points.data(), points.size(), distance.data(), direction.data());
+
+      data.reserve(index.size());
+      for (size_t j = 0; j < index.size(); ++j) {
+        const size_t i = index[j];
+        data.push_back({Units::ToDistance(distance[j]), direction[j], std::make_unique<WaypointInfo_t>(i, WayPointList[i])});
+      }
+
     } catch (std::bad_alloc&) {
       OutOfMemory(_T(__FILE__),__LINE__);
     }
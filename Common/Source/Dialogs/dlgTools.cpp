@@ -68,6 +68,20 @@ static bool FormKeyDown(WndForm* pWnd, unsigned KeyCode){
 
 MsgReturn_t MessageBoxX(LPCTSTR lpText, LPCTSTR lpCaption, MsgType_t uType, bool wfullscreen){
 
+  if (!main_window) {
+    // no window ( headless replay ) : only log the message and answer negatively.
+    StartupStore(_T("... %s : %s"), lpCaption, lpText);
+    switch (uType) {
+      case mbYesNo:
+      case mbYesNoCancel:
+        return IdNo;
+      case mbOk:
+        return IdOk;
+      default:
+        return IdCancel;
+    }
+  }
+
   WndForm *wf=NULL;
   WndFrame *wText=NULL;
   int X, Y, Width, Height;
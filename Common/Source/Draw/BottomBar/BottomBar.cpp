@@ -57,6 +57,9 @@ unsigned bottom_bar::get_current_mode() {
 }
 
 void bottom_bar::refresh_layout(LKSurface& Surface, const PixelRect& rect) {
+  // fonts can have changed, text size must be measured again
+  _value_cache.reset();
+
 #ifdef USE_GDI
   _pTempSurface = nullptr;
 #endif
@@ -165,16 +168,12 @@ void bottom_bar::draw_fly_mode_data(LKSurface& Surface, MapWindow::Mode::TModeFl
 void bottom_bar::draw_lkvalues_data(LKSurface& Surface, unsigned box_num, short value_id,
                                     const TCHAR* custom_title) const {
   if (box_num < get_box_count()) {
-    TCHAR Value[LKSIZEBUFFERVALUE];
-    TCHAR Unit[LKSIZEBUFFERUNIT];
+    lk_value_cache::value_t& value = _value_cache.get(value_id, true);
+
     TCHAR Title[LKSIZEBUFFERTITLE];
-    DrawBmp_t Bmp = BmpNone;
+    _tcscpy(Title, custom_title ? custom_title : value.title);
 
-    bool valid = MapWindow::LKFormatValue(value_id, true, Value, Unit, Title, &Bmp);
-    if (custom_title) {
-      _tcscpy(Title, custom_title);
-    }
-    draw_box(Surface, box_num, Value, valid ? Unit : nullptr, Title, Bmp);
+    draw_box(Surface, box_num, value, Title);
   }
 }
 
@@ -293,10 +292,12 @@ static void CropString(TCHAR* String, unsigned max_char) {
 }
 
 /**
- * @Unit : if nullptr, amber color is used to draw the value.
+ * if value is not valid, amber color is used to draw the value and unit is not drawn.
  */
-void bottom_bar::draw_box(LKSurface& Surface, unsigned box_num, TCHAR* Value, TCHAR* Unit, TCHAR* Title,
-                          DrawBmp_t& Bmp) const {
+void bottom_bar::draw_box(LKSurface& Surface, unsigned box_num, lk_value_cache::value_t& value, TCHAR* Title) const {
+  const TCHAR* Value = value.value;
+  const TCHAR* Unit = value.valid ? value.unit : nullptr;
+
   PixelRect box_rect = {_rect.GetTopLeft(), _box_size};
   box_rect.Offset((box_num % _col_count) * _box_size.cx, (box_num / _col_count) * _box_size.cy +
           IBLSCALE(2));
@@ -308,7 +309,7 @@ void bottom_bar::draw_box(LKSurface& Surface, unsigned box_num, TCHAR* Value, TC
   MapWindow::LKWriteText(Surface, Title, box_center.x, box_rect.top + (_title_height / 2), WTMODE_NORMAL,
                          WTALIGN_CENTER, _text_color, false);
 
-  const LKIcon* pBmpTemp = MapWindow::GetDrawBmpIcon(Bmp);
+  const LKIcon* pBmpTemp = MapWindow::GetDrawBmpIcon(value.bmp_value);
   if (pBmpTemp) {
     // draw image horizonal centered
     PixelScalar Icon_size = _value_size.cy - NIBLSCALE(2);
@@ -322,7 +323,7 @@ void bottom_bar::draw_box(LKSurface& Surface, unsigned box_num, TCHAR* Value, TC
     MapWindow::LKWriteText(Surface, Value, box_center.x, value_y, WTMODE_NORMAL, WTALIGN_CENTER, value_color, false);
 
     if (Unit && !HideUnits) {
-      PixelSize value_size = Surface.GetTextSize(Value);
+      PixelSize value_size = value.value_size(Surface);
       Surface.SelectObject(LK8BottomBarUnitFont);
       MapWindow::LKWriteText(Surface, Unit, box_center.x + (value_size.cx / 2) + IBLSCALE(1), value_y, WTMODE_NORMAL,
                              WTALIGN_LEFT, _text_color, false);
@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "MapWindow.h"
+#include "Draw/LKValueCache.h"
 
 class LKSurface;
 
@@ -53,7 +54,7 @@ class bottom_bar final {
   void draw_sys_data(LKSurface& Surface) const;
   void draw_cus_data(LKSurface& Surface) const;
 
-  void draw_box(LKSurface& Surface, unsigned box_num, TCHAR* Value, TCHAR* Unit, TCHAR* Title, DrawBmp_t& Bmp) const;
+  void draw_box(LKSurface& Surface, unsigned box_num, lk_value_cache::value_t& value, TCHAR* Title) const;
 
   unsigned get_box_count() const { return _row_count * _col_count; }
 
@@ -70,6 +71,9 @@ class bottom_bar final {
 
   LKColor _text_color = {};  // set by `fill_background()`
 
+  // draw methods are const, formatted values are only a cache.
+  mutable lk_value_cache _value_cache;
+
 #ifdef USE_GDI
   // to fill transparent background
   std::unique_ptr<LKSurface> _pTempSurface;
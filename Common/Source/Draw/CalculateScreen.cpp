@@ -14,7 +14,6 @@
 using std::placeholders::_1;
 
 int MapWindow::iSnailNext=0;
-int MapWindow::iLongSnailNext=0;
 
 rectObj MapWindow::screenbounds_latlon;
 
@@ -199,7 +198,6 @@ ScreenProjection MapWindow::CalculateScreenPositions(const POINT& Orig, const RE
   if(TrailActive)
   {
     iSnailNext = SnailNext; 
-    iLongSnailNext = LongSnailNext; 
     // set this so that new data doesn't arrive between calculating
     // this and the screen updates
   }
@@ -11,6 +11,7 @@
 #include "LKInterface.h"
 #include "LKStyle.h"
 #include "NavFunctions.h"
+#include "Geographic/LocalFrame.h"
 // #define DEBUGCW 1
 
 bool CheckLandableReachableTerrainNew(NMEA_INFO *Basic, DERIVED_INFO *Calculated,
@@ -110,12 +111,14 @@ void MapWindow::LKCalculateWaypointReachable(const bool forced)
   int overtarg=GetOvertargetIndex();
   if (overtarg<0) overtarg=999999;
 
+  const LocalFrame frame({DrawInfo.Latitude, DrawInfo.Longitude});
+
   for(i=scanstart;i<scanend;i++) {
     // signed Overtgarget -1 becomes a very high number, casted unsigned
     if ( ( ((WayPointCalc[i].AltArriv[AltArrivMode] >=0)||(WayPointList[i].Visible)) && (WayPointCalc[i].IsLandable || (WayPointList[i].Style==STYLE_THERMAL))) 
 	|| WaypointInTask(i) || (i==(unsigned int)overtarg) ) {
 
-	DistanceBearing(DrawInfo.Latitude, DrawInfo.Longitude, WayPointList[i].Latitude, WayPointList[i].Longitude, 
+	frame.DistanceBearing({WayPointList[i].Latitude, WayPointList[i].Longitude},
 		&waypointDistance, &waypointBearing);
 
 	WayPointCalc[i].Distance=waypointDistance; 
@@ -167,10 +170,7 @@ void MapWindow::LKCalculateWaypointReachable(const bool forced)
 		numwpscanned++;
 		#endif
 
-		DistanceBearing(DrawInfo.Latitude, 
-                                DrawInfo.Longitude, 
-                                WayPointList[i].Latitude, 
-                                WayPointList[i].Longitude,
+		frame.DistanceBearing({WayPointList[i].Latitude, WayPointList[i].Longitude},
                                 &waypointDistance,
                                 &waypointBearing);
                
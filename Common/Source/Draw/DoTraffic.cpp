@@ -9,6 +9,9 @@
 #include "externs.h"
 #include "DoInits.h"
 #include "NavFunctions.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 
 //
@@ -22,9 +25,8 @@
 
 bool DoTraffic(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
 {
-   int i,k,l;
-   double bearing, distance, sortvalue;
-   double sortedValue[MAXTRAFFIC+1];
+   int i,k;
+   double sortvalue;
 
    static double lastRunTime=0;
 
@@ -72,30 +74,40 @@ bool DoTraffic(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
    //UnlockFlightData();
 
 
+   // collect active targets, then compute distance and bearing in one batch.
+   // static : too large for stack with FLARM_MAX_TRAFFIC targets, and like
+   // LKTraffic, only used by this function.
+   static int active[MAXTRAFFIC];
+   static GeoPoint position[MAXTRAFFIC];
+   static double distance[MAXTRAFFIC];
+   static double bearing[MAXTRAFFIC];
+
    LKNumTraffic=0;
    for (i=0; i<FLARM_MAX_TRAFFIC; i++) {
 	if (LKTraffic[i].RadioId <= 0) continue;
+	active[LKNumTraffic] = i;
+	position[LKNumTraffic] = { LKTraffic[i].Latitude, LKTraffic[i].Longitude };
 	LKNumTraffic++;
-	DistanceBearing(Basic->Latitude, Basic->Longitude, 
-		LKTraffic[i].Latitude, LKTraffic[i].Longitude,
-		&distance, &bearing);
-	LKTraffic[i].Distance=distance;
-	LKTraffic[i].Bearing=bearing;
    }
    if (LKNumTraffic<1) return true;
 
+   DistanceBearing({ Basic->Latitude, Basic->Longitude }, position, LKNumTraffic, distance, bearing);
+   for (k=0; k<LKNumTraffic; k++) {
+	LKTraffic[active[k]].Distance=distance[k];
+	LKTraffic[active[k]].Bearing=bearing[k];
+   }
+
    //
    // In RADAR multimap there is no traffic sorting
    //
    if (MapSpaceMode==MSM_MAPRADAR) return true;
 
    memset(LKSortedTraffic, -1, sizeof(LKSortedTraffic));
-   memset(sortedValue, -1, sizeof(sortedValue));
 
    // We know there is at least one traffic..
-   for (i=0; i<FLARM_MAX_TRAFFIC; i++) {
-
-	if ( LKTraffic[i].RadioId <= 0 ) continue;
+   static std::pair<double, int> sorted[MAXTRAFFIC];
+   for (k=0; k<LKNumTraffic; k++) {
+	i = active[k];
 
 	switch (SortedMode[MSM_TRAFFIC]) {
 		case 0:	
@@ -131,31 +143,17 @@ bool DoTraffic(NMEA_INFO *Basic, DERIVED_INFO *Calculated)
 			sortvalue=LKTraffic[i].Distance;
 			break;
 	}
+	sorted[k] = { sortvalue, i };
+   } // for k
+
+   // stable : equal values keep slot order, like the old insertion sort.
+   std::stable_sort(std::begin(sorted), std::next(sorted, LKNumTraffic), [](const auto& a, const auto& b) {
+	return a.first < b.first;
+   });
+   for (k=0; k<LKNumTraffic; k++) {
+	LKSortedTraffic[k] = sorted[k].second;
+   }
 
-	// MAXTRAFFIC is simply FLARM_MAX_TRAFFIC 
-	for (k=0; k< MAXTRAFFIC; k++)  {
-
-		// if new value is lower or index position is empty,  AND index position is not itself
-		// (just for safety, since it is not possible with traffic)
-		if ( ((sortvalue < sortedValue[k]) || (LKSortedTraffic[k]== -1))
-		&& (LKSortedTraffic[k] != i) )
-		{
-			// ok, got new lower value, put it into slot
-			for (l=MAXTRAFFIC-1; l>k; l--) {
-				if (l>0) {
-					sortedValue[l] = sortedValue[l-1];
-					LKSortedTraffic[l] = LKSortedTraffic[l-1];
-				}
-			}
-			sortedValue[k] = sortvalue;
-			LKSortedTraffic[k] = i;
-			//inserted++;
-			break;
-		}
-	} // for k
-	continue;
-
-   } // for i
    #ifdef DEBUG_LKT
    StartupStore(_T("... DoTraffic Sorted, LKNumTraffic=%d :\n"),LKNumTraffic);
    for (i=0; i<MAXTRAFFIC; i++) {
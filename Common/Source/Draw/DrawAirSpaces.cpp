@@ -11,6 +11,7 @@
 #include "Bitmaps.h"
 #include "RGB.h"
 #include "LKObjects.h"
+#include "Profiler.h"
 
 void MapWindow::ClearAirSpace(bool fill, const RECT& rc) {
 #ifndef ENABLE_OPENGL
@@ -153,6 +154,8 @@ void MapWindow::DrawAirSpacePattern(LKSurface& Surface, const RECT& rc)
 #endif
 
 void MapWindow::DrawAirSpace(LKSurface& Surface, const RECT& rc, const ScreenProjection& _Proj) {
+    const profiler::scoped_timer timer(profiler::probe::DrawAirSpace);
+
     CalculateScreenPositionsAirspace(rc, _Proj);
     
     if ((GetAirSpaceFillType() == asp_fill_ablend_full) || (GetAirSpaceFillType() == asp_fill_ablend_borders))
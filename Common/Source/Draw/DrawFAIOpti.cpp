@@ -20,6 +20,7 @@
 #include "Math/Point2D.hpp"
 #include "DrawFAIOpti.h"
 #include "Asset.hpp"
+#include "utils/frame_arena.h"
 
 //#define FAI_SECTOR_DEBUG
 #ifdef HAVE_GLES
@@ -143,8 +144,8 @@ if (IsDithered()) {
 const PixelRect ScreenRect(rc);
 const GeoToScreen<ScreenPoint> ToScreen(_Proj);
 
-typedef std::vector<ScreenPoint> polyline_t;
-polyline_t FAISector_polyline; // make it static for save memory Alloc/Free ( don't forget to clear in this case )
+typedef frame_vector<ScreenPoint> polyline_t;
+polyline_t FAISector_polyline(frame_allocator<ScreenPoint>(MapWindow::FrameArena())); // draw frame scratch memory, no heap Alloc/Free
 
   FAISector_polyline.reserve( (7.5*FAI_SECTOR_STEPS) + 1); // avoid memory realloc.
 // FAISector_polyline.clear();
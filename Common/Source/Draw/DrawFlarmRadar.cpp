@@ -9,6 +9,7 @@
 #include "RGB.h"
 #include "Sideview.h"
 #include "NavFunctions.h"
+#include "Geographic/LocalFrame.h"
 #include "LKObjects.h"
 #include "DoInits.h"
 #include "LKMapWindow.h"
@@ -1392,13 +1393,15 @@ if (iStep < 1)
   iStep = 1;
 iStep = 1;
 
+    const LocalFrame frame({GPSlat, GPSlon});
+
     PeriodClock StartTime;
     StartTime.Update();
 
 	for(i= 0; i < iTo; i=i+iStep)
 	{
 	  LKASSERT(iIdx>=0 && iIdx<MAX_FLARM_TRACES);
-      DistanceBearing( GPSlat, GPSlon, DrawInfo.FLARM_RingBuf[iIdx].fLat ,DrawInfo.FLARM_RingBuf[iIdx].fLon, &fFlarmDist, &fDistBearing);
+      frame.DistanceBearing({DrawInfo.FLARM_RingBuf[iIdx].fLat, DrawInfo.FLARM_RingBuf[iIdx].fLon}, &fFlarmDist, &fDistBearing);
 
 	  fDistBearing = ( fDistBearing - GPSbrg + RADAR_TURN);
 
@@ -0,0 +1,81 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   DrawProfilerHud.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "externs.h"
+#include "LKObjects.h"
+#include "RGB.h"
+#include "Profiler.h"
+
+/**
+ * Draw execution time of each profiler probe in top left corner of the map
+ *   name  count  mean  p95  max (ms)
+ * FrameAllocations is a number of heap allocations by frame, not a time.
+ */
+void MapWindow::DrawProfilerHud(LKSurface& Surface, const RECT& rc) {
+  if (!profiler::hud_enabled) {
+    return;
+  }
+
+  constexpr unsigned line_count = static_cast<unsigned>(profiler::probe::count) + 1;
+
+  const auto oldfont = Surface.SelectObject(LK8InfoSmallFont);
+  const int line_height = Surface.GetTextHeight(_T("X"));
+  const int column_width = Surface.GetTextWidth(_T("0000.0"));
+  const int name_width = Surface.GetTextWidth(_T("AudioVario "));
+  const int margin = IBLSCALE(2);
+
+  const RECT box = {
+    rc.left,
+    rc.top,
+    std::min<PixelScalar>(rc.right, rc.left + name_width + 4 * column_width + 2 * margin),
+    std::min<PixelScalar>(rc.bottom, rc.top + line_count * line_height + 2 * margin)
+  };
+  Surface.FillRect(&box, LKBrush_Black);
+
+  Surface.SetBackgroundTransparent();
+  const auto oldcolor = Surface.SetTextColor(RGB_WHITE);
+
+  int y = rc.top + margin;
+  const int x = rc.left + margin;
+
+  auto draw_line = [&](const TCHAR* name, const TCHAR* count, const TCHAR* mean, const TCHAR* p95, const TCHAR* max) {
+    Surface.DrawText(x, y, name);
+    int xc = x + name_width;
+    for (const TCHAR* value : { count, mean, p95, max }) {
+      xc += column_width;
+      Surface.DrawText(xc - Surface.GetTextWidth(value), y, value);
+    }
+    y += line_height;
+  };
+
+  draw_line(_T(""), _T("n"), _T("mean"), _T("p95"), _T("max"));
+
+  for (unsigned i = 0; i < static_cast<unsigned>(profiler::probe::count); ++i) {
+    const profiler::probe id = static_cast<profiler::probe>(i);
+    const profiler::stats_t stats = profiler::get_stats(id);
+
+    TCHAR count[16], mean[16], p95[16], max[16];
+    _stprintf(count, _T("%u"), stats.count);
+    if (id == profiler::probe::FrameAllocations) {
+      _stprintf(mean, _T("%u"), stats.mean);
+      _stprintf(p95, _T("%u"), stats.p95);
+      _stprintf(max, _T("%u"), stats.max);
+    } else {
+      _stprintf(mean, _T("%.1f"), stats.mean / 1000.);
+      _stprintf(p95, _T("%.1f"), stats.p95 / 1000.);
+      _stprintf(max, _T("%.1f"), stats.max / 1000.);
+    }
+
+    draw_line(profiler::name(id), count, mean, p95, max);
+  }
+
+  Surface.SetTextColor(oldcolor);
+  Surface.SelectObject(oldfont);
+}
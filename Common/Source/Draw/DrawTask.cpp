@@ -24,6 +24,7 @@ $Id$
 #include "LKObjects.h"
 #include "DrawFAIOpti.h"
 #include "../Calc/Task/task_zone.h"
+#include "utils/frame_arena.h"
 
 extern LKColor taskcolor;
 
@@ -343,10 +344,10 @@ void MapWindow::DrawTask(LKSurface& Surface, const RECT& rc, const ScreenProject
 	}
     
     // Build Polyline connecting Center
-    typedef std::vector<ScreenPoint> polyline_t;
+    typedef frame_vector<ScreenPoint> polyline_t;
     typedef std::array<ScreenPoint,2> line_t;
 
-    polyline_t task_polyline; // make it static for save memory Alloc/Free ( don't forget to clear in this case )
+    polyline_t task_polyline(frame_allocator<ScreenPoint>(MapWindow::FrameArena())); // draw frame scratch memory, no heap Alloc/Free
 
     for(unsigned i = 0; ValidTaskPointFast(i); ++i ) {
         const WAYPOINT& wpt = WayPointList[Task[i].Index];
@@ -20,47 +20,53 @@ typedef RasterPoint ScreenPoint;
 #endif
 
 void MapWindow::LKDrawLongTrail( LKSurface& Surface, const RECT& rc, const ScreenProjection& _Proj) {
-    static ScreenPoint snail_polyline[std::size(LongSnailTrail)+1]; // +1 for last point of "normal" snail trail
+    using long_trail_t = decltype(LongSnailTrail);
+
+    // ranked copy of long trail, updated when a point is added
+    static std::vector<long_trail_t::point_t> trail;
+    static unsigned trail_version = 0;
+
+    // screen points are only computed again if trail or projection change,
+    // first one is last point of "normal" snail trail
+    static std::vector<ScreenPoint> snail_polyline;
+    static ScreenProjection polyline_proj;
+    static bool polyline_valid = false;
 
     if (TrailActive != 3) return; // only when full trail is selected
-    if (iLongSnailNext < 2) return; // no reason to draw a single point
 
     if (MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING)) {
         return;
     }    
 
-    // pixel manhattan distance
-    // It is the sum of x and y differences between previous and next point on screen, in pixels.
-    // below this distance, no painting
-    const ScreenPoint::scalar_type nearby=10;
+    if (LongSnailTrail.copy(trail, trail_version)) {
+        long_trail_t::rank(trail);
+        polyline_valid = false;
+    }
+    if (trail.size() < 2) return; // no reason to draw a single point
 
-    const LONG_SNAIL_POINT* end_iterator = std::begin(LongSnailTrail);
-    const LONG_SNAIL_POINT* cur_iterator = std::prev(std::next(LongSnailTrail,iLongSnailNext));
-    ScreenPoint* polyline_iterator = std::begin(snail_polyline);
+    const GeoToScreen<ScreenPoint> ToScreen(_Proj);
+
+    if (!polyline_valid || polyline_proj != _Proj) {
+        // level of detail : skip points that move the trail less than 2 pixels
+        const float tolerance = 2 * _Proj.GetPixelSize();
+
+        snail_polyline.resize(1);
+        long_trail_t::for_each_visible(trail, tolerance, [&](const long_trail_t::point_t& pt) {
+            snail_polyline.push_back(ToScreen(pt.latitude, pt.longitude));
+        });
+        polyline_proj = _Proj;
+        polyline_valid = true;
+    }
 
     const SNAIL_POINT* last_point = std::next(std::next(SnailTrail, iSnailNext));
     if(last_point == std::end(SnailTrail)) {
         last_point = std::begin(SnailTrail);
     }
-
-    const GeoToScreen<ScreenPoint> ToScreen(_Proj);
-
-    (*polyline_iterator) = ToScreen(last_point->Latitude, last_point->Longitude);
-
-    polyline_iterator = std::next(polyline_iterator);
+    snail_polyline.front() = ToScreen(last_point->Latitude, last_point->Longitude);
 
     const auto oldPen = Surface.SelectObject(hSnailPens[3]); // blue color
 
-    while(cur_iterator != end_iterator) {
-
-        (*polyline_iterator) = ToScreen(cur_iterator->Latitude, cur_iterator->Longitude);
-
-        if(ManhattanDistance(*std::prev(polyline_iterator),(*polyline_iterator)) > nearby) {
-            polyline_iterator = std::next(polyline_iterator);
-        }
-        cur_iterator = std::prev(cur_iterator);
-    }
-    Surface.Polyline(snail_polyline, std::distance(snail_polyline, polyline_iterator) , rc);
+    Surface.Polyline(snail_polyline.data(), snail_polyline.size(), rc);
 
     Surface.SelectObject(oldPen);
 }
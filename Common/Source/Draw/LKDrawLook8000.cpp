@@ -22,6 +22,7 @@
 #include "Bitmaps.h"
 #include "Asset.hpp"
 #include "Library/TimeFunctions.h"
+#include "LKValueCache.h"
 #ifndef UNICODE
 #include "Util/UTF8.hpp"
 #endif
@@ -37,6 +38,9 @@
 
 namespace {
 
+// values are formatted only when data or settings have changed.
+lk_value_cache overlay_values;
+
 // For Overlay we use :  0       : Hidden
 //                       1       : Default
 //                       >= 1000 : Custom LKValue+1000
@@ -296,7 +300,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
     //
     // TARGET DISTANCE
     //
-    LKFormatValue(LK_START_DIST, false, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+    overlay_values.format(LK_START_DIST, false, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
     if (gateinuse >= -1) {
         // if we are still painting , it means we did not start yet..so we use colors
         if (!CorrectSide(DerivedDrawInfo)) {
@@ -391,7 +395,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             LKWriteText(Surface, BufferValue, rcx,rcy, WTMODE_OUTLINED,WTALIGN_RIGHT,color, true);
 
             // Req. Speed For reach Gate
-            if (LKFormatValue(LK_START_SPEED, false, BufferValue, BufferUnit, BufferTitle)) {
+            if (overlay_values.format(LK_START_SPEED, false, BufferValue, BufferUnit, BufferTitle)) {
                 Surface.SelectObject(LK8TargetFont);
                 Surface.GetTextSize(BufferUnit, &TextSize);
                 rcx -= TextSize.cx;
@@ -485,7 +489,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             bmpTitle = BmpNone;
             if (isOverlayHidden(Overlay_RightMid)) goto _skip_glider_RightMid;
             if (isOverlayCustom(Overlay_RightMid)) {
-                LKFormatValue(getCustomOverlay(Overlay_RightMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+                overlay_values.format(getCustomOverlay(Overlay_RightMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
             } else {
                 if (OverTargetIndex < 0) goto _skip_glider_RightMid;
                _tcscpy(BufferTitle, _T(""));
@@ -523,7 +527,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             bmpTitle = BmpNone;
             if (isOverlayCustom(Overlay_RightBottom))
             {                
-                LKFormatValue(getCustomOverlay(Overlay_RightBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+                overlay_values.format(getCustomOverlay(Overlay_RightBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
             } else {
               if (OverTargetIndex < 0)  goto _skip_glider_RightBottom;
               _tcscpy(BufferTitle, _T(""));
@@ -567,12 +571,12 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             bmpValue = BmpNone;
             bmpTitle = BmpNone;
             if (isOverlayCustom(Overlay_RightMid))
-                LKFormatValue(getCustomOverlay(Overlay_RightMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+                overlay_values.format(getCustomOverlay(Overlay_RightMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
             else {
                 if (MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING))
-                    LKFormatValue(LK_TC_30S, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_TC_30S, false, BufferValue, BufferUnit, BufferTitle);
                 else
-                    LKFormatValue(LK_LD_AVR, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_LD_AVR, false, BufferValue, BufferUnit, BufferTitle);
             }
 
             rcy = yrightoffset - SizeBigFont.cy;
@@ -605,7 +609,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             bmpValue = BmpNone;
             bmpTitle = BmpNone;
             if (isOverlayCustom(Overlay_RightBottom)) {
-                LKFormatValue(getCustomOverlay(Overlay_RightBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+                overlay_values.format(getCustomOverlay(Overlay_RightBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
             } else {
                 if (OverTargetIndex < 0) goto _skip_para_RightBottom;
                 LKFormatAltDiff(OverTargetIndex, BufferValue, BufferUnit);
@@ -654,11 +658,11 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
             bmpTitle = BmpNone;
             Surface.SelectObject(LK8OverlayBigFont);
             if (isOverlayCustom(Overlay_RightTop)) {
-              LKFormatValue(getCustomOverlay(Overlay_RightTop), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+              overlay_values.format(getCustomOverlay(Overlay_RightTop), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
               right_m = rightmargin;
             }
             else
-                LKFormatValue(LK_MC, false, BufferValue, BufferUnit, BufferTitle);
+                overlay_values.format(LK_MC, false, BufferValue, BufferUnit, BufferTitle);
 
             if (!HideUnits) {    
                 Surface.SelectObject(MapScaleFont);
@@ -738,15 +742,15 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
         bmpValue = BmpNone;
         bmpTitle = BmpNone;
         if (isOverlayCustom(Overlay_LeftTop))
-            LKFormatValue(getCustomOverlay(Overlay_LeftTop), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+            overlay_values.format(getCustomOverlay(Overlay_LeftTop), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
         else {
             if (ISPARAGLIDER) {
-                LKFormatValue(LK_HNAV, false, BufferValue, BufferUnit, BufferTitle); // 091115
+                overlay_values.format(LK_HNAV, false, BufferValue, BufferUnit, BufferTitle); // 091115
             } else {
                 if (MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING))
-                    LKFormatValue(LK_TC_30S, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_TC_30S, false, BufferValue, BufferUnit, BufferTitle);
                 else
-                    LKFormatValue(LK_LD_AVR, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_LD_AVR, false, BufferValue, BufferUnit, BufferTitle);
             }
         }
 
@@ -773,19 +777,19 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
         bmpValue = BmpNone;
         bmpTitle = BmpNone;
         if (isOverlayCustom(Overlay_LeftMid)) {
-            LKFormatValue(getCustomOverlay(Overlay_LeftMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+            overlay_values.format(getCustomOverlay(Overlay_LeftMid), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
         } else {
             if (MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING) || LKVarioVal == vValVarioVario) {
-                LKFormatValue(LK_VARIO, false, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+                overlay_values.format(LK_VARIO, false, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
             } else {
                 switch (LKVarioVal) {
                     case vValVarioNetto:
-                        LKFormatValue(LK_NETTO, false, BufferValue, BufferUnit, BufferTitle);
+                        overlay_values.format(LK_NETTO, false, BufferValue, BufferUnit, BufferTitle);
                         _tcscpy(BufferUnit, _T("NT"));
                         break;
                     case vValVarioSoll:
                     default:
-                        LKFormatValue(LK_SPEED_DOLPHIN, false, BufferValue, BufferUnit, BufferTitle);
+                        overlay_values.format(LK_SPEED_DOLPHIN, false, BufferValue, BufferUnit, BufferTitle);
                         _tcscpy(BufferUnit, _T("SF"));
                         break;
                 }
@@ -817,15 +821,15 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
         bmpValue = BmpNone;
         bmpTitle = BmpNone;
         if (isOverlayCustom(Overlay_LeftBottom))
-            LKFormatValue(getCustomOverlay(Overlay_LeftBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+            overlay_values.format(getCustomOverlay(Overlay_LeftBottom), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
         else {
             if (ISPARAGLIDER) {
-                LKFormatValue(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
+                overlay_values.format(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
             } else {
                 if (MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING)) {
-                    LKFormatValue(LK_HNAV, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_HNAV, false, BufferValue, BufferUnit, BufferTitle);
                 } else {
-                    LKFormatValue(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
+                    overlay_values.format(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
                 }
             }
         }
@@ -849,7 +853,7 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
     // CLOCK
     //
     if ((OverlayClock && Overlay_TopRight) || ((gTaskType==TSK_GP) && UseGates())) {
-        LKFormatValue(LK_TIME_LOCALSEC, false, BufferValue, BufferUnit, BufferTitle);
+        overlay_values.format(LK_TIME_LOCALSEC, false, BufferValue, BufferUnit, BufferTitle);
         Surface.SelectObject(LK8OverlayMediumFont);
         int cx,cy;
         if (!ScreenLandscape) {
@@ -875,12 +879,12 @@ void MapWindow::DrawLook8000(LKSurface& Surface, const RECT& rc) {
         bmpTitle = BmpNone;
         Surface.SelectObject(LK8OverlayMediumFont);
         if (isOverlayCustom(Overlay_LeftDown)) {
-            LKFormatValue(getCustomOverlay(Overlay_LeftDown), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
+            overlay_values.format(getCustomOverlay(Overlay_LeftDown), true, BufferValue, BufferUnit, BufferTitle,&bmpValue,&bmpTitle);
         } else {
             if (ISCAR || ISGAAIRCRAFT)
-                LKFormatValue(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
+                overlay_values.format(LK_GNDSPEED, false, BufferValue, BufferUnit, BufferTitle);
             else
-                LKFormatValue(LK_WIND, false, BufferValue, BufferUnit, BufferTitle);
+                overlay_values.format(LK_WIND, false, BufferValue, BufferUnit, BufferTitle);
         }
         LKWriteText(Surface, BufferValue, leftmargin, yLeftWind,
             WTMODE_OUTLINED, WTALIGN_LEFT, OverColorRef, true);
@@ -9,6 +9,7 @@
 
 #include "externs.h"
 #include "ScreenProjection.h"
+#include "polyline_buckets.h"
 
 
 #ifdef HAVE_GLES
@@ -23,7 +24,9 @@ typedef RasterPoint ScreenPoint;
 void MapWindow::LKDrawTrail(LKSurface& Surface, const RECT& rc, const ScreenProjection& _Proj) {
 
     static ScreenPoint snail_polyline[std::size(SnailTrail)];
-    
+    static unsigned short snail_colour[std::size(SnailTrail)];
+    static polyline_buckets<NUMSNAILCOLORS+1> buckets;
+
     if (!TrailActive) return;
 
     const double display_time = DrawInfo.Time;
@@ -53,15 +56,7 @@ void MapWindow::LKDrawTrail(LKSurface& Surface, const RECT& rc, const ScreenProj
     } else {
         cur_iterator = std::prev(std::end(SnailTrail));
     }
-        
-    ScreenPoint* polyline_iterator = &snail_polyline[0];
 
-    unsigned short prev_color = 15; // fixed pen for low zoom snail trail
-    if(use_colors) {
-        prev_color = cur_iterator->Colour;
-    }
-    Surface.SelectObject(hSnailPens[prev_color]);
-    
     const bool trail_is_drifted = (EnableTrailDrift && MapWindow::mode.Is(MapWindow::Mode::MODE_CIRCLING) && DerivedDrawInfo.WindSpeed >= 1);
     
     double traildrift_lat = 0;
@@ -78,6 +73,7 @@ void MapWindow::LKDrawTrail(LKSurface& Surface, const RECT& rc, const ScreenProj
 
     const GeoToScreen<ScreenPoint> ToScreen(_Proj);
 
+    unsigned count = 0;
     while( (num_trail_max--) > 0 &&  cur_iterator->Time && cur_iterator != end_iterator) {
         
         double this_lat = cur_iterator->Latitude;
@@ -87,28 +83,25 @@ void MapWindow::LKDrawTrail(LKSurface& Surface, const RECT& rc, const ScreenProj
             this_lat += traildrift_lat * dt;
             this_lon += traildrift_lon * dt;
         }
-        
-        (*polyline_iterator) = ToScreen(this_lat, this_lon);
-
-        if(use_colors && prev_color != cur_iterator->Colour) {
-            // draw polyline before change color.
-            Surface.Polyline(snail_polyline, std::distance(snail_polyline, polyline_iterator)+1 , rc);
-            // reset polyline
-            snail_polyline[0] = *polyline_iterator;
-            polyline_iterator = &snail_polyline[1];
-            
-            // select new Color
-            prev_color = cur_iterator->Colour;
-            Surface.SelectObject(hSnailPens[prev_color]);
-        } else {
-            polyline_iterator = std::next(polyline_iterator);
-        } 
-        
+
+        snail_polyline[count] = ToScreen(this_lat, this_lon);
+        // colour of segment to next point
+        snail_colour[count] = use_colors ? cur_iterator->Colour : 15; // fixed pen for low zoom snail trail
+        ++count;
+
         if(cur_iterator == std::begin(SnailTrail)) {
             cur_iterator = std::end(SnailTrail);
         } 
         cur_iterator = std::prev(cur_iterator);
     }
-    Surface.Polyline(snail_polyline, std::distance(snail_polyline, polyline_iterator) , rc);
-}
 
+    // one pen selection and one draw call for all segments of same colour.
+    buckets.build(snail_colour, count);
+
+    const auto oldPen = Surface.SelectObject(hSnailPens[15]);
+    buckets.for_each([&](unsigned colour, const unsigned* firsts, const unsigned* counts, unsigned size) {
+        Surface.SelectObject(hSnailPens[colour]);
+        Surface.Polylines(snail_polyline, firsts, counts, size, rc);
+    });
+    Surface.SelectObject(oldPen);
+}
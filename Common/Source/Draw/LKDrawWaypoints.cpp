@@ -21,6 +21,7 @@
 #include "Asset.hpp"
 #include "utils/array_adaptor.h"
 #include "Screen/Point.hpp"
+#include "Profiler.h"
 
 namespace {
 
@@ -248,6 +249,8 @@ namespace {
 
 
 void MapWindow::DrawWaypointsNew(LKSurface& Surface, const RECT& rc, const ScreenProjection& _Proj) {
+	const profiler::scoped_timer timer(profiler::probe::DrawWaypoints);
+
 	int bestwp=-1;
 	TCHAR Buffer[LKSIZEBUFFER];
 	TCHAR Buffer2[NAME_SIZE+1]; // size must be > size of waypoint name or waypoint code or max of resizer values
@@ -0,0 +1,88 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LKValueCache.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "externs.h"
+#include "LKValueCache.h"
+#include "Screen/LKSurface.h"
+
+std::atomic<unsigned> lk_value_cache::data_version = {};
+
+namespace {
+
+// clock, battery, cpu load ... are not tracked.
+constexpr unsigned max_value_age = 1000; // ms
+
+} // namespace
+
+lk_value_cache::settings_t lk_value_cache::settings_t::current() {
+  return {
+    MACCREADY,
+    BUGS,
+    BALLAST,
+    ActiveTaskPoint,
+    ActiveAlternate,
+    AltArrivMode
+  };
+}
+
+bool lk_value_cache::settings_t::operator==(const settings_t& other) const {
+  return mac_cready == other.mac_cready
+      && bugs == other.bugs
+      && ballast == other.ballast
+      && active_task_point == other.active_task_point
+      && active_alternate == other.active_alternate
+      && alt_arriv_mode == other.alt_arriv_mode;
+}
+
+lk_value_cache::value_t& lk_value_cache::get(short lkindex, bool lktitle) {
+  const unsigned key = (static_cast<unsigned short>(lkindex) << 1) | (lktitle ? 1 : 0);
+  const unsigned version = data_version;
+  const settings_t settings = settings_t::current();
+
+  auto [it, inserted] = _values.try_emplace(key);
+  entry_t& entry = it->second;
+  if (inserted || entry.version != version || entry.settings != settings || entry.time.Check(max_value_age)) {
+    value_t& value = entry.value;
+    value.bmp_value = BmpNone;
+    value.bmp_title = BmpNone;
+    value.valid = MapWindow::LKFormatValue(lkindex, lktitle, value.value, value.unit, value.title,
+                                           &value.bmp_value, &value.bmp_title);
+    entry.version = version;
+    entry.settings = settings;
+    entry.time.Update();
+    value._value_size.reset();
+  }
+  return entry.value;
+}
+
+bool lk_value_cache::format(short lkindex, bool lktitle,
+                            TCHAR (&BufferValue)[LKSIZEBUFFERVALUE],
+                            TCHAR (&BufferUnit)[LKSIZEBUFFERUNIT],
+                            TCHAR (&BufferTitle)[LKSIZEBUFFERTITLE],
+                            DrawBmp_t* BmpValue, DrawBmp_t* BmpTitle) {
+  const value_t& value = get(lkindex, lktitle);
+  std::copy(std::begin(value.value), std::end(value.value), BufferValue);
+  std::copy(std::begin(value.unit), std::end(value.unit), BufferUnit);
+  std::copy(std::begin(value.title), std::end(value.title), BufferTitle);
+  if (BmpValue) {
+    *BmpValue = value.bmp_value;
+  }
+  if (BmpTitle) {
+    *BmpTitle = value.bmp_title;
+  }
+  return value.valid;
+}
+
+PixelSize lk_value_cache::value_t::value_size(LKSurface& Surface) {
+  if (!_value_size) {
+    _value_size = Surface.GetTextSize(value);
+  }
+  return *_value_size;
+}
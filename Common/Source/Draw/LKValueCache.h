@@ -0,0 +1,124 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LKValueCache.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _Draw_LKValueCache_h_
+#define _Draw_LKValueCache_h_
+
+#include "Defines.h"
+#include "Enums.h"
+#include "Screen/Point.hpp"
+#include "Time/PeriodClock.hpp"
+#include <tchar.h>
+#include <atomic>
+#include <optional>
+#include <unordered_map>
+
+class LKSurface;
+
+/**
+ * Formatted values of `MapWindow::LKFormatValue()`, keyed by `lkindex`.
+ *
+ * Values are computed from draw snapshot ( DrawInfo / DerivedDrawInfo ), a
+ * few settings and a lot of globals. Snapshot changes are tracked by a data
+ * version, incremented by `MapWindow::UpdateInfo()` only if snapshot content
+ * has changed, settings by `invalidate()` ( `SettingsLeave()` ) and by a
+ * fingerprint of settings changed in flight ( MacCready, bugs, task ...).
+ *
+ * Other inputs (clock, battery, cpu load ...) are not tracked : in any case,
+ * a value is formatted again after `max_value_age`.
+ *
+ * Not thread safe, each instance must be used by draw thread only.
+ */
+class lk_value_cache final {
+ public:
+  struct value_t {
+    TCHAR value[LKSIZEBUFFERVALUE];
+    TCHAR unit[LKSIZEBUFFERUNIT];
+    TCHAR title[LKSIZEBUFFERTITLE];
+    DrawBmp_t bmp_value;
+    DrawBmp_t bmp_title;
+    bool valid; // LKFormatValue() result
+
+    /**
+     * text size of `value` with the font selected into <Surface>, memoized
+     * until value change : caller must always use the same font.
+     */
+    PixelSize value_size(LKSurface& Surface);
+
+   private:
+    friend class lk_value_cache;
+    std::optional<PixelSize> _value_size;
+  };
+
+  lk_value_cache() = default;
+
+  lk_value_cache(const lk_value_cache&) = delete;
+  lk_value_cache& operator=(const lk_value_cache&) = delete;
+
+  /**
+   * thread safe, can be called from any thread.
+   */
+  static void invalidate() {
+    ++data_version;
+  }
+
+  /**
+   * @return formatted value, `MapWindow::LKFormatValue()` is called only if
+   *   value is missing or outdated.
+   */
+  value_t& get(short lkindex, bool lktitle);
+
+  /**
+   * same as `MapWindow::LKFormatValue()`, buffers are copied from cache.
+   */
+  bool format(short lkindex, bool lktitle,
+              TCHAR (&BufferValue)[LKSIZEBUFFERVALUE],
+              TCHAR (&BufferUnit)[LKSIZEBUFFERUNIT],
+              TCHAR (&BufferTitle)[LKSIZEBUFFERTITLE],
+              DrawBmp_t* BmpValue = nullptr, DrawBmp_t* BmpTitle = nullptr);
+
+  /**
+   * drop all values, must be called when font or layout change.
+   */
+  void reset() {
+    _values.clear();
+  }
+
+ private:
+  // settings changed in flight without `SettingsLeave()`
+  struct settings_t {
+    double mac_cready;
+    double bugs;
+    double ballast;
+    int active_task_point;
+    int active_alternate;
+    short alt_arriv_mode;
+
+    static settings_t current();
+
+    bool operator==(const settings_t& other) const;
+    bool operator!=(const settings_t& other) const {
+      return !(*this == other);
+    }
+  };
+
+  struct entry_t {
+    value_t value;
+    unsigned version;
+    settings_t settings;
+    PeriodClock time;
+  };
+
+  static std::atomic<unsigned> data_version;
+
+  std::unordered_map<unsigned, entry_t> _values;
+};
+
+#endif  // _Draw_LKValueCache_h_
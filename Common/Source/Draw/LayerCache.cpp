@@ -0,0 +1,119 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LayerCache.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "externs.h"
+#include "LayerCache.h"
+#include "Multimap.h"
+
+std::array<std::atomic<unsigned>, layer_cache::layer_count> layer_cache::data_version = {};
+
+#ifndef ENABLE_OPENGL
+
+namespace {
+
+// some rendering inputs are not tracked (declutter, topology labels ...) :
+// in any case, cache is refreshed after this delay.
+constexpr unsigned max_cache_age = 5000; // ms
+
+} // namespace
+
+layer_cache::settings_t layer_cache::settings_t::current(const PixelRect& rect, const PixelRect& draw_rect, bool terrain_enabled) {
+  return {
+    rect,
+    draw_rect,
+    terrain_enabled,
+    IsMultimapTopology(),
+    BgMapColor,
+    TerrainContrast,
+    TerrainBrightness,
+    TerrainRamp,
+    Shading,
+    TerrainWhiteness,
+    AutoContrast,
+    IsoLine_Config
+  };
+}
+
+bool layer_cache::settings_t::operator==(const settings_t& other) const {
+  return rect == other.rect
+      && draw_rect == other.draw_rect
+      && terrain_enabled == other.terrain_enabled
+      && topology_enabled == other.topology_enabled
+      && bg_map_color == other.bg_map_color
+      && terrain_contrast == other.terrain_contrast
+      && terrain_brightness == other.terrain_brightness
+      && terrain_ramp == other.terrain_ramp
+      && shading == other.shading
+      && terrain_whiteness == other.terrain_whiteness
+      && auto_contrast == other.auto_contrast
+      && isoline == other.isoline;
+}
+
+layer_cache::version_array layer_cache::current_version() {
+  version_array version;
+  for (unsigned i = 0; i < layer_count; ++i) {
+    version[i] = data_version[i];
+  }
+  return version;
+}
+
+bool layer_cache::up_to_date(const ScreenProjection& _Proj, const settings_t& settings) const {
+  if (!_projection || !_stored_time.IsDefined() || _stored_time.Check(max_cache_age)) {
+    return false;
+  }
+  if (_settings != settings || _version != current_version()) {
+    return false;
+  }
+  // projection is same if aircraft has moved less than one pixel
+  return !(*_projection != _Proj);
+}
+
+bool layer_cache::restore(LKSurface& Surface, const ScreenProjection& _Proj, const settings_t& settings) {
+  if (!up_to_date(_Proj, settings)) {
+    // data version must be read before rendering, a change while rendering only invalidate next frame.
+    _pending_version = current_version();
+    return false;
+  }
+  const PixelRect& rc = _settings.rect;
+  const PixelSize size = rc.GetSize();
+  Surface.Copy(rc.left, rc.top, size.cx, size.cy, _surface, 0, 0);
+  return true;
+}
+
+void layer_cache::store(LKSurface& Surface, const ScreenProjection& _Proj, const settings_t& settings, bool terrain_painted) {
+  const PixelRect& rc = settings.rect;
+  const PixelSize size = rc.GetSize();
+  if (size.cx <= 0 || size.cy <= 0) {
+    reset();
+    return;
+  }
+
+  if (size != _surface_size) {
+    _surface.Release();
+    _surface.Create(Surface, size.cx, size.cy);
+    _surface_size = size;
+  }
+  _surface.Copy(0, 0, size.cx, size.cy, Surface, rc.left, rc.top);
+
+  _projection = _Proj;
+  _settings = settings;
+  _version = _pending_version;
+  _terrain_painted = terrain_painted;
+  _stored_time.Update();
+}
+
+void layer_cache::reset() {
+  _projection.reset();
+  _stored_time.Reset();
+  _surface.Release();
+  _surface_size = {};
+}
+
+#endif // !ENABLE_OPENGL
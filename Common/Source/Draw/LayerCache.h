@@ -0,0 +1,141 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LayerCache.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _Draw_LayerCache_h_
+#define _Draw_LayerCache_h_
+
+#include "Screen/Point.hpp"
+#include "Screen/LKBitmapSurface.h"
+#include "Time/PeriodClock.hpp"
+#include "ScreenProjection.h"
+#include <atomic>
+#include <array>
+#include <optional>
+
+/**
+ * Offscreen copy of the static map layers (terrain and topology).
+ *
+ * Those layers only depend on screen projection, on a few settings and on
+ * their own data. As long as none of them change, the cached bitmap is copied
+ * to the draw surface instead of rendering them again, and only the dynamic
+ * overlays (airspaces, task, trail, traffic, aircraft ...) are drawn on top.
+ *
+ * Each layer has a data version, incremented by `invalidate()` every time
+ * the layer content change ( topology cache update, terrain reload ...),
+ * a layer is dirty if its version differs from the version used to fill the cache.
+ *
+ * Only used by memory canvas and GDI renderer : with OpenGL, map is rendered
+ * inside BackBuffer FBO and BufferCanvas can't be nested.
+ */
+class layer_cache final {
+ public:
+  enum layer_t {
+    terrain,
+    topology,
+    layer_count
+  };
+
+  layer_cache() = default;
+
+  layer_cache(const layer_cache&) = delete;
+  layer_cache& operator=(const layer_cache&) = delete;
+
+  /**
+   * thread safe, can be called from any thread.
+   */
+  static void invalidate(layer_t layer) {
+    ++data_version[layer];
+  }
+
+  static void invalidate_all() {
+    for (auto& version : data_version) {
+      ++version;
+    }
+  }
+
+  /**
+   * current data version of <layer>, for other caches of the same data.
+   */
+  static unsigned version(layer_t layer) {
+    return data_version[layer];
+  }
+
+#ifndef ENABLE_OPENGL
+  /**
+   * everything but data version and projection that change rendering of static layers.
+   */
+  struct settings_t {
+    PixelRect rect; // cached area
+    PixelRect draw_rect; // terrain and topology area
+    bool terrain_enabled;
+    bool topology_enabled;
+    short bg_map_color;
+    short terrain_contrast;
+    short terrain_brightness;
+    short terrain_ramp;
+    short shading;
+    double terrain_whiteness;
+    bool auto_contrast;
+    bool isoline;
+
+    static settings_t current(const PixelRect& rect, const PixelRect& draw_rect, bool terrain_enabled);
+
+    bool operator==(const settings_t& other) const;
+    bool operator!=(const settings_t& other) const {
+      return !(*this == other);
+    }
+  };
+
+  /**
+   * copy cached layers to <Surface> if cache is up to date.
+   * @return false if static layers need to be rendered.
+   */
+  bool restore(LKSurface& Surface, const ScreenProjection& _Proj, const settings_t& settings);
+
+  /**
+   * copy static layers rendered on <Surface> to the cache.
+   * must be called after `restore()` has returned false.
+   */
+  void store(LKSurface& Surface, const ScreenProjection& _Proj, const settings_t& settings, bool terrain_painted);
+
+  /**
+   * mark cache as invalid and release bitmap memory.
+   */
+  void reset();
+
+  bool terrain_painted() const {
+    return _terrain_painted;
+  }
+#endif
+
+ private:
+  using version_array = std::array<unsigned, layer_count>;
+
+  static std::array<std::atomic<unsigned>, layer_count> data_version;
+
+#ifndef ENABLE_OPENGL
+  static version_array current_version();
+
+  bool up_to_date(const ScreenProjection& _Proj, const settings_t& settings) const;
+
+  LKBitmapSurface _surface;
+  PixelSize _surface_size = {};
+
+  std::optional<ScreenProjection> _projection;
+  settings_t _settings = {};
+  version_array _version = {};
+  version_array _pending_version = {};
+  bool _terrain_painted = false;
+
+  PeriodClock _stored_time;
+#endif
+};
+
+#endif  // _Draw_LayerCache_h_
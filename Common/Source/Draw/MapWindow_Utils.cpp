@@ -150,19 +150,6 @@ _normal_run:
   oldzoomscale=MapWindow::zoom.Scale();
 #endif // DEBOUNCE_SCANVISIBILITY
 
-  // far visibility for long snail trail
-
-  LONG_SNAIL_POINT *lsv= LongSnailTrail;
-  LKASSERT(iLongSnailNext>=0 && iLongSnailNext<=LONGTRAILSIZE);
-  const LONG_SNAIL_POINT *lse = lsv+iLongSnailNext;
-  while (lsv<lse) {
-      lsv->FarVisible = ((lsv->Longitude> bounds.minx) &&
-	    (lsv->Longitude< bounds.maxx) &&
-	    (lsv->Latitude> bounds.miny) &&
-	    (lsv->Latitude< bounds.maxy));
-      lsv++;
-  }
-
   // far visibility for waypoints
 /*
     WAYPOINT& wv = WayPointList.front();
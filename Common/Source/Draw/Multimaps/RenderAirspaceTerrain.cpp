@@ -14,6 +14,9 @@
 #include "Multimap.h"
 #include "LKObjects.h"
 #include "Asset.hpp"
+#include "Draw/LayerCache.h"
+#include "sideview_profile.h"
+#include <algorithm>
 
 using std::min;
 using std::max;
@@ -27,12 +30,18 @@ extern int Sideview_iNoHandeldSpaces;
 
 //#define OUTLINE_2ND    // double outline for airspaces
 
+namespace {
+
+// draw thread only
+sideview_profile<AIRSPACE_SCANSIZE_X> terrain_profile;
+
+} // namespace
+
 void RenderAirspaceTerrain(LKSurface& Surface, double PosLat, double PosLon, double brg, DiagrammStruct* psDiag) {
     RECT rc = psDiag->rc;
     //rc.bottom +=BORDER_Y;
     double range = psDiag->fXMax - psDiag->fXMin; // km
     double hmax = psDiag->fYMax;
-    double lat, lon;
     int i, j;
 
     if (!IsDithered() && IsMultimapTerrain()) {
@@ -40,26 +49,25 @@ void RenderAirspaceTerrain(LKSurface& Surface, double PosLat, double PosLon, dou
     } else {
         Surface.FillRect(&rc, MapWindow::hInvBackgroundBrush[BgMapColor]);
     }
-    FindLatitudeLongitude(PosLat, PosLon, brg, psDiag->fXMin, &lat, &lon);
     POINT apTerrainPolygon[AIRSPACE_SCANSIZE_X + 4] = {};
-    double d_lat[AIRSPACE_SCANSIZE_X] = {};
-    double d_lon[AIRSPACE_SCANSIZE_X] = {};
-    double d_h[AIRSPACE_SCANSIZE_X] = {};
 
 #define   FRAMEWIDTH 2
     RasterTerrain::Lock(); // want most accurate rounding here
     RasterTerrain::SetTerrainRounding(0, 0);
-    double fj;
+    terrain_profile.update({PosLat, PosLon}, brg, psDiag->fXMin, range, layer_cache::version(layer_cache::terrain),
+                           [](const GeoPoint& position) {
+        const double height = RasterTerrain::GetTerrainHeight(position.latitude, position.longitude);
+        return (height == TERRAIN_INVALID) ? 0. : height; //@ 101027 BUGFIX
+    });
+    RasterTerrain::Unlock();
+
+    const auto& d_lat = terrain_profile.latitudes();
+    const auto& d_lon = terrain_profile.longitudes();
+    const auto& d_h = terrain_profile.heights();
     for (j = 0; j < AIRSPACE_SCANSIZE_X; j++) { // scan range
-        fj = (double) j * 1.0 / (double) (AIRSPACE_SCANSIZE_X - 1);
-        FindLatitudeLongitude(lat, lon, brg, range*fj, &d_lat[j], &d_lon[j]);
-        d_h[j] = RasterTerrain::GetTerrainHeight(d_lat[j], d_lon[j]);
-        if (d_h[j] == TERRAIN_INVALID) d_h[j] = 0; //@ 101027 BUGFIX
         hmax = max(hmax, d_h[j]);
     }
 
-    RasterTerrain::Unlock();
-
 
     /********************************************************************************
      * scan line
@@ -72,26 +80,15 @@ void RenderAirspaceTerrain(LKSurface& Surface, double PosLat, double PosLon, dou
     if (Sideview_iNoHandeldSpaces >= MAX_NO_SIDE_AS) Sideview_iNoHandeldSpaces = MAX_NO_SIDE_AS - 1;
 
     /********************************************************************************
-     * bubble sort to start with biggest airspaces
+     * sort to start with biggest airspaces
      ********************************************************************************/
     int iSizeLookupTable[MAX_NO_SIDE_AS];
     for (i = 0; i < Sideview_iNoHandeldSpaces; i++)
         iSizeLookupTable[i] = i;
 
-    for (i = 0; i < Sideview_iNoHandeldSpaces; i++) {
-        BUGSTOP_LKASSERT(iSizeLookupTable[i] < MAX_NO_SIDE_AS);
-        for (j = i; j < Sideview_iNoHandeldSpaces; j++) {
-            BUGSTOP_LKASSERT(iSizeLookupTable[j] < MAX_NO_SIDE_AS);
-            if (iSizeLookupTable[i] >= MAX_NO_SIDE_AS) continue;
-            if (iSizeLookupTable[j] >= MAX_NO_SIDE_AS) continue;
-
-            if (Sideview_pHandeled[iSizeLookupTable[i]].iAreaSize < Sideview_pHandeled[iSizeLookupTable[j]].iAreaSize) {
-                int iTmp = iSizeLookupTable[i];
-                iSizeLookupTable[i] = iSizeLookupTable[j];
-                iSizeLookupTable[j] = iTmp;
-            }
-        }
-    }
+    std::stable_sort(iSizeLookupTable, iSizeLookupTable + Sideview_iNoHandeldSpaces, [](int a, int b) {
+        return Sideview_pHandeled[a].iAreaSize > Sideview_pHandeled[b].iAreaSize;
+    });
     /**********************************************************************************
      * transform into diagram coordinates
      **********************************************************************************/
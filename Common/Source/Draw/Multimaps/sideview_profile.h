@@ -0,0 +1,176 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   sideview_profile.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _DRAW_MULTIMAPS_SIDEVIEW_PROFILE_H_
+#define _DRAW_MULTIMAPS_SIDEVIEW_PROFILE_H_
+
+#include "Geographic/SphereBatch.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Terrain profile along sideview scan line, kept between redraws.
+ *
+ * Samples are equally spaced on the great circle starting at an anchor point.
+ * When the requested line is the same one moved along itself by less than the
+ * whole range ( straight flight, or drift while thermalling toward a fixed
+ * target ), samples are shifted and only the new part is sampled. Any other
+ * change ( turn, zoom, terrain reload ) resample the whole line.
+ *
+ * Shifting is done by whole samples, so a cached line can be off by up to
+ * half a sample along and across the line : less than one pixel.
+ */
+template<size_t Size>
+class sideview_profile final {
+  static_assert(Size >= 2, "need at least 2 samples");
+
+ public:
+  /**
+   * @origin : aircraft position
+   * @bearing : deg, direction of the line
+   * @start : m, distance of first sample from origin, negative is behind
+   * @range : m, distance between first and last sample
+   * @terrain_version : terrain data version, samples are discarded when it change
+   * @sample : double(const GeoPoint&), terrain height at a position
+   * @return number of sampled points
+   */
+  template<typename Sampler>
+  size_t update(const GeoPoint& origin, double bearing, double start, double range,
+                unsigned terrain_version, Sampler&& sample) {
+
+    GeoPoint first;
+    sphere::FindLatitudeLongitude(origin, &bearing, &start, 1, &first);
+
+    if (_valid && terrain_version == _terrain_version && range == _range) {
+      const double spacing = _range / (Size - 1);
+      const double tolerance = spacing / 2.;
+
+      double distance, direction;
+      sphere::DistanceBearing(_anchor, &first, 1, &distance, &direction);
+      const double angle = (direction - _bearing) * sphere::detail::deg_to_rad;
+      const double along = distance * std::cos(angle);
+      const double across = distance * std::sin(angle);
+
+      // direction of cached line at first point, differ from anchor bearing
+      // along great circle.
+      double local = _bearing;
+      if (distance > spacing) {
+        double back;
+        sphere::DistanceBearing(first, &_anchor, 1, nullptr, &back);
+        local = (along > 0.) ? back + 180. : back;
+      }
+      // lateral error at far end of the line, caused by different bearing.
+      double turn = std::fmod(std::fabs(bearing - local), 360.);
+      turn = std::min(turn, 360. - turn) * sphere::detail::deg_to_rad;
+
+      const long offset = std::lround(along / spacing);
+      const long shift = offset - _offset;
+      if (std::fabs(across) <= tolerance && turn * range <= tolerance
+              && static_cast<size_t>(std::labs(shift)) < Size
+              && static_cast<size_t>(std::labs(offset)) < max_offset) {
+        return shift_samples(shift, sample);
+      }
+    }
+
+    _valid = true;
+    _terrain_version = terrain_version;
+    _range = range;
+    _bearing = bearing;
+    _anchor = first;
+    _offset = 0;
+    return fill(0, Size, sample);
+  }
+
+  void invalidate() {
+    _valid = false;
+  }
+
+  const double (&latitudes() const)[Size] {
+    return _latitudes;
+  }
+
+  const double (&longitudes() const)[Size] {
+    return _longitudes;
+  }
+
+  const double (&heights() const)[Size] {
+    return _heights;
+  }
+
+ private:
+  // re-anchor before shifted line is too far from anchor.
+  static constexpr size_t max_offset = 16 * Size;
+
+  template<typename Sampler>
+  size_t shift_samples(long shift, Sampler&& sample) {
+    _offset += shift;
+    if (shift > 0) {
+      const size_t count = shift;
+      move_samples(count, 0, Size - count);
+      return fill(Size - count, Size, sample);
+    }
+    if (shift < 0) {
+      const size_t count = -shift;
+      move_samples(0, count, Size - count);
+      return fill(0, count, sample);
+    }
+    return 0;
+  }
+
+  void move_samples(size_t from, size_t to, size_t count) {
+    for (double* samples : { _latitudes, _longitudes, _heights }) {
+      if (from > to) {
+        std::copy(samples + from, samples + from + count, samples + to);
+      } else {
+        std::copy_backward(samples + from, samples + from + count, samples + to + count);
+      }
+    }
+  }
+
+  // sample [begin, end)
+  template<typename Sampler>
+  size_t fill(size_t begin, size_t end, Sampler&& sample) {
+    const double spacing = _range / (Size - 1);
+    std::array<double, Size> bearings = {};
+    std::array<double, Size> distances = {};
+    std::array<GeoPoint, Size> points = {};
+
+    const size_t count = end - begin;
+    for (size_t i = 0; i < count; ++i) {
+      const double distance = (_offset + static_cast<long>(begin + i)) * spacing;
+      // negative distance : opposite direction
+      bearings[i] = (distance < 0.) ? _bearing + 180. : _bearing;
+      distances[i] = std::fabs(distance);
+    }
+    sphere::FindLatitudeLongitude(_anchor, bearings.data(), distances.data(), count, points.data());
+
+    for (size_t i = 0; i < count; ++i) {
+      _latitudes[begin + i] = points[i].latitude;
+      _longitudes[begin + i] = points[i].longitude;
+      _heights[begin + i] = sample(points[i]);
+    }
+    return count;
+  }
+
+  bool _valid = false;
+  unsigned _terrain_version = 0;
+  double _range = 0.;
+  double _bearing = 0.;
+  GeoPoint _anchor = {};
+  long _offset = 0; // distance from anchor to first sample, in samples
+
+  double _latitudes[Size] = {};
+  double _longitudes[Size] = {};
+  double _heights[Size] = {};
+};
+
+#endif // _DRAW_MULTIMAPS_SIDEVIEW_PROFILE_H_
@@ -8,6 +8,38 @@
 
 #include "externs.h"
 #include "Time/PeriodClock.hpp"
+#include "Profiler.h"
+#include "utils/frame_arena.h"
+#include "utils/alloc_counter.h"
+
+namespace {
+
+frame_arena draw_frame_arena(64 * 1024);
+
+/**
+ * end of frame : release frame arena and record heap allocations done by the
+ * frame ( debug build only ).
+ */
+class frame_scope final {
+ public:
+  frame_scope() : _allocations(alloc_counter::thread_count()) {}
+
+  ~frame_scope() {
+    draw_frame_arena.reset();
+    if (alloc_counter::enabled) {
+      profiler::add(profiler::probe::FrameAllocations, alloc_counter::thread_count() - _allocations);
+    }
+  }
+
+ private:
+  const uint64_t _allocations;
+};
+
+} // namespace
+
+frame_arena& MapWindow::FrameArena() {
+  return draw_frame_arena;
+}
 
 
 PeriodClock MapWindow::timestamp_newdata;
@@ -44,6 +76,8 @@ bool FastZoom;
 //
 void MapWindow::RenderMapWindow(LKSurface& Surface, const RECT& rc)
 {
+  const frame_scope frame;
+
   // First of all we set the flag for DrawBottom. This is critical.
   if (NOTANYPAN)
 	DrawBottom=true;
@@ -105,6 +139,8 @@ void MapWindow::RenderMapWindow(LKSurface& Surface, const RECT& rc)
 
   RenderMapWindowBg(Surface, rc);
 
+  DrawProfilerHud(Surface, rc);
+
   // No reason to check for bigzoom here, because we are not drawing the map
   if (DONTDRAWTHEMAP) {
 	DrawFlightMode(Surface, rc);
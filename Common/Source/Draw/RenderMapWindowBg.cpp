@@ -13,11 +13,21 @@
 #include "Multimap.h"
 #include "Sound/Sound.h"
 #include "ScreenProjection.h"
+#include "LayerCache.h"
+#include "Profiler.h"
 
 extern bool FastZoom;
 extern bool TargetDialogOpen;
 extern unsigned int DrawTerrainTimer;
 
+#ifndef ENABLE_OPENGL
+extern bool ForceRenderMap;
+
+namespace {
+  layer_cache StaticLayers;
+}
+#endif
+
 
 void MapWindow::RenderOverlayGauges(LKSurface& Surface, const RECT& rc) {
     DrawThermalBand(Surface, rc);
@@ -29,6 +39,8 @@ void MapWindow::RenderOverlayGauges(LKSurface& Surface, const RECT& rc) {
 
 void MapWindow::RenderMapWindowBg(LKSurface& Surface, const RECT& rc) {
 
+    const profiler::scoped_timer timer(profiler::probe::RenderMapWindowBg);
+
     if ( (LKSurface::AlphaBlendSupported() && BarOpacity < 100) || mode.AnyPan() ) {
         RECT newRect = {0, 0, ScreenSizeX, ScreenSizeY};
         MapWindow::ChangeDrawRect(newRect);
@@ -137,7 +149,22 @@ QuickRedraw:
 
     bool terrainpainted = false;
 
-    if ((IsMultimapTerrain() && (DerivedDrawInfo.TerrainValid) && RasterTerrain::isTerrainLoaded())) {
+    const bool terrain_enabled = (IsMultimapTerrain() && (DerivedDrawInfo.TerrainValid) && RasterTerrain::isTerrainLoaded());
+
+#ifndef ENABLE_OPENGL
+    // glide amoeba is drawn between terrain and topology and change at each calculation cycle,
+    // static layers can't be cached when it's enabled.
+    const bool terrain_above = terrain_enabled && !QUICKDRAW && ((FinalGlideTerrain == 2) || (FinalGlideTerrain == 4));
+    const bool use_layer_cache = !terrain_above && !ForceRenderMap;
+
+    const auto layer_settings = layer_cache::settings_t::current(rc, DrawRect, terrain_enabled);
+    if (use_layer_cache && StaticLayers.restore(Surface, _Proj, layer_settings)) {
+        terrainpainted = StaticLayers.terrain_painted();
+        goto _static_layers_done;
+    }
+#endif
+
+    if (terrain_enabled) {
         // sunelevation is never used, it is still a todo in Terrain
         double sunelevation = 40.0;
         double sunazimuth = GetAzimuth(DrawInfo, DerivedDrawInfo);
@@ -190,6 +217,16 @@ QuickRedraw:
         }
     }
 
+#ifndef ENABLE_OPENGL
+    if (use_layer_cache) {
+        StaticLayers.store(Surface, _Proj, layer_settings, terrainpainted);
+    } else {
+        StaticLayers.reset();
+    }
+
+_static_layers_done:
+#endif
+
     // Topology labels are printed first, using OLD wps positions from previous run!
     // Reset for topology labels decluttering engine occurs also in another place here!
     ResetLabelDeclutter();
@@ -241,6 +278,7 @@ _skip_stuff:
         DrawWaypointsNew(Surface, DrawRect, _Proj);
     }
     if (TrailActive) {
+        const profiler::scoped_timer timer(profiler::probe::DrawTrail);
         LKDrawLongTrail(Surface, DrawRect, _Proj);
         LKDrawTrail(Surface, DrawRect, _Proj);
     }
@@ -293,11 +331,15 @@ _skip_stuff:
         goto QuickRedraw;
     }
 
-    // Draw traffic and other specifix LK gauges
-    LKDrawFLARMTraffic(Surface, DrawRect, _Proj, Orig_Aircraft);
+    {
+        const profiler::scoped_timer timer(profiler::probe::DrawTraffic);
+
+        // Draw traffic and other specifix LK gauges
+        LKDrawFLARMTraffic(Surface, DrawRect, _Proj, Orig_Aircraft);
 
-    // Draw FANET-Data on Map
-    LKDrawFanetData(Surface, DrawRect, _Proj, Orig_Aircraft);
+        // Draw FANET-Data on Map
+        LKDrawFanetData(Surface, DrawRect, _Proj, Orig_Aircraft);
+    }
 
     // ---------------------------------------------------
 _skip_2:
@@ -53,9 +53,10 @@ public:
 
     bool operator!=(const ScreenProjection& _Proj) const;
 
-protected:
     double GetPixelSize() const;
 
+protected:
+
     /* geographic center of projection
      * usually aircraft position in wgs84 geographic coordinate
      */
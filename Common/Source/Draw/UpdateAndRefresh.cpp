@@ -9,6 +9,7 @@
 #include "externs.h"
 #include "Terrain.h"
 #include "Time/PeriodClock.hpp"
+#include "LKValueCache.h"
 
 
 //
@@ -40,8 +41,13 @@ bool MapWindow::RenderTimeAvailable() {
 void MapWindow::UpdateInfo(NMEA_INFO *nmea_info,
                            DERIVED_INFO *derived_info) {
   LockFlightData();
-  memcpy(&DrawInfo,nmea_info,sizeof(NMEA_INFO));
-  memcpy(&DerivedDrawInfo,derived_info,sizeof(DERIVED_INFO));
+  // formatted values are only outdated if snapshot has changed.
+  if (!SameInfo(DrawInfo, *nmea_info)
+        || memcmp(&DerivedDrawInfo, derived_info, sizeof(DERIVED_INFO)) != 0) {
+    CopyInfo(DrawInfo, *nmea_info);
+    memcpy(&DerivedDrawInfo,derived_info,sizeof(DERIVED_INFO));
+    lk_value_cache::invalidate();
+  }
   zoom.UpdateMapScale(); // done here to avoid double latency due to locks
   UnlockFlightData();
 }
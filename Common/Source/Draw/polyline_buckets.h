@@ -0,0 +1,98 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   polyline_buckets.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _DRAW_POLYLINE_BUCKETS_H_
+#define _DRAW_POLYLINE_BUCKETS_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Multi colour polyline split into runs of same colour, grouped by colour :
+ * all runs of one colour are drawn with one pen selection, and one draw call
+ * with `LKSurface::Polylines`.
+ *
+ * Runs are ranges of the source polyline ( first point, number of points ),
+ * two consecutive runs share their common point, nothing is copied.
+ *
+ * Buffers are kept between calls, no allocation once the biggest polyline is
+ * built.
+ */
+template<size_t ColourCount>
+class polyline_buckets final {
+ public:
+  /**
+   * <colours[i]> is colour of segment from point i to point i + 1,
+   * <count> is number of points.
+   */
+  template<typename Colour>
+  void build(const Colour* colours, unsigned count) {
+    _runs.clear();
+    _sizes.fill(0);
+    for (unsigned first = 0; first + 1 < count;) {
+      const Colour colour = colours[first];
+      unsigned last = first + 1;
+      while (last + 1 < count && colours[last] == colour) {
+        ++last;
+      }
+      _runs.push_back({ first, last - first + 1, static_cast<unsigned>(colour) });
+      ++_sizes[colour];
+      first = last;
+    }
+
+    // counting sort of runs by colour
+    std::array<unsigned, ColourCount> offsets;
+    unsigned offset = 0;
+    for (size_t c = 0; c < ColourCount; ++c) {
+      offsets[c] = offset;
+      offset += _sizes[c];
+    }
+    _firsts.resize(_runs.size());
+    _counts.resize(_runs.size());
+    for (const run_t& run : _runs) {
+      const unsigned i = offsets[run.colour]++;
+      _firsts[i] = run.first;
+      _counts[i] = run.count;
+    }
+  }
+
+  /**
+   * invoke <fn>(colour, firsts, counts, size) for each colour used.
+   */
+  template<typename Fn>
+  void for_each(Fn&& fn) const {
+    unsigned offset = 0;
+    for (size_t c = 0; c < ColourCount; ++c) {
+      if (_sizes[c] > 0) {
+        fn(c, _firsts.data() + offset, _counts.data() + offset, _sizes[c]);
+        offset += _sizes[c];
+      }
+    }
+  }
+
+  size_t size() const {
+    return _runs.size();
+  }
+
+ private:
+  struct run_t {
+    unsigned first;
+    unsigned count;
+    unsigned colour;
+  };
+
+  std::vector<run_t> _runs;
+  std::vector<unsigned> _firsts;
+  std::vector<unsigned> _counts;
+  std::array<unsigned, ColourCount> _sizes = {};
+};
+
+#endif // _DRAW_POLYLINE_BUCKETS_H_
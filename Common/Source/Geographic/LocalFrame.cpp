@@ -0,0 +1,248 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LocalFrame.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "options.h"
+#include "LocalFrame.h"
+#include "NavFunctions.h"
+#include <cmath>
+
+extern bool earth_model_wgs84;
+
+namespace {
+
+constexpr double sphere_radius = 6371000.0; // same as `DistanceBearing()`
+
+#ifdef _WGS84
+constexpr double wgs84_a = 6378137.0;
+constexpr double wgs84_f = 1. / 298.257223563;
+constexpr double wgs84_esq = wgs84_f * (2. - wgs84_f);
+#endif
+
+// beyond this latitude, meridian convergence is too fast for a local frame.
+constexpr double max_latitude = 80.;
+
+constexpr double pi = 3.14159265358979323846;
+
+inline double deg2rad(double deg) {
+  return (deg * pi / 180);
+}
+
+inline double rad2deg(double rad) {
+  return (rad * 180 / pi);
+}
+
+inline double angle_limit_360(double deg) {
+  deg = std::fmod(deg, 360.);
+  return (deg < 0) ? deg + 360. : deg;
+}
+
+/**
+ * wrap longitude difference to [-pi, pi], without branch.
+ */
+inline double wrap_pi(double rad) {
+  rad = (rad > pi) ? rad - 2 * pi : rad;
+  return (rad < -pi) ? rad + 2 * pi : rad;
+}
+
+} // namespace
+
+LocalFrame::LocalFrame(const GeoPoint& center, double radius)
+        : center(center)
+        , radius(radius)
+        , radius_sq(radius * radius)
+        , lat0(deg2rad(center.latitude))
+        , lon0(deg2rad(center.longitude))
+        , sin0(std::sin(lat0))
+        , cos0(std::cos(lat0))
+{
+#ifdef _WGS84
+  if (earth_model_wgs84) {
+    const double w2 = 1. - wgs84_esq * sin0 * sin0;
+    const double w = std::sqrt(w2);
+    const double w3 = w2 * w;
+    const double w5 = w3 * w2;
+    const double w7 = w5 * w2;
+
+    M0 = wgs84_a * (1. - wgs84_esq) / w3;
+    dM = 3. * wgs84_a * (1. - wgs84_esq) * wgs84_esq * sin0 * cos0 / w5;
+    ddM = 3. * wgs84_a * (1. - wgs84_esq) * wgs84_esq
+            * ((cos0 * cos0 - sin0 * sin0) / w5 + 5. * wgs84_esq * sin0 * sin0 * cos0 * cos0 / w7);
+    N0 = wgs84_a / w;
+    dN = wgs84_a * wgs84_esq * sin0 * cos0 / w3;
+  } else
+#endif
+  {
+    M0 = sphere_radius;
+    dM = 0.;
+    ddM = 0.;
+    N0 = sphere_radius;
+    dN = 0.;
+  }
+
+  valid = (std::fabs(center.latitude) <= max_latitude);
+
+  // truncation error of the expansion is in (d/R)^2 / cos^2(lat),
+  // factor 0.1 is twice the worst case found against GeographicLib.
+  const double r = radius / sphere_radius;
+  max_error = 0.1 * r * r / (cos0 * cos0);
+}
+
+/*
+ * Distance and azimuth at middle of the segment, with scale factors expanded
+ * around center latitude :
+ *   y = M(lat_m) * dlat
+ *   x = N(lat_m) * cos(lat_m) * dlon
+ * initial azimuth is azimuth at middle minus half meridian convergence.
+ */
+inline LocalFrame::local_t LocalFrame::Project(double latitude, double longitude) const {
+  const double dlat = deg2rad(latitude) - lat0;
+  const double dlon = wrap_pi(deg2rad(longitude) - lon0);
+
+  const double h = dlat / 2;
+  const double h2 = h * h;
+  const double cos_m = cos0 * (1. - h2 / 2) - sin0 * h * (1. - h2 / 6);
+  const double sin_m = sin0 * (1. - h2 / 2) + cos0 * h;
+
+  const double M = M0 + h * (dM + h * ddM / 2);
+  const double N = N0 + h * dN;
+
+  return {
+    N * cos_m * dlon,
+    M * dlat,
+    dlon * sin_m
+  };
+}
+
+Point2D<double> LocalFrame::Forward(const GeoPoint& position) const {
+  const local_t local = Project(position.latitude, position.longitude);
+  return { local.x, local.y };
+}
+
+void LocalFrame::Forward(const GeoPoint* positions, size_t count, Point2D<double>* out) const {
+  for (size_t i = 0; i < count; ++i) {
+    const local_t local = Project(positions[i].latitude, positions[i].longitude);
+    out[i].x = local.x;
+    out[i].y = local.y;
+  }
+}
+
+void LocalFrame::DistanceBearing(const GeoPoint& position, double* Distance, double* Bearing) const {
+  if (valid) {
+    const local_t local = Project(position.latitude, position.longitude);
+    const double d2 = local.x * local.x + local.y * local.y;
+    if (d2 <= radius_sq) {
+      if (Distance) {
+        *Distance = std::sqrt(d2);
+      }
+      if (Bearing) {
+        *Bearing = (d2 > 0) ? angle_limit_360(rad2deg(std::atan2(local.x, local.y) - local.convergence / 2)) : 0;
+      }
+      return;
+    }
+  }
+  ::DistanceBearing(center.latitude, center.longitude, position.latitude, position.longitude, Distance, Bearing);
+}
+
+double LocalFrame::Distance(const GeoPoint& position) const {
+  double distance;
+  DistanceBearing(position, &distance, nullptr);
+  return distance;
+}
+
+#ifndef DOCTEST_CONFIG_DISABLE
+#include <doctest/doctest.h>
+#include <utility>
+
+TEST_CASE("LocalFrame") {
+
+  auto angle_diff = [](double a, double b) {
+    return std::fabs(std::remainder(a - b, 360.));
+  };
+
+#ifdef _WGS84
+  SUBCASE("WGS84") {
+    const bool old_model = std::exchange(earth_model_wgs84, true);
+
+    struct {
+      GeoPoint center;
+      GeoPoint point;
+      double distance;
+      double bearing;
+    } reference[] = {
+      // computed using GeographicLib Geodesic::WGS84().Direct()
+      { { 45.5, 7.25 }, { 45.593478509, 7.326894834 }, 12000.0, 30.0 },
+      { { 45.5, 7.25 }, { 44.780690973, 6.882695656 }, 85000.0, 200.0 },
+      { { -33.9, 18.60 }, { -33.945448242, 19.246577384 }, 60000.0, 95.0 },
+      { { 0.0, 179.90 }, { 0.000000000, -179.740673886 }, 40000.0, 90.0 },
+      { { 64.1, -21.90 }, { 64.720674117, -23.368680463 }, 99000.0, 315.0 },
+      { { 79.5, 15.00 }, { 78.882062371, 15.564440985 }, 70000.0, 170.0 },
+    };
+
+    for (const auto& ref : reference) {
+      const LocalFrame frame(ref.center);
+      REQUIRE(frame.Valid());
+
+      double distance, bearing;
+      frame.DistanceBearing(ref.point, &distance, &bearing);
+      CHECK(std::fabs(distance - ref.distance) <= ref.distance * frame.MaxRelativeError());
+      CHECK(angle_diff(bearing, ref.bearing) < 0.02);
+    }
+
+    earth_model_wgs84 = old_model;
+  }
+#endif
+
+  SUBCASE("FAI sphere") {
+    const bool old_model = std::exchange(earth_model_wgs84, false);
+
+    const GeoPoint center = { 46.2, 6.1 };
+    const LocalFrame frame(center, 100000.);
+
+    for (double bearing = 0; bearing < 360; bearing += 15) {
+      for (double distance : { 500., 10000., 50000., 99000. }) {
+        const GeoPoint point = center.Direct(bearing, distance);
+
+        double frame_distance, frame_bearing;
+        frame.DistanceBearing(point, &frame_distance, &frame_bearing);
+        CHECK(std::fabs(frame_distance - distance) <= distance * frame.MaxRelativeError());
+        CHECK(angle_diff(frame_bearing, bearing) < 0.02);
+      }
+    }
+
+    // beyond radius, full computation is used
+    const GeoPoint far = center.Direct(42., 250000.);
+    double distance, bearing, frame_distance, frame_bearing;
+    DistanceBearing(center.latitude, center.longitude, far.latitude, far.longitude, &distance, &bearing);
+    frame.DistanceBearing(far, &frame_distance, &frame_bearing);
+    CHECK(frame_distance == distance);
+    CHECK(frame_bearing == bearing);
+
+    // batch conversion give same result than single point conversion
+    const GeoPoint points[] = {
+      center, center.Direct(10., 1000.), center.Direct(190., 20000.), center.Direct(275., 75000.)
+    };
+    Point2D<double> out[std::size(points)];
+    frame.Forward(points, std::size(points), out);
+    for (size_t i = 0; i < std::size(points); ++i) {
+      CHECK(out[i] == frame.Forward(points[i]));
+    }
+    CHECK(out[0].x == 0.);
+    CHECK(out[0].y == 0.);
+
+    earth_model_wgs84 = old_model;
+  }
+
+  SUBCASE("polar center") {
+    const LocalFrame frame({ 85., 0. });
+    CHECK_FALSE(frame.Valid());
+  }
+}
+
+#endif
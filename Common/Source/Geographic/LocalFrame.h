@@ -0,0 +1,115 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   LocalFrame.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _GEOGRAPHIC_LOCALFRAME_H_
+#define _GEOGRAPHIC_LOCALFRAME_H_
+
+#include "GeoPoint.h"
+#include "Math/Point2D.hpp"
+#include <cstddef>
+
+/**
+ * Local tangent plane (East/North) centred on one point, typically aircraft
+ * position, used to replace full geodesic inverse for short range distance
+ * and bearing.
+ *
+ * Scale factors ( meridional and prime vertical radius of curvature ) and
+ * their derivatives are computed once by constructor, so conversion of one
+ * point only cost a few multiplications, without any trigonometric function.
+ *
+ * Inside `Radius()`, distance relative error is less than `MaxRelativeError()`
+ *   ~ 1.5e-5 at 100km, 45° of latitude,
+ *   ~ 4e-4 at 100km, 80° of latitude,
+ * and bearing error is less than 0.02°.
+ * Beyond radius, or if center is closer than 10° from a pole, `DistanceBearing()`
+ * and `Distance()` fall back to full geodesic computation.
+ *
+ * Earth model ( WGS84 or FAI sphere ) is the one selected when frame is built.
+ */
+class LocalFrame final {
+public:
+  LocalFrame() = delete;
+
+  /**
+   * @center : origin of the frame
+   * @radius : maximum distance from center for local computation (m)
+   */
+  explicit LocalFrame(const GeoPoint& center, double radius = 100000.);
+
+  const GeoPoint& Center() const {
+    return center;
+  }
+
+  double Radius() const {
+    return radius;
+  }
+
+  /**
+   * @return upper bound of distance relative error inside radius.
+   */
+  double MaxRelativeError() const {
+    return max_error;
+  }
+
+  /**
+   * @return false if center is too close from a pole to use local frame.
+   */
+  bool Valid() const {
+    return valid;
+  }
+
+  /**
+   * convert to local coordinate in meter, 'x' is 'E' and y is 'N'
+   *  result is meaningless far beyond radius.
+   */
+  Point2D<double> Forward(const GeoPoint& position) const;
+
+  /**
+   * convert <count> points, loop without branch nor trigonometric function
+   * to let compiler vectorize it.
+   */
+  void Forward(const GeoPoint* positions, size_t count, Point2D<double>* out) const;
+
+  /**
+   * same as `::DistanceBearing(Center(), position)`
+   */
+  void DistanceBearing(const GeoPoint& position, double* Distance, double* Bearing) const;
+
+  double Distance(const GeoPoint& position) const;
+
+private:
+  struct local_t {
+    double x; // East (m)
+    double y; // North (m)
+    double convergence; // meridian convergence between center and point (rad)
+  };
+
+  local_t Project(double latitude, double longitude) const;
+
+  const GeoPoint center;
+  const double radius;
+  const double radius_sq;
+
+  const double lat0; // rad
+  const double lon0; // rad
+  const double sin0;
+  const double cos0;
+
+  double M0; // meridional radius of curvature at center
+  double dM; // first derivative by latitude
+  double ddM; // second derivative by latitude
+  double N0; // prime vertical radius of curvature at center
+  double dN; // first derivative by latitude
+
+  bool valid;
+  double max_error;
+};
+
+#endif /* _GEOGRAPHIC_LOCALFRAME_H_ */
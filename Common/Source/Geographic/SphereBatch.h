@@ -0,0 +1,112 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   SphereBatch.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _GEOGRAPHIC_SPHEREBATCH_H_
+#define _GEOGRAPHIC_SPHEREBATCH_H_
+
+#include "GeoPoint.h"
+#include "PolyTrig.h"
+#include <cstddef>
+
+/**
+ * Array version of FAI sphere `DistanceBearing()` and `FindLatitudeLongitude()`
+ *
+ * Same formulas than scalar version, but using polynomial sin/cos/atan2 from
+ * PolyTrig.h : loop body has no call and no branch, so it can be
+ * vectorized by compiler.
+ *
+ * Header only : used by NavFunctions.cpp and by unit tests / benchmark.
+ */
+namespace sphere {
+
+constexpr double earth_radius = 6371000.0;
+
+namespace detail {
+
+constexpr double deg_to_rad = 0.017453292519943295769;
+constexpr double rad_to_deg = 57.295779513082320877;
+constexpr double pi = 3.14159265358979323846;
+
+inline double clamp01(double v) {
+  return (v < 0.) ? 0. : ((v > 1.) ? 1. : v);
+}
+
+} // namespace detail
+
+/**
+ * Distance (m) and bearing (deg) from <origin> to <count> points.
+ * <Distance> or <Bearing> can be null.
+ */
+inline void DistanceBearing(const GeoPoint& origin, const GeoPoint* dest, size_t count,
+                            double* Distance, double* Bearing) {
+  using namespace detail;
+
+  const double lat1 = origin.latitude * deg_to_rad;
+  const double lon1 = origin.longitude * deg_to_rad;
+  double slat1, clat1;
+  poly_sin_cos(lat1, slat1, clat1);
+
+  for (size_t i = 0; i < count; ++i) {
+    const double lat2 = dest[i].latitude * deg_to_rad;
+    const double dlon = dest[i].longitude * deg_to_rad - lon1;
+
+    double slat2, clat2, s1, c1, s2, c2;
+    poly_sin_cos(lat2, slat2, clat2);
+    poly_sin_cos((lat2 - lat1) / 2, s1, c1);
+    poly_sin_cos(dlon / 2, s2, c2);
+
+    if (Distance) {
+      const double a = clamp01(s1 * s1 + clat1 * clat2 * s2 * s2);
+      Distance[i] = earth_radius * 2. * poly_atan2(std::sqrt(a), std::sqrt(1. - a));
+    }
+    if (Bearing) {
+      // sin(dlon) and cos(dlon) from half angle
+      const double y = 2. * s2 * c2 * clat2;
+      const double x = clat1 * slat2 - slat1 * clat2 * (1. - 2. * s2 * s2);
+      const double bearing = poly_atan2(y, x) * rad_to_deg;
+      Bearing[i] = (bearing < 0.) ? bearing + 360. : bearing;
+    }
+  }
+}
+
+/**
+ * Position of <count> points at <Distance> (m) and <Bearing> (deg) from <origin>
+ */
+inline void FindLatitudeLongitude(const GeoPoint& origin, const double* Bearing, const double* Distance,
+                                  size_t count, GeoPoint* out) {
+  using namespace detail;
+
+  const double lat = origin.latitude * deg_to_rad;
+  const double lon = origin.longitude * deg_to_rad;
+  double sinLat, cosLat;
+  poly_sin_cos(lat, sinLat, cosLat);
+
+  for (size_t i = 0; i < count; ++i) {
+    double sinBearing, cosBearing, sinDistance, cosDistance;
+    poly_sin_cos(Bearing[i] * deg_to_rad, sinBearing, cosBearing);
+    poly_sin_cos(Distance[i] / earth_radius, sinDistance, cosDistance);
+
+    const double sinResult = sinLat * cosDistance + cosLat * sinDistance * cosBearing;
+    const double cosResult = std::sqrt(clamp01(1. - sinResult * sinResult));
+    const double ResultLat = poly_atan2(sinResult, cosResult);
+
+    const double dlon = poly_atan2(sinBearing * sinDistance * cosLat, cosDistance - sinLat * sinResult);
+    double ResultLon = lon + dlon + pi;
+    ResultLon -= 2. * pi * std::floor(ResultLon / (2. * pi));
+    ResultLon = (cosLat == 0.) ? lon : ResultLon - pi;
+
+    out[i].latitude = ResultLat * rad_to_deg;
+    out[i].longitude = ResultLon * rad_to_deg;
+  }
+}
+
+} // namespace sphere
+
+#endif /* _GEOGRAPHIC_SPHEREBATCH_H_ */
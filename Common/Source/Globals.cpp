@@ -438,7 +438,7 @@ void Globals_Init(void) {
   AirspaceAckAllSame = 0;
 
   SnailNext = 0;
-  LongSnailNext = 0;
+  LongSnailTrail.clear();
 
   // OLC COOKED VALUES
   //CContestMgr::CResult OlcResults[CContestMgr::TYPE_NUM];
@@ -671,6 +671,12 @@ void Globals_Init(void) {
   TerrainWhiteness=1;
 
   EnableAudioVario = false;
+  AudioVarioLiftThreshold = 0.2;
+  AudioVarioSinkThreshold = -2.;
+  AudioVarioLiftToneLow = 600;
+  AudioVarioLiftToneHigh = 1200;
+  AudioVarioSinkTone = 400;
+  AudioVarioVolume = 50;
 
   // ^ ADD NEW GLOBALS up here ^
   // ---------------------------
@@ -0,0 +1,121 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   Headless.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "externs.h"
+#include "Headless.h"
+#include "Logger.h"
+#include "Waypointparser.h"
+#include "McReady.h"
+#include "Geoid.h"
+#include "RasterTerrain.h"
+#include "Terrain.h"
+#include "LKInterface.h"
+#include "Calc/Vario.h"
+#include "Waypoints/SetHome.h"
+#include "Baro.h"
+#include "Comm/ExternalWind.h"
+
+extern void PreloadInitialisation(bool ask);
+
+namespace headless {
+
+void initialise(const TCHAR* profile) {
+  _tcscpy(LK8000_Version, _T(LKFORK " v" LKVERSION "." LKRELEASE " " __DATE__));
+  StartupStore(_T(". Starting %s headless"), LK8000_Version);
+
+  Globals_Init();
+
+  LocalPath(defaultProfileFile, _T(LKD_CONF), _T(LKPROFILE));
+  _tcscpy(startProfileFile, defaultProfileFile);
+  LocalPath(defaultAircraftFile, _T(LKD_CONF), _T(LKAIRCRAFT));
+  _tcscpy(startAircraftFile, defaultAircraftFile);
+  LocalPath(defaultPilotFile, _T(LKD_CONF), _T(LKPILOT));
+  _tcscpy(startPilotFile, defaultPilotFile);
+  LocalPath(defaultDeviceFile, _T(LKD_CONF), _T(LKDEVICE));
+  _tcscpy(startDeviceFile, defaultDeviceFile);
+  if (profile && profile[0]) {
+    LK_tcsncpy(startProfileFile, profile, MAX_PATH - 1);
+  }
+
+  InitSineTable();
+
+  memset(&(Task), 0, sizeof(Task_t));
+  memset(&(StartPoints), 0, sizeof(Start_t));
+  ClearTask();
+  memset(&(GPS_INFO), 0, sizeof(GPS_INFO));
+  memset(&(CALCULATED_INFO), 0, sizeof(CALCULATED_INFO));
+
+  ResetBaroAvailable(GPS_INFO);
+  ResetVarioAvailable(GPS_INFO);
+  ResetExternalWindAvailable(GPS_INFO);
+  ResetHeartRateAvailable(GPS_INFO);
+
+  InitCalculations(&GPS_INFO, &CALCULATED_INFO);
+
+  OpenGeoid();
+
+  PreloadInitialisation(true); // load profiles, no startup dialog
+  EnableSoundModes = false;
+
+  ReadWinPilotPolar();
+
+  LockTerrainDataGraphics();
+  RasterTerrain::OpenTerrain();
+  UnlockTerrainDataGraphics();
+
+  ReadWayPoints();
+  StartupStore(_T(". LOADED %d WAYPOINTS + %u virtuals"), (unsigned)WayPointList.size() - NUMRESWP, NUMRESWP);
+  InitLDRotary(&rotaryLD);
+  InitWindRotary(&rotaryWind);
+  InitLK8000();
+  SetHome(false);
+
+  CAirspaceManager::Instance().ReadAirspaces();
+  CAirspaceManager::Instance().SortAirspaces();
+
+  GlidePolar::SetBallast();
+}
+
+void calculation_pipeline::calculate() {
+  LockFlightData();
+  FLARM_RefreshSlots(&GPS_INFO);
+  Fanet_RefreshSlots(&GPS_INFO);
+  CopyInfo(basic, GPS_INFO);
+  memcpy(&calculated, &CALCULATED_INFO, sizeof(DERIVED_INFO));
+  UnlockFlightData();
+
+  DoCalculationsVario(&basic, &calculated);
+  if (DoCalculations(&basic, &calculated)) {
+    needcalculationsslow = true;
+  }
+
+  LockFlightData();
+  memcpy(&CALCULATED_INFO, &calculated, sizeof(DERIVED_INFO));
+  UnlockFlightData();
+}
+
+void calculation_pipeline::calculate_slow() {
+  if (needcalculationsslow || (SIMMODE && ReplayLogger::IsEnabled())) {
+    DoCalculationsSlow(&basic, &calculated);
+    needcalculationsslow = false;
+
+    LockFlightData();
+    memcpy(&CALCULATED_INFO, &calculated, sizeof(DERIVED_INFO));
+    UnlockFlightData();
+  }
+
+  // headless consumer of warning queue, instead of ShowAirspaceWarningsToUser()
+  AirspaceWarningMessage msg;
+  while (CAirspaceManager::Instance().PopWarningMessage(&msg)) {
+    ++airspace_warnings;
+  }
+}
+
+} // namespace headless
@@ -0,0 +1,68 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   Headless.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _HEADLESS_H_
+#define _HEADLESS_H_
+
+#include <tchar.h>
+#include "NMEA/Info.h"
+#include "NMEA/Derived.h"
+
+/**
+ * Calculation pipeline without window, draw thread nor calculation thread.
+ *
+ * Shared by headless replay (lkreplay.cpp) and calculation benchmark
+ * (tests/benchmark).
+ */
+namespace headless {
+
+/**
+ * Same initialisation as Startup(), without anything related to screen,
+ * devices, sound or tracking.
+ *
+ * @param profile profile file to load instead of default one, can be nullptr.
+ */
+void initialise(const TCHAR* profile);
+
+/**
+ * One iteration of CalculationThread::Run, without anything related to draw
+ * thread, devices or tracking.
+ *
+ * `run()` is `calculate()` followed by `calculate_slow()`, both are public to
+ * allow caller to time them separately.
+ */
+class calculation_pipeline final {
+ public:
+  void run() {
+    calculate();
+    calculate_slow();
+  }
+
+  /**
+   * copy of GPS_INFO and CALCULATED_INFO, DoCalculationsVario and DoCalculations
+   */
+  void calculate();
+
+  /**
+   * DoCalculationsSlow if required and consume airspace warnings.
+   */
+  void calculate_slow();
+
+  NMEA_INFO basic = {};
+  DERIVED_INFO calculated = {};
+  unsigned airspace_warnings = 0;
+
+ private:
+  bool needcalculationsslow = false;
+};
+
+} // namespace headless
+
+#endif // _HEADLESS_H_
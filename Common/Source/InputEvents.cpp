@@ -39,6 +39,7 @@
 #include "utils/lookup_table.h"
 #include <type_traits>
 #include "Waypoints/SetHome.h"
+#include "Profiler.h"
 // uncomment for show all menu button with id as Label.
 //#define TEST_MENU_LAYOUT
 
@@ -1825,6 +1826,24 @@ void InputEvents::eventService(const TCHAR *misc) {
 	return;
   }
 
+  if (_tcscmp(misc, TEXT("PROFILER")) == 0) {
+    profiler::hud_enabled = !profiler::hud_enabled;
+    MapWindow::RefreshMap();
+    return;
+  }
+
+  if (_tcscmp(misc, TEXT("PROFILERDUMP")) == 0) {
+    TCHAR file_path[MAX_PATH];
+    LocalPath(file_path, _T(LKD_LOGS), _T("profiler.csv"));
+    if (profiler::dump_csv(file_path)) {
+      StartupStore(_T(". Profiler stats saved to %s"), file_path);
+    } else {
+      StartupStore(_T("... Failed to write profiler stats to %s"), file_path);
+    }
+    profiler::reset();
+    return;
+  }
+
   if (_tcscmp(misc, TEXT("ORBITER")) == 0) {
 	Orbiter=!Orbiter;
 	if (Orbiter)
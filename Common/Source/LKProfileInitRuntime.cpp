@@ -10,6 +10,7 @@
 #include "LKProfiles.h"
 #include "McReady.h"
 #include "Modeltype.h"
+#include "Sound/Sound.h"
 
 
 //
@@ -152,4 +153,5 @@ void LKProfileInitRuntime() {
   UpdateConfIP();
   UpdateMultimapOrient();
 
+  AudioVarioConfigure();
 }
@@ -791,6 +791,19 @@ void LKParseProfileString(const char *sname, const char *svalue) {
 #endif
   if (settings::read(sname, svalue, szRegistryAutoContrast, AutoContrast)) return;
   if (settings::read(sname, svalue, szRegistryEnableAudioVario, EnableAudioVario)) return;
+  // We save audio vario thresholds multiplied by 10, so we adjust them back after loading
+  if (settings::read(sname, svalue, szRegistryAudioVarioLiftThreshold, AudioVarioLiftThreshold)) {
+    AudioVarioLiftThreshold /= 10;
+    return;
+  }
+  if (settings::read(sname, svalue, szRegistryAudioVarioSinkThreshold, AudioVarioSinkThreshold)) {
+    AudioVarioSinkThreshold /= 10;
+    return;
+  }
+  if (settings::read(sname, svalue, szRegistryAudioVarioLiftToneLow, AudioVarioLiftToneLow)) return;
+  if (settings::read(sname, svalue, szRegistryAudioVarioLiftToneHigh, AudioVarioLiftToneHigh)) return;
+  if (settings::read(sname, svalue, szRegistryAudioVarioSinkTone, AudioVarioSinkTone)) return;
+  if (settings::read(sname, svalue, szRegistryAudioVarioVolume, AudioVarioVolume)) return;
 
   if (SaveRuntime && !IsEmbedded()) {
     // Do NOT load resolution from profile, if we have requested a resolution from command line
@@ -487,6 +487,12 @@ void LKProfileResetDefault() {
   TerrainWhiteness=1;
 
   EnableAudioVario = false;
+  AudioVarioLiftThreshold = 0.2; // This is saved *10 and loaded /10
+  AudioVarioSinkThreshold = -2.; // This is saved *10 and loaded /10
+  AudioVarioLiftToneLow = 600;
+  AudioVarioLiftToneHigh = 1200;
+  AudioVarioSinkTone = 400;
+  AudioVarioVolume = 50;
 
   ModelType::ResetSettings();
 
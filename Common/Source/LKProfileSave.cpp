@@ -380,6 +380,12 @@ void LKProfileSave(const TCHAR *szFile) {
 
   write_settings(szRegistryAdditionalContestRule, AdditionalContestRule);
   write_settings(szRegistryEnableAudioVario, EnableAudioVario);
+  write_settings(szRegistryAudioVarioLiftThreshold, AudioVarioLiftThreshold * 10);
+  write_settings(szRegistryAudioVarioSinkThreshold, AudioVarioSinkThreshold * 10);
+  write_settings(szRegistryAudioVarioLiftToneLow, AudioVarioLiftToneLow);
+  write_settings(szRegistryAudioVarioLiftToneHigh, AudioVarioLiftToneHigh);
+  write_settings(szRegistryAudioVarioSinkTone, AudioVarioSinkTone);
+  write_settings(szRegistryAudioVarioVolume, AudioVarioVolume);
 
 #ifdef _WGS84
   write_settings(szRegistry_earth_model_wgs84, earth_model_wgs84);
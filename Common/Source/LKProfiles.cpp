@@ -551,3 +551,9 @@ const char szRegistry_earth_model_wgs84[] = "earth_model_wgs84";
 #endif
 const char szRegistrySoundSwitch[] = "SoundSwitch";
 const char szRegistryEnableAudioVario[] = "EnableAudioVario";
+const char szRegistryAudioVarioLiftThreshold[] = "AudioVarioLiftThreshold";
+const char szRegistryAudioVarioSinkThreshold[] = "AudioVarioSinkThreshold";
+const char szRegistryAudioVarioLiftToneLow[] = "AudioVarioLiftToneLow";
+const char szRegistryAudioVarioLiftToneHigh[] = "AudioVarioLiftToneHigh";
+const char szRegistryAudioVarioSinkTone[] = "AudioVarioSinkTone";
+const char szRegistryAudioVarioVolume[] = "AudioVarioVolume";
@@ -155,3 +155,20 @@ void SimFlarmTraffic(uint32_t RadioId, double offset)
   }
 }
 
+
+// Number of synthetic targets added by SimFlarmTrafficLoad, set by -simtraffic=n command line.
+unsigned SimTrafficLoad = 0;
+
+//
+// Synthetic load to test traffic slots, up to FLARM_MAX_TRAFFIC targets.
+// Same locking rules than SimFlarmTraffic.
+//
+void SimFlarmTrafficLoad(unsigned count)
+{
+  // RadioId range not used by real traffic in simulator
+  constexpr uint32_t first_id = 0x800000;
+
+  for (unsigned i=0; i<count; i++) {
+	SimFlarmTraffic(first_id + i, (double)(i % 97));
+  }
+}
@@ -31,6 +31,8 @@
 #define STALLSPEED	Units::To(Units_t::unKiloMeterPerHour, GlidePolar::Vminsink())*0.6
 
 extern void SimFlarmTraffic(uint32_t RadioId, double offset);
+extern void SimFlarmTrafficLoad(unsigned count);
+extern unsigned SimTrafficLoad;
 
 // WE DONT USE LANDING, CRASHING AND FULL STALL SIMULATION NOW
 // #define SIMLANDING	1
@@ -170,6 +172,9 @@ void LKSimulator(void) {
 		SimFlarmTraffic(0xdd8944,0);
 		SimFlarmTraffic(0xdd8a43,0);
 	}
+	if (SimTrafficLoad) {
+		SimFlarmTrafficLoad(SimTrafficLoad);
+	}
   }
 
   if (ISPARAGLIDER || ISGLIDER) {
@@ -8,6 +8,8 @@
 
 #include "externs.h"
 #include "NavFunctions.h"
+#include "Geographic/GeoPoint.h"
+#include "Geographic/SphereBatch.h"
 #include <cmath>
 
 #ifdef _WGS84
@@ -68,6 +70,38 @@ void DistanceBearing(double lat1, double lon1, double lat2, double lon2,
 }
 
 
+void DistanceBearing(const GeoPoint& origin, const GeoPoint* dest, size_t count,
+                     double *Distance, double *Bearing) {
+#ifdef _WGS84
+  if(earth_model_wgs84) {
+    // no batch algorithm for ellipsoid, only avoid per point overhead.
+    double t;
+    unsigned outmask = 0;
+    if(Distance) {
+      outmask |= Geodesic::DISTANCE;
+    }
+    if(Bearing) {
+      outmask |= Geodesic::AZIMUTH;
+    }
+    const Geodesic& geod = Geodesic::WGS84();
+    for (size_t i = 0; i < count; ++i) {
+      double distance, bearing;
+      geod.GenInverse(origin.latitude, origin.longitude, dest[i].latitude, dest[i].longitude,
+                      outmask, distance, bearing, t, t, t, t, t);
+      if(Distance) {
+        Distance[i] = distance;
+      }
+      if(Bearing) {
+        Bearing[i] = AngleLimit360(bearing);
+      }
+    }
+    return;
+  }
+#endif
+  sphere::DistanceBearing(origin, dest, count, Distance, Bearing);
+}
+
+
 double DoubleDistance(double lat1, double lon1, double lat2, double lon2,
 		      double lat3, double lon3) {
 #ifdef _WGS84
@@ -148,6 +182,20 @@ void FindLatitudeLongitude(double Lat, double Lon,
   }
 }
 
+void FindLatitudeLongitude(const GeoPoint& origin, const double *Bearing, const double *Distance,
+                           size_t count, GeoPoint *out) {
+#ifdef _WGS84
+  if(earth_model_wgs84) {
+    const Geodesic& geod = Geodesic::WGS84();
+    for (size_t i = 0; i < count; ++i) {
+      geod.Direct(origin.latitude, origin.longitude, Bearing[i], Distance[i], out[i].latitude, out[i].longitude);
+    }
+    return;
+  }
+#endif
+  sphere::FindLatitudeLongitude(origin, Bearing, Distance, count, out);
+}
+
 void xXY_Brg_Rng(double X_1, double Y_1, double X_2, double Y_2, double *Bearing, double *Range)
 {
   double  Rad_Bearing;
@@ -295,3 +343,95 @@ void LatLon2Flat(double lon, double lat, int *scx, int *scy) {
   *scx = (int)(lon*fastcosine(lat)*100);
   *scy = (int)(lat*100);
 }
+
+#ifndef DOCTEST_CONFIG_DISABLE
+#include <doctest/doctest.h>
+#include <utility>
+#include <vector>
+
+TEST_CASE("batch geodesic") {
+
+  auto angle_diff = [](double a, double b) {
+    return std::fabs(std::remainder(a - b, 360.));
+  };
+
+  SUBCASE("FAI sphere") {
+    const bool old_model = std::exchange(earth_model_wgs84, false);
+
+    const GeoPoint origin = { 45.8, 6.9 };
+
+    std::vector<double> bearing;
+    std::vector<double> distance;
+    for (double b = 0; b < 360.; b += 7.5) {
+      for (double d : { 0., 1., 850., 25000., 300000., 2500000., 15000000. }) {
+        bearing.push_back(b);
+        distance.push_back(d);
+      }
+    }
+    const size_t count = bearing.size();
+
+    std::vector<GeoPoint> points(count);
+    FindLatitudeLongitude(origin, bearing.data(), distance.data(), count, points.data());
+
+    std::vector<double> batch_distance(count);
+    std::vector<double> batch_bearing(count);
+    DistanceBearing(origin, points.data(), count, batch_distance.data(), batch_bearing.data());
+
+    for (size_t i = 0; i < count; ++i) {
+      double lat, lon;
+      FindLatitudeLongitude(origin.latitude, origin.longitude, bearing[i], distance[i], &lat, &lon);
+      CHECK(points[i].latitude == doctest::Approx(lat).epsilon(1e-12));
+      CHECK(angle_diff(points[i].longitude, lon) < 1e-9);
+
+      double d, b;
+      DistanceBearing(origin.latitude, origin.longitude, points[i].latitude, points[i].longitude, &d, &b);
+      CHECK(std::fabs(batch_distance[i] - d) < 1e-6);
+      if (distance[i] > 0) {
+        CHECK(angle_diff(batch_bearing[i], b) < 1e-6);
+        CHECK(angle_diff(batch_bearing[i], bearing[i]) < 1e-6);
+        CHECK(std::fabs(batch_distance[i] - distance[i]) < 1e-3);
+      }
+    }
+
+    // null output
+    DistanceBearing(origin, points.data(), count, nullptr, batch_bearing.data());
+    DistanceBearing(origin, points.data(), count, batch_distance.data(), nullptr);
+
+    earth_model_wgs84 = old_model;
+  }
+
+#ifdef _WGS84
+  SUBCASE("WGS84") {
+    const bool old_model = std::exchange(earth_model_wgs84, true);
+
+    // computed using GeographicLib Geodesic::WGS84().Direct()
+    const GeoPoint origin = { 45.5, 7.25 };
+    const double bearing[] = { 30., 200., 95., 315. };
+    const double distance[] = { 12000., 85000., 600000., 9900000. };
+    const GeoPoint expected[] = {
+      { 45.593478509, 7.326894834 },
+      { 44.780690973, 6.882695656 },
+      { 44.776979194, 14.812337582 },
+      { 30.627686860, -117.425281017 },
+    };
+
+    GeoPoint points[std::size(expected)];
+    FindLatitudeLongitude(origin, bearing, distance, std::size(expected), points);
+
+    double batch_distance[std::size(expected)];
+    double batch_bearing[std::size(expected)];
+    DistanceBearing(origin, expected, std::size(expected), batch_distance, batch_bearing);
+
+    for (size_t i = 0; i < std::size(expected); ++i) {
+      CHECK(points[i].latitude == doctest::Approx(expected[i].latitude).epsilon(1e-9));
+      CHECK(points[i].longitude == doctest::Approx(expected[i].longitude).epsilon(1e-9));
+      CHECK(batch_distance[i] == doctest::Approx(distance[i]).epsilon(1e-7));
+      CHECK(angle_diff(batch_bearing[i], bearing[i]) < 1e-6);
+    }
+
+    earth_model_wgs84 = old_model;
+  }
+#endif
+}
+
+#endif
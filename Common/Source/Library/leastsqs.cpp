@@ -53,6 +53,7 @@ void LeastSquares::Reset() {
   x_min = 0;
   x_max = 0;
   y_ave = 0;
+  series.clear();
 }
 
 
@@ -77,12 +78,7 @@ void LeastSquares::least_squares_add(double x, double y, double weight) {
       x_min = x;
     }
 
-    // TODO code: really should have a circular buffer here
-    if (sum_n<MAX_STATISTICS) {
-      xstore[sum_n] = (float)x;
-      ystore[sum_n] = (float)y;
-      weightstore[sum_n] = (float)weight;
-    }
+    series.append(x, y);
 
     ++sum_n;
 
@@ -30,7 +30,12 @@ bool ReplayLogger::ReadLine(TCHAR *buffer) {
     if (_tcslen(FileName)>0) {
 
       TCHAR szFilePath[MAX_PATH];
-      LocalPath(szFilePath, _T(LKD_LOGS), FileName);
+      if (FileName[0] == _T('/')) {
+        // absolute path, given by headless replay command line
+        _tcscpy(szFilePath, FileName);
+      } else {
+        LocalPath(szFilePath, _T(LKD_LOGS), FileName);
+      }
 
       fp = _tfopen(szFilePath, TEXT("rt"));
     }
@@ -139,6 +144,7 @@ bool ReplayLogger::ReadPoint(double *Time,
 TCHAR ReplayLogger::FileName[MAX_PATH+1];
 bool ReplayLogger::Enabled = false;
 double ReplayLogger::TimeScale = 1.0;
+double ReplayLogger::SimulatedStep = 0.0;
 
 bool ReplayLogger::IsEnabled(void) {
   return Enabled;
@@ -342,7 +348,13 @@ bool ReplayLogger::UpdateInternal(void) {
     cli.Reset();
   }
 
-  ReplayTime += TimeScale*deltatimereal;
+  if (SimulatedStep > 0) {
+    if (!init) {
+      ReplayTime += SimulatedStep;
+    }
+  } else {
+    ReplayTime += TimeScale*deltatimereal;
+  }
 
 #if DEBUG_REPLAY
   TCHAR tutc[20];
@@ -19,6 +19,7 @@
 #include "Kobo/Model.hpp"
 #include "Util/Clamp.hpp"
 #include "Asset.hpp"
+#include "Profiler.h"
 #include <utility>
 #include <type_traits>
 #include <memory>
@@ -1109,6 +1110,8 @@ bool DrawTerrain(LKSurface& Surface, const RECT& rc, const ScreenProjection& _Pr
         const double sunazimuth, const double sunelevation) {
     (void) sunelevation; // TODO feature: sun-based rendering option
 
+    const profiler::scoped_timer timer(profiler::probe::DrawTerrain);
+
     if (!RasterTerrain::isTerrainLoaded()) {
         return false;
     }
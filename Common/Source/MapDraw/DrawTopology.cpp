@@ -9,6 +9,7 @@
 #include "externs.h"
 #include "Terrain.h"
 #include "Topology/ShapeSpecialRenderer.h"
+#include "Profiler.h"
 
 
 Topology* TopoStore[MAXTOPOLOGY] = {};
@@ -16,6 +17,8 @@ Topology* TopoStore[MAXTOPOLOGY] = {};
 
 void DrawTopology(LKSurface& Surface, const RECT& rc, const ScreenProjection& _Proj, const bool wateronly)
 {
+  const profiler::scoped_timer timer(profiler::probe::DrawTopology);
+
   LockTerrainDataGraphics();
   static ShapeSpecialRenderer renderer;
   for(const Topology* topo: TopoStore) {
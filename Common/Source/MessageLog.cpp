@@ -12,6 +12,11 @@
 #include "utils/stringext.h"
 #include "utils/unique_file_ptr.h"
 #include "OS/Memory.h"
+#include "utils/log_writer.h"
+#include <cstdlib>
+#ifndef WIN32
+#include <unistd.h>
+#endif
 
 #ifdef ANDROID
 #include <android/log.h>
@@ -46,11 +51,132 @@ void DebugStore(const char* fmt, ...) {
 #endif
 }
 
+namespace {
+
+struct log_line_t {
+  unsigned time; // MonotonicClockMS() of StartupStore call
+  char text[1024]; // utf-8
+};
+
+/**
+ * Runtime.log file, output of `log_writer`.
+ *
+ * File is kept open between lines, flushed after each batch, and rotated
+ * when it exceeds MAX_LOG_SIZE.
+ */
+class run_log_file final {
+ public:
+  run_log_file() {
+    LocalPath(file_name, TEXT(LKF_RUNLOG));
+    LocalPath(old_file_name, TEXT(LKF_RUNLOG ".old"));
+    if (lk::filesystem::getFileSize(file_name) > MAX_LOG_SIZE) {
+      rotate();
+    }
+  }
+
+  void write(const log_line_t& line) {
+    if (line.text[0]) {
+      write_line(line.time, line.text);
+    }
+  }
+
+  void lost(unsigned count) {
+    char text[64];
+    snprintf(text, std::size(text), ". %u log lines lost, queue full", count);
+    write_line(MonotonicClockMS(), text);
+  }
+
+  void flush(bool sync) {
+    if (file) {
+      fflush(file.get());
+#ifndef WIN32
+      if (sync) {
+        fsync(fileno(file.get()));
+      }
+#endif
+    }
+    if (file_size > MAX_LOG_SIZE) {
+      rotate();
+    }
+  }
+
+ private:
+  void rotate() {
+    file.reset();
+    lk::filesystem::deleteFile(old_file_name);
+    lk::filesystem::moveFile(file_name, old_file_name);
+    file_size = 0;
+  }
+
+  void write_line(unsigned time, const char* text) {
+    if (!file) {
+      file = make_unique_file_ptr(file_name, TEXT("ab+"));
+      if (!file) {
+        return;
+      }
+      file_size = lk::filesystem::getFileSize(file_name);
+    }
+    const int size = fprintf(file.get(), "[%09u] %s" SNEWLINE, time, text);
+    if (size > 0) {
+      file_size += size;
+    }
+  }
+
+  TCHAR file_name[MAX_PATH];
+  TCHAR old_file_name[MAX_PATH];
+  unique_file_ptr file;
+  size_t file_size = 0;
+};
+
+/**
+ * Runtime.log writer.
+ *
+ * Log lines are queued by calling thread and written by a background thread
+ * ( `log_writer` ) : StartupStore never waits for storage, even while device
+ * threads flood the log.
+ *
+ * After program exit ( atexit ), lines are written by calling thread.
+ */
+class run_log final {
+ public:
+  static run_log& instance() {
+    // never deleted : StartupStore can be called from static destructors
+    static run_log* log = create();
+    return *log;
+  }
+
+  void push(const log_line_t& line) {
+    writer.push(line);
+  }
+
+  /**
+   * write pending lines and sync file, from calling thread.
+   */
+  void flush() {
+    writer.flush();
+  }
+
+ private:
+  run_log() : writer(file) {}
+
+  static run_log* create() {
+    run_log* log = new run_log();
+    if (log->writer.start()) {
+      std::atexit([] {
+        instance().writer.stop();
+      });
+    }
+    return log;
+  }
+
+  run_log_file file;
+  log_writer<log_line_t, 256, run_log_file> writer;
+};
+
+} // namespace
+
 void StartupStoreV(const TCHAR* fmt, va_list args)
 {
-  static Mutex mutex;
-  ScopeLock Lock(mutex);
-
   TCHAR buf[1024]; // 2 kByte for unicode, 1kByte for utf-8
 
   _vsntprintf(buf, std::size(buf), fmt, args);
@@ -64,43 +190,16 @@ void StartupStoreV(const TCHAR* fmt, va_list args)
 #elif defined(__linux__) && !defined(NDEBUG)
   printf("%s\n", buf);
 #endif
-  
 
-  static TCHAR szFileName[MAX_PATH];
-  static bool initialised = false;
-  if (!initialised) {
-    LocalPath(szFileName, TEXT(LKF_RUNLOG));
-
-    // rotate log
-    size_t filesize = lk::filesystem::getFileSize(szFileName);
-    if(filesize > MAX_LOG_SIZE) {
-      TCHAR szFileNameOld[MAX_PATH];
-      LocalPath(szFileNameOld, TEXT(LKF_RUNLOG ".old"));
-      lk::filesystem::deleteFile(szFileNameOld);
-      lk::filesystem::moveFile(szFileName, szFileNameOld);
-    }
+  log_line_t line;
+  line.time = MonotonicClockMS();
+  to_utf8(buf, line.text);
 
-    initialised = true;
-  }
-
-  auto startupStoreFile = make_unique_file_ptr(szFileName, TEXT("ab+"));
-  if (startupStoreFile) {
-#ifdef UNICODE
-    /* each codepoints can be encoded in one to four bytes.
-    * worst case : ( <number of codepoint> x 4 ) + <size of '\0'>
-    */
-    const size_t buff_size = (_tcslen(buf) * 4) + 1; // (max 4kByte + 1Byte)
-    char sbuf[buff_size]; 
-    size_t i = to_utf8(buf, sbuf, buff_size);
-#else
-    const char* sbuf = buf; // string is already utf-8 encoded, no need to convert.
-    size_t i = strlen(sbuf);
-#endif
+  run_log::instance().push(line);
+}
 
-    if (i > 0) {
-      fprintf(startupStoreFile.get(), "[%09u] %s" SNEWLINE, MonotonicClockMS(), sbuf);
-    }
-  }
+void StartupStoreFlush() {
+  run_log::instance().flush();
 }
 
 tstring toHexString(const void* data, size_t size) {
@@ -46,6 +46,12 @@ inline void DebugLog(const TCHAR* fmt, ...)
 
 void StartupStoreV(const TCHAR* fmt, va_list ap);
 
+/**
+ * Runtime.log lines are written asynchronously : write pending lines to
+ * storage now, before abort or to be sure a critical message is saved.
+ */
+void StartupStoreFlush();
+
 
 void StartupStore(const TCHAR* fmt, ...) {
     va_list ap;
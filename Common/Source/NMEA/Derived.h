@@ -21,7 +21,7 @@
 
 // number of radials to do range footprint calculation on
 #ifndef UNDER_CE
-#define NUMTERRAINSWEEPS 40
+#define NUMTERRAINSWEEPS 72
 #else
 #define NUMTERRAINSWEEPS 20
 #endif
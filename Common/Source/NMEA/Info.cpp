@@ -8,10 +8,39 @@
  */
 
 #include "Info.h"
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include "Logger.h"
 #include "../Comm/device.h"
 
+namespace {
+
+// size of members before FLARM_Traffic, last member of NMEA_INFO.
+// not `offsetof` : NMEA_INFO is not standard-layout ( FANET_WEATHER ... )
+size_t prefix_size(const NMEA_INFO& info) {
+  return reinterpret_cast<const char*>(info.FLARM_Traffic) - reinterpret_cast<const char*>(&info);
+}
+
+size_t traffic_size(const NMEA_INFO& a, const NMEA_INFO& b) {
+  const unsigned end = std::max(a.FLARM_TrafficEnd, b.FLARM_TrafficEnd);
+  return std::min<unsigned>(end, FLARM_MAX_TRAFFIC) * sizeof(FLARM_TRAFFIC);
+}
+
+} // namespace
+
+void CopyInfo(NMEA_INFO& dst, const NMEA_INFO& src) {
+  // slots of <dst> up to its old end are overwritten, by empty slot if needed.
+  const size_t size = traffic_size(dst, src);
+  memcpy(&dst, &src, prefix_size(src));
+  memcpy(dst.FLARM_Traffic, src.FLARM_Traffic, size);
+}
+
+bool SameInfo(const NMEA_INFO& a, const NMEA_INFO& b) {
+  return memcmp(&a, &b, prefix_size(a)) == 0
+      && memcmp(a.FLARM_Traffic, b.FLARM_Traffic, traffic_size(a, b)) == 0;
+}
+
 void ResetHeartRateAvailable(NMEA_INFO& info) {
     info.HeartRateIdx = NUMDEV;
 }
@@ -11,6 +11,7 @@
 
 #include "tchar.h"
 #include "Flarm.h"
+#include "FlarmSlotIndex.h"
 #include "Devices/Fanet/Fanet.h"
 #include "Geographic/GeoPoint.h"
 
@@ -91,7 +92,8 @@ struct NMEA_INFO {
 
     double FLARM_SW_Version;
     double FLARM_HW_Version;
-    FLARM_TRAFFIC FLARM_Traffic[FLARM_MAX_TRAFFIC];
+    flarm_slot_index<FLARM_MAX_TRAFFIC> FLARM_SlotIndex; // RadioId => FLARM_Traffic index
+    unsigned FLARM_TrafficEnd; // FLARM_Traffic slots from this one are empty
     FLARM_TRACE	FLARM_RingBuf[MAX_FLARM_TRACES];
     bool FLARMTRACE_bBuffFull;
     int  FLARMTRACE_iLastPtr;
@@ -109,6 +111,9 @@ struct NMEA_INFO {
 
     unsigned HeartRateIdx;
     unsigned HeartRate;
+
+    // must be last : CopyInfo() skip empty slots at end of table.
+    FLARM_TRAFFIC FLARM_Traffic[FLARM_MAX_TRAFFIC];
 };
 
 static_assert(std::is_trivial_v<NMEA_INFO>, "mandatory while memset/memcpy is used to init/copy this struct");
@@ -118,6 +123,21 @@ AGeoPoint GetCurrentPosition(const NMEA_INFO& Info) {
   return {{ Info.Latitude, Info.Longitude }, Info.Altitude };
 }
 
+/**
+ * copy <src> to <dst>, without FLARM_Traffic slots above `FLARM_TrafficEnd`
+ * of both : they are empty.
+ *
+ * to use instead of memcpy, <dst> must be zero initialized or only written by
+ * this function.
+ */
+void CopyInfo(NMEA_INFO& dst, const NMEA_INFO& src);
+
+/**
+ * @return true if <a> and <b> are equal, content of empty FLARM_Traffic slots
+ *         above `FLARM_TrafficEnd` of both is ignored.
+ */
+bool SameInfo(const NMEA_INFO& a, const NMEA_INFO& b);
+
 void ResetHeartRateAvailable(NMEA_INFO& info);
 bool HeartRateAvailable(const NMEA_INFO& info);
 void UpdateHeartRate(NMEA_INFO& info, const DeviceDescriptor_t& d, unsigned bpm);
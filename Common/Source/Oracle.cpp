@@ -11,6 +11,8 @@
 #include "Waypointparser.h"
 #include "Dialogs.h"
 #include "Topology.h"
+#include "Topology/nearest_shape.h"
+#include "Geographic/LocalFrame.h"
 #include "Terrain.h"
 #include "Draw/ScreenProjection.h"
 #include "LKStyle.h"
@@ -286,29 +288,28 @@ void WhereAmI::Run() {
   unsigned idx_nearest_airport = 0;
   unsigned idx_nearest_unknown = 0;
   {
-    double dist_airport = std::numeric_limits<double>::max();
-    double dist_unknown = std::numeric_limits<double>::max();
+    const LocalFrame frame({GPS_INFO.Latitude, GPS_INFO.Longitude});
+
+    topology::nearest_list<unsigned, 1> nearest_airport;
+    topology::nearest_list<unsigned, 1> nearest_unknown;
 
     for(unsigned i=NUMRESWP; i<WayPointList.size(); ++i) {
 
         if(WayPointList[i].Style == STYLE_THERMAL) continue;
 
-        DistanceBearing(GPS_INFO.Latitude, GPS_INFO.Longitude,
-                      WayPointList[i].Latitude, WayPointList[i].Longitude,
-                      &(WayPointCalc[i].Distance), &(WayPointCalc[i].Bearing));
-
-        if(WayPointCalc[i].Distance > 70000) continue; // To Far
+        const double distance = frame.Distance({WayPointList[i].Latitude, WayPointList[i].Longitude});
+        if(distance > 70000) continue; // To Far
 
         if(WayPointCalc[i].WpType == WPT_AIRPORT) {
-            if(WayPointCalc[i].Distance < dist_airport) {
-                dist_airport = WayPointCalc[i].Distance;
-                idx_nearest_airport = i;
-            }
-        }
-        if(WayPointCalc[i].Distance < dist_unknown) {
-            dist_unknown = WayPointCalc[i].Distance;
-            idx_nearest_unknown = i;
+            nearest_airport.insert(distance, i);
         }
+        nearest_unknown.insert(distance, i);
+    }
+    if (!nearest_airport.empty()) {
+        idx_nearest_airport = nearest_airport[0].value;
+    }
+    if (!nearest_unknown.empty()) {
+        idx_nearest_unknown = nearest_unknown[0].value;
     }
   }
 
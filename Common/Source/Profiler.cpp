@@ -0,0 +1,227 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   Profiler.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "options.h"
+#include "Profiler.h"
+#include "utils/unique_file_ptr.h"
+#include "utils/stringext.h"
+#include <array>
+#include <limits>
+
+namespace profiler {
+
+std::atomic<bool> hud_enabled = false;
+
+namespace {
+
+/*
+ * 4 buckets by power of 2 : relative error of percentile is less than 25%
+ *   [0..3] : 1 µs width
+ *   [4..7] : 4, 5, 6, 7
+ *   [8..11] : 8-9, 10-11, 12-13, 14-15
+ *   ...
+ */
+constexpr unsigned sub_bits = 2;
+constexpr unsigned sub_count = 1U << sub_bits;
+constexpr unsigned bucket_count = (32 - sub_bits + 1) * sub_count;
+
+constexpr unsigned log2(unsigned value) {
+  unsigned result = 0;
+  while (value >>= 1) {
+    ++result;
+  }
+  return result;
+}
+
+constexpr unsigned bucket_index(unsigned value) {
+  if (value < sub_count) {
+    return value;
+  }
+  const unsigned exp = log2(value);
+  const unsigned sub = (value >> (exp - sub_bits)) & (sub_count - 1);
+  return ((exp - sub_bits + 1) << sub_bits) + sub;
+}
+
+/**
+ * @return highest value stored in bucket <index>
+ */
+constexpr unsigned bucket_value(unsigned index) {
+  if (index < sub_count) {
+    return index;
+  }
+  const unsigned exp = (index >> sub_bits) + sub_bits - 1;
+  const unsigned sub = index & (sub_count - 1);
+  const uint64_t lower = static_cast<uint64_t>(sub_count + sub) << (exp - sub_bits);
+  const uint64_t width = uint64_t(1) << (exp - sub_bits);
+  return static_cast<unsigned>(std::min<uint64_t>(lower + width - 1, std::numeric_limits<unsigned>::max()));
+}
+
+static_assert(bucket_index(std::numeric_limits<unsigned>::max()) == bucket_count - 1, "invalid bucket_count");
+
+struct histogram_t {
+  std::atomic<uint64_t> total = 0;
+  std::atomic<unsigned> max = 0;
+  std::array<std::atomic<unsigned>, bucket_count> buckets = {};
+};
+
+std::array<histogram_t, static_cast<unsigned>(probe::count)> histograms;
+
+histogram_t& get_histogram(probe id) {
+  return histograms[static_cast<unsigned>(id)];
+}
+
+unsigned percentile(const std::array<unsigned, bucket_count>& buckets, unsigned count, unsigned percent) {
+  const uint64_t rank = (static_cast<uint64_t>(count) * percent + 99) / 100;
+  uint64_t sum = 0;
+  for (unsigned i = 0; i < bucket_count; ++i) {
+    sum += buckets[i];
+    if (sum >= rank) {
+      return bucket_value(i);
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
+const TCHAR* name(probe id) {
+  switch (id) {
+    case probe::RenderMapWindowBg:
+      return _T("RenderMap");
+    case probe::DrawTerrain:
+      return _T("Terrain");
+    case probe::DrawTopology:
+      return _T("Topology");
+    case probe::DrawAirSpace:
+      return _T("Airspace");
+    case probe::DrawWaypoints:
+      return _T("Waypoints");
+    case probe::DrawTrail:
+      return _T("Trail");
+    case probe::DrawTraffic:
+      return _T("Traffic");
+    case probe::DoCalculations:
+      return _T("Calc");
+    case probe::DoCalculationsSlow:
+      return _T("CalcSlow");
+    case probe::FrameAllocations:
+      return _T("HeapAlloc");
+    case probe::AudioVarioLatency:
+      return _T("AudioVario");
+    case probe::count:
+      break;
+  }
+  return _T("");
+}
+
+void add(probe id, unsigned elapsed_us) {
+  histogram_t& histogram = get_histogram(id);
+  histogram.buckets[bucket_index(elapsed_us)].fetch_add(1, std::memory_order_relaxed);
+  histogram.total.fetch_add(elapsed_us, std::memory_order_relaxed);
+
+  unsigned max = histogram.max.load(std::memory_order_relaxed);
+  while (max < elapsed_us && !histogram.max.compare_exchange_weak(max, elapsed_us, std::memory_order_relaxed)) {
+    // max updated by compare_exchange_weak
+  }
+}
+
+stats_t get_stats(probe id) {
+  const histogram_t& histogram = get_histogram(id);
+
+  // snapshot, can be slightly inconsistent if probe is updated meanwhile.
+  std::array<unsigned, bucket_count> buckets;
+  unsigned count = 0;
+  for (unsigned i = 0; i < bucket_count; ++i) {
+    buckets[i] = histogram.buckets[i].load(std::memory_order_relaxed);
+    count += buckets[i];
+  }
+
+  if (count == 0) {
+    return {};
+  }
+
+  // mean use snapshot count : it's never 0 here, even if reset() is called meanwhile.
+  return {
+    count,
+    static_cast<unsigned>(histogram.total.load(std::memory_order_relaxed) / count),
+    histogram.max.load(std::memory_order_relaxed),
+    percentile(buckets, count, 50),
+    percentile(buckets, count, 95),
+    percentile(buckets, count, 99)
+  };
+}
+
+void reset() {
+  for (auto& histogram : histograms) {
+    histogram.total = 0;
+    histogram.max = 0;
+    for (auto& bucket : histogram.buckets) {
+      bucket = 0;
+    }
+  }
+}
+
+bool dump_csv(const TCHAR* file_path) {
+  unique_file_ptr file = make_unique_file_ptr(file_path, _T("w"));
+  if (!file) {
+    return false;
+  }
+  fprintf(file.get(), "probe,count,mean_us,p50_us,p95_us,p99_us,max_us\n");
+  for (unsigned i = 0; i < static_cast<unsigned>(probe::count); ++i) {
+    const probe id = static_cast<probe>(i);
+    const stats_t stats = get_stats(id);
+    char utf8_name[32];
+    to_utf8(name(id), utf8_name);
+    fprintf(file.get(), "%s,%u,%u,%u,%u,%u,%u\n", utf8_name,
+            stats.count, stats.mean, stats.p50, stats.p95, stats.p99, stats.max);
+  }
+  return true;
+}
+
+} // namespace profiler
+
+#ifndef DOCTEST_CONFIG_DISABLE
+#include <doctest/doctest.h>
+
+TEST_CASE("profiler") {
+
+  SUBCASE("histogram buckets") {
+    using namespace profiler;
+    for (unsigned value : { 0U, 1U, 3U, 4U, 7U, 8U, 9U, 15U, 1000U, 65535U, 1000000U }) {
+      const unsigned index = bucket_index(value);
+      CHECK(bucket_value(index) >= value);
+      if (index > 0) {
+        CHECK(bucket_value(index - 1) < value);
+      }
+    }
+    CHECK(bucket_index(std::numeric_limits<unsigned>::max()) == bucket_count - 1);
+  }
+
+  SUBCASE("stats") {
+    using profiler::probe;
+    profiler::reset();
+    for (unsigned i = 1; i <= 100; ++i) {
+      profiler::add(probe::DrawTerrain, i * 100);
+    }
+    const profiler::stats_t stats = profiler::get_stats(probe::DrawTerrain);
+    CHECK(stats.count == 100);
+    CHECK(stats.mean == 5050);
+    CHECK(stats.max == 10000);
+    CHECK(stats.p50 >= 5000);
+    CHECK(stats.p50 < 5000 * 1.25);
+    CHECK(stats.p95 >= 9500);
+    CHECK(stats.p95 < 9500 * 1.25);
+
+    CHECK(profiler::get_stats(probe::DrawTopology).count == 0);
+    profiler::reset();
+  }
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   Profiler.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <tchar.h>
+#include <chrono>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * Execution time of draw pipeline layers and calculation steps.
+ *
+ * Each probe owns a log-scale histogram of elapsed time in microseconds, made
+ * of relaxed atomic counters : a probe is always updated from the same thread
+ * ( draw thread or calculation thread ) so recording never waits, and results
+ * can be read at any time from another thread.
+ *
+ * Results are shown by map overlay (`hud_enabled`) and can be written to csv
+ * file for offline comparison between builds.
+ */
+namespace profiler {
+
+enum class probe : unsigned {
+  RenderMapWindowBg,
+  DrawTerrain,
+  DrawTopology,
+  DrawAirSpace,
+  DrawWaypoints,
+  DrawTrail,
+  DrawTraffic,
+  DoCalculations,
+  DoCalculationsSlow,
+  FrameAllocations, // heap allocations by draw frame, not µs ( debug build only )
+  AudioVarioLatency, // from vario calculation to tone synthesis
+
+  count // must be last
+};
+
+struct stats_t {
+  unsigned count;  // number of samples
+  unsigned mean;   // µs
+  unsigned max;    // µs
+  unsigned p50;    // µs
+  unsigned p95;    // µs
+  unsigned p99;    // µs
+};
+
+/**
+ * map overlay enabled/disabled by `eventService(PROFILER)`
+ */
+extern std::atomic<bool> hud_enabled;
+
+const TCHAR* name(probe id);
+
+void add(probe id, unsigned elapsed_us);
+
+stats_t get_stats(probe id);
+
+void reset();
+
+/**
+ * write stats of all probes to <file_path>
+ * @return false if file can't be created.
+ */
+bool dump_csv(const TCHAR* file_path);
+
+/**
+ * record execution time of current scope
+ */
+class scoped_timer final {
+  using clock = std::chrono::steady_clock;
+
+ public:
+  explicit scoped_timer(probe id) : _id(id), _start(clock::now()) {}
+
+  scoped_timer(const scoped_timer&) = delete;
+  scoped_timer& operator=(const scoped_timer&) = delete;
+
+  ~scoped_timer() {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - _start);
+    add(_id, elapsed.count());
+  }
+
+ private:
+  const probe _id;
+  const clock::time_point _start;
+};
+
+} // namespace profiler
+
+#endif // _PROFILER_H_
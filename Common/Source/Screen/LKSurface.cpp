@@ -305,6 +305,20 @@ void LKSurface::Polyline(const POINT *apt, int cpt, const RECT& ClipRect) {
     }
 }
 
+void LKSurface::Polylines(const POINT *apt, const unsigned *firsts, const unsigned *counts, unsigned count, const RECT& ClipRect) {
+#ifdef ENABLE_OPENGL
+    if(_pCanvas) {
+        const GLPushScissor push_scissor;
+        const GLCanvasScissor scissor(ClipRect);
+        _pCanvas->DrawPolylines(apt, firsts, counts, count);
+    }
+#else
+    for (unsigned i = 0; i < count; ++i) {
+        Polyline(apt + firsts[i], counts[i], ClipRect);
+    }
+#endif
+}
+
 #ifdef ENABLE_OPENGL
 void LKSurface::Polyline(const FloatPoint *apt, int cpt, const RECT& ClipRect) {
     if(_pCanvas) {
@@ -314,6 +328,14 @@ void LKSurface::Polyline(const FloatPoint *apt, int cpt, const RECT& ClipRect) {
     }
 }
 
+void LKSurface::Polylines(const FloatPoint *apt, const unsigned *firsts, const unsigned *counts, unsigned count, const RECT& ClipRect) {
+    if(_pCanvas) {
+        const GLPushScissor push_scissor;
+        const GLCanvasScissor scissor(ClipRect);
+        _pCanvas->DrawPolylines(apt, firsts, counts, count);
+    }
+}
+
 void LKSurface::DrawDashPoly(const int width, const LKColor& color, const FloatPoint* pt, const unsigned npoints, const RECT& rc) {
     LKPen hpDash(PEN_DASH, width, color);
     SelectObject(hpDash);
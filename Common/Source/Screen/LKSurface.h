@@ -157,8 +157,15 @@ public:
     void Polyline(const POINT *apt, int cpt);
     void Polyline(const POINT *apt, int cpt, const RECT& ClipRect);
 
+    /**
+     * Draw <count> polylines with selected pen, polyline i is the <counts[i]>
+     * points of <apt> starting at <firsts[i]>. Single draw call with OpenGL.
+     */
+    void Polylines(const POINT *apt, const unsigned *firsts, const unsigned *counts, unsigned count, const RECT& ClipRect);
+
 #ifdef ENABLE_OPENGL
     void Polyline(const FloatPoint *apt, int cpt, const RECT& ClipRect);
+    void Polylines(const FloatPoint *apt, const unsigned *firsts, const unsigned *counts, unsigned count, const RECT& ClipRect);
 
     void DrawDashPoly(const int width, const LKColor& color, const FloatPoint* pt, const unsigned npoints, const RECT& rc);
 #endif
@@ -18,6 +18,8 @@
 #include "Dialogs.h"
 #include "ChangeScreen.h"
 #include "Waypoints/SetHome.h"
+#include "Draw/LayerCache.h"
+#include "Draw/LKValueCache.h"
 
 void SettingsEnter() {
   MenuActive = true;
@@ -49,6 +51,10 @@ void SettingsLeave() {
 
   MenuActive = false;
 
+  // any setting can change map rendering
+  layer_cache::invalidate_all();
+  lk_value_cache::invalidate();
+
   // 101020 LKmaps contain only topology , so no need to force total reload!
   if(MAPFILECHANGED) {
 	#if TESTBENCH
@@ -27,6 +27,21 @@ bool SetSoundVolume();
 void LKSound(const TCHAR *lpName);
 void PlayResource (const TCHAR* lpName);
 
+/**
+ * new vario value for synthesized audio vario, only with alsa sound : Android
+ * has it own audio vario, other targets rely on external vario.
+ */
+#ifdef USE_ALSA
+void AudioVarioUpdate(double vario);
+/**
+ * apply AudioVario* settings, after profile load or configuration change.
+ */
+void AudioVarioConfigure();
+#else
+inline void AudioVarioUpdate(double vario) { }
+inline void AudioVarioConfigure() { }
+#endif
+
 #if defined(DISABLEAUDIO) && defined(DISABLEEXTAUDIO)
 // For external device, sounds can be possible by NMEA sentences
 
@@ -15,9 +15,14 @@
 #include "resource_data.h"
 #include <alsa/asoundlib.h>
 #include <sndfile.h>
+#include <map>
 #include <optional>
 #include "Thread/Thread.hpp"
 #include "Thread/Cond.hpp"
+#include "Sound/sound_mixer.h"
+#include "Sound/audio_vario.h"
+#include "OS/Clock.hpp"
+#include "Profiler.h"
 
 #define PCM_DEVICE "default"
 
@@ -26,146 +31,37 @@ namespace {
 bool bSoundFile = false;  // this is true only if "_System/_Sounds" directory exists.
 snd_pcm_t* pcm_handle = nullptr;
 
-class pcm_hw_params {
- public: 
-  pcm_hw_params() {
-    snd_pcm_hw_params_malloc(&params);
-  }
-  
-  ~pcm_hw_params() {
-    snd_pcm_hw_params_free(params);
-  }
-
-  operator snd_pcm_hw_params_t* () {
-    return params;
-  }
-
- private:
-  snd_pcm_hw_params_t *params;
-};
+constexpr unsigned pcm_latency = 50000; // µs, alsa buffer size
 
-class pcm_sw_params {
- public: 
-  pcm_sw_params() {
-    snd_pcm_sw_params_malloc(&params);
-  }
-  
-  ~pcm_sw_params() {
-    snd_pcm_sw_params_free(params);
-  }
-
-  operator snd_pcm_sw_params_t* () {
-    return params;
-  }
-
- private:
-  snd_pcm_sw_params_t *params;
-};
-
-void init_hw_params(const SF_INFO& sfinfo) {
-  /* Allocate parameters object and fill it with default values*/
-  pcm_hw_params hw_params;
-  snd_pcm_hw_params_any(pcm_handle, hw_params);
-  /* Set parameters */
-  snd_pcm_hw_params_set_access(pcm_handle, hw_params, SND_PCM_ACCESS_MMAP_INTERLEAVED);
-  snd_pcm_hw_params_set_format(pcm_handle, hw_params, SND_PCM_FORMAT_S16_LE);
-  snd_pcm_hw_params_set_channels(pcm_handle, hw_params, sfinfo.channels);
-  snd_pcm_hw_params_set_rate(pcm_handle, hw_params, sfinfo.samplerate, 0);
-
-  /* Makes sure buffer frames is even, or snd_pcm_hw_params will return invalid argument error. */
-  snd_pcm_uframes_t buffer_frames;
-  snd_pcm_hw_params_get_buffer_size_max(hw_params, &buffer_frames);
-  buffer_frames &= ~0x01;
-  snd_pcm_hw_params_set_buffer_size_max(pcm_handle, hw_params, &buffer_frames);
-
-  /* set hw parameters and prepare */
-  snd_pcm_hw_params(pcm_handle, hw_params);
-}
-
-void init_sw_params() {
-  pcm_sw_params sw_params;
-  snd_pcm_sw_params_current(pcm_handle, sw_params);
-  snd_pcm_uframes_t boundary;
-  snd_pcm_sw_params_get_boundary(sw_params, &boundary);
-  snd_pcm_sw_params_set_stop_threshold(pcm_handle, sw_params, boundary);
-  snd_pcm_sw_params_set_start_threshold(pcm_handle, sw_params, boundary);
-  snd_pcm_sw_params_set_period_event(pcm_handle, sw_params, 0);
-  snd_pcm_sw_params(pcm_handle, sw_params);
-}
-
-void wait_for_poll(snd_pcm_t* handle, struct pollfd* ufds, unsigned int count) {
-  unsigned short revents;
-  while (1) {
-    poll(ufds, count, -1);
-    snd_pcm_poll_descriptors_revents(handle, ufds, count, &revents);
-    if (revents & POLLERR) {
-      throw std::runtime_error("poll error");
-    }
-    if (revents & POLLOUT) {
-      return;
-    }
-  }
-}
-
-int snd_recovery(snd_pcm_t* handle, int err) {
-  if (err == -EPIPE) { /* under-run */
-    err = snd_pcm_prepare(handle);
-  }
-  if (err < 0) {
-    throw std::runtime_error(std::string("Can't recovery : ") + snd_strerror(err));
+/**
+ * persistent alsa stream in mixer format, opened once by SoundGlobalInit.
+ */
+class alsa_pcm_sink final : public sound::pcm_sink {
+ public:
+  void start() override {
+    snd_pcm_prepare(pcm_handle);
   }
-  return err;
-}
-
-void alsa_play(SNDFILE* infile, const SF_INFO& sfinfo) {
-  init_hw_params(sfinfo);
-  init_sw_params();
-
-  snd_pcm_prepare(pcm_handle);
-  snd_pcm_start(pcm_handle);
-
-  try {
-    int count = snd_pcm_poll_descriptors_count(pcm_handle);
-    auto ufds = std::make_unique<pollfd[]>(count);
-    snd_pcm_poll_descriptors(pcm_handle, ufds.get(), count);
-
-    snd_pcm_uframes_t to_write = sfinfo.frames;
-    while (to_write > 0) {
-      wait_for_poll(pcm_handle, ufds.get(), count);
 
-      auto available = snd_pcm_avail(pcm_handle);
-      if (available < 0) {
-        available = snd_recovery(pcm_handle, available);
-      }
-      if (available <= 0) {
-        continue;
-      }
-
-      const snd_pcm_channel_area_t* areas;
-      snd_pcm_uframes_t offset;
-      snd_pcm_uframes_t frames = to_write;
-      int err = snd_pcm_mmap_begin(pcm_handle, &areas, &offset, &frames);
-      if (err < 0) {
-        err = snd_recovery(pcm_handle, available);
-      }
-      if (err < 0) {
+  void write(const int16_t* samples, size_t frames) override {
+    while (frames > 0) {
+      snd_pcm_sframes_t written = snd_pcm_writei(pcm_handle, samples, frames);
+      if (written < 0) {
+        written = snd_pcm_recover(pcm_handle, written, 1);
+        if (written < 0) {
+          fprintf(stderr, "PCM %s\n", snd_strerror(written));
+          return;
+        }
         continue;
       }
-
-      auto buff = static_cast<int16_t*>(areas->addr);
-      ssize_t buffsize = snd_pcm_frames_to_bytes(pcm_handle, frames) / sizeof(int16_t);
-      ssize_t buffoffset = snd_pcm_frames_to_bytes(pcm_handle, offset) / sizeof(int16_t);
-
-      int readcount = sf_readf_short(infile, buff + buffoffset, buffsize);
-      snd_pcm_mmap_commit(pcm_handle, offset, readcount);
-      to_write -= readcount;
+      samples += written;
+      frames -= written;
     }
+  }
+
+  void stop() override {
     snd_pcm_drain(pcm_handle);
-  } catch (std::exception& e) {
-    fprintf(stderr, "PCM %s\n", e.what());
   }
-  snd_pcm_hw_free(pcm_handle);
-}
+};
 
 ////////////////////////////////////////////////////////////////////
 /// Functions for implementing custom read and write to memory files
@@ -245,36 +141,48 @@ SF_VIRTUAL_IO VirtualIO = {
     &vio_tell
 };
 
-void play_file(const std::string& name) {
+sound::pcm_buffer_ptr decode(SNDFILE* infile, const SF_INFO& sfinfo) {
+  std::vector<int16_t> interleaved(sfinfo.frames * sfinfo.channels);
+  const sf_count_t frames = sf_readf_short(infile, interleaved.data(), sfinfo.frames);
+  return sound::make_pcm_buffer(interleaved.data(), std::max<sf_count_t>(frames, 0),
+                                sfinfo.channels, sfinfo.samplerate);
+}
+
+sound::pcm_buffer_ptr decode_file(const std::string& name) {
   TCHAR srcfile[MAX_PATH];
   SystemPath(srcfile, TEXT(LKD_SOUNDS), name.c_str());
 
   SF_INFO sfinfo = {};
   SNDFILE* infile = sf_open(srcfile, SFM_READ, &sfinfo);
-  if (infile) {
-    alsa_play(infile, sfinfo);
-    sf_close(infile);
+  if (!infile) {
+    return nullptr;
   }
+  auto buffer = decode(infile, sfinfo);
+  sf_close(infile);
+  return buffer;
 }
 
-void play_resource(const std::string& name) {
+sound::pcm_buffer_ptr decode_resource(const std::string& name) {
   ConstBuffer<void> sndBuffer = GetNamedResource(name.c_str());
-  if (!sndBuffer.IsEmpty()) {
-    // Initialize the memory data
-    MemoryInfos Memory = {
-      static_cast<const uint8_t*>(sndBuffer.data),
-      static_cast<const uint8_t*>(sndBuffer.data),
-      static_cast<sf_count_t>(sndBuffer.size)
-    };
-
-    // Open the sound file
-    SF_INFO sfinfo = {};
-    SNDFILE* infile = sf_open_virtual(&VirtualIO, SFM_READ, &sfinfo, &Memory);
-    if (infile) {
-      alsa_play(infile, sfinfo);
-      sf_close(infile);
-    }
+  if (sndBuffer.IsEmpty()) {
+    return nullptr;
+  }
+  // Initialize the memory data
+  MemoryInfos Memory = {
+    static_cast<const uint8_t*>(sndBuffer.data),
+    static_cast<const uint8_t*>(sndBuffer.data),
+    static_cast<sf_count_t>(sndBuffer.size)
+  };
+
+  // Open the sound file
+  SF_INFO sfinfo = {};
+  SNDFILE* infile = sf_open_virtual(&VirtualIO, SFM_READ, &sfinfo, &Memory);
+  if (!infile) {
+    return nullptr;
   }
+  auto buffer = decode(infile, sfinfo);
+  sf_close(infile);
+  return buffer;
 }
 
 enum class sound_type {
@@ -287,18 +195,27 @@ struct sound_item {
   std::string name;
 };
 
-void play_sound(const sound_item& item) {
-  switch (item.type) {
-    case sound_type::file:
-      play_file(item.name);
-      break;
-    case sound_type::ressource:
-      play_resource(item.name);
-      break;
-  }
-}
+/**
+ * sound resources, all decoded when sound thread start.
+ */
+constexpr const char* resource_sounds[] = {
+  "IDR_WAV_MM0", "IDR_WAV_MM1", "IDR_WAV_MM2", "IDR_WAV_MM3", "IDR_WAV_MM4",
+  "IDR_WAV_MM5", "IDR_WAV_MM6", "IDR_WAV_DRIP", "IDR_WAV_CLICK", "IDR_WAV_HIGHCLICK",
+  "IDR_WAV_TONE1", "IDR_WAV_TONE2", "IDR_WAV_TONE3", "IDR_WAV_TONE4", "IDR_WAV_TONE7",
+  "IDR_WAV_BTONE2", "IDR_WAV_BTONE4", "IDR_WAV_BTONE5", "IDR_WAV_BTONE6", "IDR_WAV_BTONE7",
+  "IDR_WAV_OVERTONE0", "IDR_WAV_OVERTONE1", "IDR_WAV_OVERTONE2", "IDR_WAV_OVERTONE3",
+  "IDR_WAV_OVERTONE4", "IDR_WAV_OVERTONE5", "IDR_WAV_OVERTONE6", "IDR_WAV_OVERTONE7",
+};
 
+/**
+ * Decode sounds once, mix them and feed the alsa stream.
+ *
+ * Sound files are decoded on first use, resources when thread start. Caller
+ * only queue a request : it never waits for decoding nor for alsa.
+ */
 class ThreadSound : public Thread {
+  static constexpr size_t max_requests = 16;
+
 public:
   ThreadSound() : Thread("Sound") {}
 
@@ -308,12 +225,31 @@ public:
   }
 
   void Queue(sound_type type, std::string name) {
+    const sound::priority level = sound::get_priority(name);
+    WithLock(queue_mtx, [&]() {
+      queue.push({ type, std::move(name) }, level);
+    });
+    queue_cv.Broadcast();
+  }
+
+  void ConfigureVario(const sound::audio_vario_config& config) {
     WithLock(queue_mtx, [&]() {
-      queue = { type, std::move(name) };
+      vario_config = config;
+      vario_config_changed = true;
     });
     queue_cv.Broadcast();
   }
 
+  void UpdateVario(double value) {
+    const unsigned now = MonotonicClockMS();
+    vario.update(value, now);
+    if (waiting.load(std::memory_order_acquire) && vario.audible(now)) {
+      // lock ensure thread is waiting or has not yet checked the vario.
+      WithLock(queue_mtx, []() {});
+      queue_cv.Broadcast();
+    }
+  }
+
   void Stop() {
     WithLock(queue_mtx, [&]() {
       thread_stop = true;
@@ -323,28 +259,106 @@ public:
 
 private:
   bool thread_stop = false;
-  std::optional<sound_item> queue;
+  sound::request_queue<sound_item, max_requests> queue;
   Mutex queue_mtx;
   Cond queue_cv;
+  std::atomic<bool> waiting = false;
+  sound::audio_vario_config vario_config;
+  bool vario_config_changed = false;
+
+  sound::audio_vario vario;
+
+  // sound thread only
+  sound::sound_mixer mixer;
+  alsa_pcm_sink sink;
+  std::map<std::string, sound::pcm_buffer_ptr> resources;
+  std::map<std::string, sound::pcm_buffer_ptr> files;
+
+  sound::pcm_buffer_ptr get_buffer(const sound_item& item) {
+    auto& cache = (item.type == sound_type::file) ? files : resources;
+    auto it = cache.find(item.name);
+    if (it == cache.end()) {
+      // missing sound is also cached, to not retry each time.
+      auto buffer = (item.type == sound_type::file) ? decode_file(item.name) : decode_resource(item.name);
+      it = cache.emplace(item.name, std::move(buffer)).first;
+    }
+    return it->second;
+  }
 
   void Run() override {
+    for (const char* name : resource_sounds) {
+      resources.emplace(name, decode_resource(name));
+    }
+
+    snd_pcm_uframes_t buffer_size = 0;
+    snd_pcm_uframes_t period_size = 0;
+    snd_pcm_get_params(pcm_handle, &buffer_size, &period_size);
+    if (period_size == 0) {
+      period_size = sound::sample_rate / 100;
+    }
+    std::vector<int16_t> period;
+
+    bool playing = false;
     while (true) {
-      // get copy of queue
-      auto sound = WithLock(queue_mtx, [&]() {
-        return std::exchange(queue, std::nullopt);
+      bool stop = false;
+      std::optional<sound::audio_vario_config> config;
+      auto requests = WithLock(queue_mtx, [&]() {
+        stop = thread_stop;
+        if (std::exchange(vario_config_changed, false)) {
+          config = vario_config;
+        }
+        return queue.take();
       });
 
-      if (!sound) {
-        ScopeLock lock(queue_mtx);
-        // no sound check for stop request
-        if (thread_stop) {
-          return;  // stop requested...
+      if (config) {
+        vario.configure(*config);
+      }
+
+      if (stop) {
+        // do not wait end of sounds, audio vario can be active forever.
+        mixer.stop();
+        if (playing) {
+          sink.stop();
+        }
+        return;
+      }
+
+      for (const auto& [item, level] : requests) {
+        mixer.play(get_buffer(item), level);
+      }
+
+      const unsigned now = MonotonicClockMS();
+      const bool vario_active = EnableAudioVario && vario.active(now);
+      if (mixer.active() || vario_active) {
+        if (!playing) {
+          sink.start();
+          playing = true;
         }
-        // wait for stop or sound
-        queue_cv.Wait(queue_mtx);
-      } else {
-        play_sound(sound.value());
+        if (vario_active) {
+          sound::render(mixer, vario, sink, period, period_size, now);
+          unsigned latency;
+          if (vario.take_latency(latency)) {
+            profiler::add(profiler::probe::AudioVarioLatency, latency * 1000);
+          }
+        } else {
+          sound::render(mixer, sink, period, period_size);
+        }
+        continue;
+      }
+
+      if (playing) {
+        sink.stop();
+        playing = false;
       }
+
+      ScopeLock lock(queue_mtx);
+      if (thread_stop || vario_config_changed || !queue.empty() || (EnableAudioVario && vario.audible(MonotonicClockMS()))) {
+        continue;
+      }
+      // wait for stop, sound or vario outside dead-band
+      waiting.store(true, std::memory_order_release);
+      queue_cv.Wait(queue_mtx);
+      waiting.store(false, std::memory_order_release);
     }
   }
 };
@@ -367,6 +381,20 @@ void LKSound(const TCHAR* lpName) {
   thread_sound.Queue(sound_type::file, lpName);
 }
 
+void AudioVarioUpdate(double vario) {
+  if (!EnableAudioVario || !pcm_handle) {
+    return;
+  }
+  thread_sound.UpdateVario(vario);
+}
+
+void AudioVarioConfigure() {
+  thread_sound.ConfigureVario(sound::make_audio_vario_config(
+          AudioVarioSinkThreshold, AudioVarioLiftThreshold,
+          AudioVarioLiftToneLow, AudioVarioLiftToneHigh,
+          AudioVarioSinkTone, AudioVarioVolume));
+}
+
 SoundGlobalInit::SoundGlobalInit() {
   TCHAR srcfile[MAX_PATH];
   SystemPath(srcfile, TEXT(LKD_SOUNDS), TEXT("_SOUNDS"));
@@ -383,6 +411,17 @@ SoundGlobalInit::SoundGlobalInit() {
     pcm_handle = nullptr;
   }
 
+  /* One stream for all sounds, in mixer format */
+  if (pcm_handle) {
+    pcmrc = snd_pcm_set_params(pcm_handle, SND_PCM_FORMAT_S16, SND_PCM_ACCESS_RW_INTERLEAVED,
+                               1, sound::sample_rate, 1, pcm_latency);
+    if (pcmrc < 0) {
+      StartupStore(_T("failed to set PCM parameters <%s>") NEWLINE, snd_strerror(pcmrc));
+      snd_pcm_close(pcm_handle);
+      pcm_handle = nullptr;
+    }
+  }
+
   if (pcm_handle) {
     thread_sound.Start();
   }
@@ -0,0 +1,394 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   audio_vario.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _SOUND_AUDIO_VARIO_H_
+#define _SOUND_AUDIO_VARIO_H_
+
+#include "sound_mixer.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+
+/**
+ * Audio variometer : tone synthesized from vario value, mixed in sound stream.
+ *
+ * Calculation thread give each new vario value with `update()`, audio thread
+ * pull samples with `mix()`. Value is exchanged through a single atomic, so
+ * neither thread ever waits for the other, and `mix()` doesn't allocate : it
+ * can be called from a real-time audio callback.
+ */
+namespace sound {
+
+/**
+ * tone for one vario value
+ */
+struct vario_tone {
+  double vario;       // m/s
+  double frequency;   // Hz
+  unsigned period;    // ms, beep cadence, 0 for continuous tone
+  double duty;        // sounding part of period [0..1]
+};
+
+/**
+ * tone by vario value, linear interpolation between points, clamped outside.
+ */
+class vario_curve final {
+ public:
+  static constexpr size_t max_points = 8;
+
+  vario_curve() = default;
+
+  vario_curve(std::initializer_list<vario_tone> points) {
+    for (const auto& point : points) {
+      if (_count < max_points) {
+        _points[_count++] = point;
+      }
+    }
+    std::sort(_points.begin(), _points.begin() + _count, [](const vario_tone& a, const vario_tone& b) {
+      return a.vario < b.vario;
+    });
+  }
+
+  bool empty() const {
+    return _count == 0;
+  }
+
+  size_t size() const {
+    return _count;
+  }
+
+  const vario_tone& operator[](size_t i) const {
+    return _points[i];
+  }
+
+  /**
+   * insert <point>, ignored if curve is full.
+   */
+  void add(const vario_tone& point) {
+    if (_count < max_points) {
+      auto it = std::upper_bound(_points.begin(), _points.begin() + _count, point, [](const vario_tone& a, const vario_tone& b) {
+        return a.vario < b.vario;
+      });
+      std::move_backward(it, _points.begin() + _count, _points.begin() + _count + 1);
+      *it = point;
+      ++_count;
+    }
+  }
+
+  vario_tone at(double vario) const {
+    if (_count == 0) {
+      return { vario, 0., 0, 0. };
+    }
+    if (vario <= _points[0].vario) {
+      return _points[0];
+    }
+    for (size_t i = 1; i < _count; ++i) {
+      const vario_tone& next = _points[i];
+      if (vario < next.vario) {
+        const vario_tone& prev = _points[i - 1];
+        const double ratio = (vario - prev.vario) / (next.vario - prev.vario);
+        return {
+          vario,
+          prev.frequency + (next.frequency - prev.frequency) * ratio,
+          static_cast<unsigned>(std::lround(prev.period + (static_cast<double>(next.period) - prev.period) * ratio)),
+          prev.duty + (next.duty - prev.duty) * ratio
+        };
+      }
+    }
+    return _points[_count - 1];
+  }
+
+ private:
+  std::array<vario_tone, max_points> _points = {};
+  size_t _count = 0;
+};
+
+struct audio_vario_config {
+  // dead-band : silent between both thresholds ( m/s )
+  double sink_threshold = -2.;
+  double lift_threshold = 0.2;
+
+  // beeps in lift, faster and higher when climbing
+  vario_curve lift = default_lift();
+
+  // continuous tone in sink, lower when sinking
+  vario_curve sink = default_sink();
+
+  double volume = 0.5;     // [0..1] of full scale
+  unsigned timeout = 2000; // ms, silent if vario is not updated anymore
+  unsigned ramp = 3;       // ms, fade in and out of each beep, avoid clicks
+
+  // curves are built in functions rather than member initializers : with an
+  // initializer list there, gcc 12 warns about uninitialized backing array.
+  static vario_curve default_lift() {
+    return {
+      { 0.2, 600., 600, 0.5 },
+      { 1.0, 700., 500, 0.5 },
+      { 2.5, 900., 350, 0.5 },
+      { 5.0, 1200., 220, 0.5 },
+    };
+  }
+
+  static vario_curve default_sink() {
+    return {
+      { -5., 200., 0, 1. },
+      { -2., 400., 0, 1. },
+    };
+  }
+};
+
+/**
+ * config from user settings, shape of default curves is kept :
+ *  - lift tone go from <lift_low> Hz at <lift_threshold> to <lift_high> Hz at
+ *    5 m/s, with cadence of default curve.
+ *  - sink tone go from <sink_tone> Hz at <sink_threshold> to half of it 3 m/s
+ *    below.
+ * @volume : [0..100] %
+ */
+inline audio_vario_config make_audio_vario_config(double sink_threshold, double lift_threshold,
+                                                  double lift_low, double lift_high,
+                                                  double sink_tone, unsigned volume) {
+  const audio_vario_config defaults;
+  audio_vario_config config;
+  config.sink_threshold = std::min(sink_threshold, 0.);
+  config.lift_threshold = std::max(lift_threshold, 0.);
+  config.volume = std::min(volume, 100U) / 100.;
+
+  // scale default frequencies from [threshold, 5 m/s] to [lift_low, lift_high]
+  const double default_low = defaults.lift.at(defaults.lift_threshold).frequency;
+  const double default_high = defaults.lift.at(5.).frequency;
+  const auto scale = [&](vario_tone tone) {
+    tone.frequency = lift_low + (tone.frequency - default_low) * (lift_high - lift_low) / (default_high - default_low);
+    return tone;
+  };
+
+  config.lift = {};
+  config.lift.add(scale(defaults.lift.at(config.lift_threshold)));
+  for (size_t i = 0; i < defaults.lift.size(); ++i) {
+    if (defaults.lift[i].vario > config.lift_threshold) {
+      config.lift.add(scale(defaults.lift[i]));
+    }
+  }
+
+  config.sink = {
+    { config.sink_threshold - 3., sink_tone / 2., 0, 1. },
+    { config.sink_threshold, sink_tone, 0, 1. },
+  };
+  return config;
+}
+
+class audio_vario final {
+  static constexpr size_t table_bits = 8;
+  static constexpr size_t table_size = size_t(1) << table_bits;
+
+ public:
+  explicit audio_vario(const audio_vario_config& config = {}) {
+    constexpr double pi = 3.14159265358979323846;
+    for (size_t i = 0; i < table_size; ++i) {
+      _sine[i] = static_cast<int16_t>(std::lround(INT16_MAX * std::sin(2. * pi * i / table_size)));
+    }
+    configure(config);
+  }
+
+  audio_vario(const audio_vario&) = delete;
+  audio_vario& operator=(const audio_vario&) = delete;
+
+  /**
+   * audio thread only
+   */
+  const audio_vario_config& config() const {
+    return _config;
+  }
+
+  /**
+   * change config, audio thread only : `audible()` can be called by any
+   * thread, it only use atomic copy of dead-band and timeout.
+   */
+  void configure(const audio_vario_config& config) {
+    _config = config;
+    _ramp_step = 1. / std::max(1U, _config.ramp * sample_rate / 1000);
+    _sink_threshold.store(_config.sink_threshold, std::memory_order_relaxed);
+    _lift_threshold.store(_config.lift_threshold, std::memory_order_relaxed);
+    _timeout.store(_config.timeout, std::memory_order_relaxed);
+  }
+
+  /**
+   * new vario value, any thread.
+   * @time : ms, monotonic clock when vario was sampled, same clock as `mix()`
+   */
+  void update(double vario, unsigned time) {
+    _sample.store(pack(vario, time), std::memory_order_release);
+  }
+
+  /**
+   * @return true if last vario value is recent and outside dead-band.
+   */
+  bool audible(unsigned now) const {
+    const uint64_t sample = _sample.load(std::memory_order_acquire);
+    return sample && fresh(sample, now) && !in_dead_band(unpack_vario(sample));
+  }
+
+  /**
+   * @return true if next `mix()` is not silent, audio thread only.
+   */
+  bool active(unsigned now) const {
+    return _gain > 0. || audible(now);
+  }
+
+  /**
+   * add <frames> samples of vario tone to <out>, saturated sum.
+   * audio thread only, no allocation, no lock.
+   * @now : ms, monotonic clock at first sample
+   */
+  void mix(int16_t* out, size_t frames, unsigned now) {
+    const uint64_t sample = _sample.load(std::memory_order_acquire);
+    if (sample != _last_sample) {
+      _last_sample = sample;
+      _latency = now - unpack_time(sample);
+      _latency_pending = (sample != 0);
+    }
+
+    vario_tone tone = {};
+    bool sounding = false;
+    if (sample && fresh(sample, now)) {
+      const double vario = unpack_vario(sample);
+      if (vario >= _config.lift_threshold) {
+        tone = _config.lift.at(vario);
+        sounding = true;
+      } else if (vario <= _config.sink_threshold) {
+        tone = _config.sink.at(vario);
+        sounding = true;
+      }
+      sounding = sounding && tone.frequency > 0.;
+    }
+
+    if (sounding) {
+      _phase_step = static_cast<uint32_t>(tone.frequency * 4294967296. / sample_rate);
+    }
+
+    const uint32_t period = tone.period * sample_rate / 1000;
+    const uint32_t on = static_cast<uint32_t>(period * std::clamp(tone.duty, 0., 1.));
+    if (!sounding || !_sounding) {
+      _cadence = 0; // next beep start immediately
+    } else if (period) {
+      _cadence %= period;
+    }
+    _sounding = sounding;
+
+    const double volume = std::clamp(_config.volume, 0., 1.);
+    for (size_t i = 0; i < frames; ++i) {
+      const bool gate = sounding && (period == 0 || _cadence < on);
+      if (period && ++_cadence >= period) {
+        _cadence = 0;
+      }
+
+      const double target = gate ? 1. : 0.;
+      if (_gain < target) {
+        _gain = std::min(target, _gain + _ramp_step);
+      } else if (_gain > target) {
+        _gain = std::max(target, _gain - _ramp_step);
+      }
+      if (_gain <= 0.) {
+        continue;
+      }
+
+      const int32_t value = static_cast<int32_t>(_sine[_phase >> (32 - table_bits)] * _gain * volume);
+      out[i] = static_cast<int16_t>(std::clamp<int32_t>(out[i] + value, INT16_MIN, INT16_MAX));
+      _phase += _phase_step;
+    }
+  }
+
+  /**
+   * ms between vario sampling and first `mix()` using it, device buffer not
+   * included. audio thread only.
+   * @return false if no new vario value was used since last call.
+   */
+  bool take_latency(unsigned& latency) {
+    latency = _latency;
+    return std::exchange(_latency_pending, false);
+  }
+
+ private:
+  // vario as float in low 32 bits, time in high 32 bits, 0 for no value.
+  static uint64_t pack(double vario, unsigned time) {
+    const float value = static_cast<float>(vario);
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (static_cast<uint64_t>(time) << 32) | bits;
+  }
+
+  static double unpack_vario(uint64_t sample) {
+    const uint32_t bits = static_cast<uint32_t>(sample);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  static unsigned unpack_time(uint64_t sample) {
+    return static_cast<unsigned>(sample >> 32);
+  }
+
+  bool fresh(uint64_t sample, unsigned now) const {
+    return (now - unpack_time(sample)) <= _timeout.load(std::memory_order_relaxed);
+  }
+
+  bool in_dead_band(double vario) const {
+    return vario > _sink_threshold.load(std::memory_order_relaxed)
+        && vario < _lift_threshold.load(std::memory_order_relaxed);
+  }
+
+  std::array<int16_t, table_size> _sine;
+
+  std::atomic<uint64_t> _sample = 0;
+  std::atomic<double> _sink_threshold = 0.;
+  std::atomic<double> _lift_threshold = 0.;
+  std::atomic<unsigned> _timeout = 0;
+
+  // audio thread only
+  audio_vario_config _config;
+  double _ramp_step = 0.;
+
+  uint64_t _last_sample = 0;
+  unsigned _latency = 0;
+  bool _latency_pending = false;
+  uint32_t _phase = 0;
+  uint32_t _phase_step = 0;
+  uint32_t _cadence = 0;
+  bool _sounding = false;
+  double _gain = 0.;
+};
+
+/**
+ * mix one period of <frames> samples of sounds and vario tone and write it to
+ * <sink>.
+ * @return false if nothing was playing.
+ */
+inline bool render(sound_mixer& mixer, audio_vario& vario, pcm_sink& sink,
+                   std::vector<int16_t>& period, size_t frames, unsigned now) {
+  const bool vario_active = vario.active(now);
+  period.resize(frames);
+  if (mixer.mix(period.data(), frames) == 0 && !vario_active) {
+    return false;
+  }
+  if (vario_active) {
+    vario.mix(period.data(), frames, now);
+  }
+  sink.write(period.data(), frames);
+  return true;
+}
+
+} // namespace sound
+
+#endif // _SOUND_AUDIO_VARIO_H_
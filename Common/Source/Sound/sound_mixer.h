@@ -0,0 +1,357 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   sound_mixer.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _SOUND_SOUND_MIXER_H_
+#define _SOUND_SOUND_MIXER_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Software mixer of decoded sounds, independent of audio backend.
+ *
+ * All sounds are converted once to the mixer format ( mono, S16, 22050 Hz,
+ * the format of all LK8000 sounds ), backend thread pull mixed samples with
+ * `sound_mixer::mix()` and write them to a `pcm_sink`.
+ */
+namespace sound {
+
+constexpr unsigned sample_rate = 22050;
+
+/**
+ * decoded sound, mixer format
+ */
+struct pcm_buffer {
+  std::vector<int16_t> samples;
+};
+
+using pcm_buffer_ptr = std::shared_ptr<const pcm_buffer>;
+
+/**
+ * convert interleaved S16 samples to mixer format : channels are averaged,
+ * sample rate is converted by linear interpolation.
+ */
+inline pcm_buffer_ptr make_pcm_buffer(const int16_t* interleaved, size_t frames,
+                                      unsigned channels, unsigned rate) {
+  auto buffer = std::make_shared<pcm_buffer>();
+  if (!interleaved || frames == 0 || channels == 0 || rate == 0) {
+    return buffer;
+  }
+
+  std::vector<int32_t> mono(frames);
+  for (size_t i = 0; i < frames; ++i) {
+    int32_t sum = 0;
+    for (unsigned c = 0; c < channels; ++c) {
+      sum += interleaved[i * channels + c];
+    }
+    mono[i] = sum / static_cast<int32_t>(channels);
+  }
+
+  if (rate == sample_rate) {
+    buffer->samples.assign(mono.begin(), mono.end());
+    return buffer;
+  }
+
+  const size_t out_frames = static_cast<size_t>(static_cast<uint64_t>(frames) * sample_rate / rate);
+  buffer->samples.resize(out_frames);
+  for (size_t i = 0; i < out_frames; ++i) {
+    const double pos = static_cast<double>(i) * rate / sample_rate;
+    const size_t index = std::min(static_cast<size_t>(pos), frames - 1);
+    const size_t next = std::min(index + 1, frames - 1);
+    const double frac = pos - index;
+    buffer->samples[i] = static_cast<int16_t>(mono[index] + (mono[next] - mono[index]) * frac);
+  }
+  return buffer;
+}
+
+/**
+ * a sound pre-empts all playing sounds of lower priority, and is ignored
+ * while a sound of higher priority is playing.
+ */
+enum class priority : uint8_t {
+  click,  // user interface feedback
+  info,   // task, waypoint, flight events
+  alarm,  // airspace, traffic, altitude and gear warnings
+};
+
+namespace detail {
+
+/**
+ * prefix of sounds names by priority, everything else is `priority::info`
+ *
+ * IDR_WAV_DRIP is the default sound of status messages, played just before
+ * task events chime : it must not pre-empt them.
+ */
+constexpr const char* alarm_sounds[] = {
+  "LK_AIRSPACE", "LK_SONAR_", "LK_ALARM_ALT", "LK_GEARWARNING",
+  "LK_GPSNOFIX", "LK_GPSNOCOM", "TARGVISIBLE",
+};
+
+constexpr const char* click_sounds[] = {
+  "IDR_WAV_CLICK", "IDR_WAV_HIGHCLICK", "IDR_WAV_DRIP", "LK_TICK", "LK_TOCK",
+  "LK_SLIDE", "LK_TONEUP", "LK_TONEDOWN",
+};
+
+template<size_t size>
+bool match(const std::string& name, const char* const (&prefixes)[size]) {
+  return std::any_of(std::begin(prefixes), std::end(prefixes), [&](const char* prefix) {
+    return name.compare(0, strlen(prefix), prefix) == 0;
+  });
+}
+
+} // namespace detail
+
+/**
+ * priority of sound resource or file <name>
+ */
+inline priority get_priority(const std::string& name) {
+  if (detail::match(name, detail::alarm_sounds)) {
+    return priority::alarm;
+  }
+  if (detail::match(name, detail::click_sounds)) {
+    return priority::click;
+  }
+  return priority::info;
+}
+
+/**
+ * bounded queue of sound requests, not thread safe.
+ *
+ * When full, the oldest request of lowest priority is dropped, so a burst of
+ * clicks or chimes never drops a queued alarm.
+ */
+template<typename Item, size_t Capacity>
+class request_queue final {
+ public:
+  using value_type = std::pair<Item, priority>;
+  using container_type = std::deque<value_type>;
+
+  /**
+   * @return false if <item> is dropped : queue is full of higher priority requests.
+   */
+  bool push(Item item, priority level) {
+    if (_items.size() >= Capacity) {
+      // first of lowest priority is the oldest one
+      auto lowest = std::min_element(_items.begin(), _items.end(), [](const value_type& a, const value_type& b) {
+        return a.second < b.second;
+      });
+      if (lowest->second > level) {
+        return false;
+      }
+      _items.erase(lowest);
+    }
+    _items.emplace_back(std::move(item), level);
+    return true;
+  }
+
+  /**
+   * remove and return all requests, oldest first.
+   */
+  container_type take() {
+    return std::exchange(_items, {});
+  }
+
+  bool empty() const {
+    return _items.empty();
+  }
+
+  size_t size() const {
+    return _items.size();
+  }
+
+ private:
+  container_type _items;
+};
+
+class sound_mixer final {
+ public:
+  static constexpr size_t max_voices = 4;
+
+  /**
+   * start playing <buffer>, thread safe.
+   * @return false if sound is ignored because of higher priority sound.
+   */
+  bool play(pcm_buffer_ptr buffer, priority level) {
+    if (!buffer || buffer->samples.empty()) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& voice : _voices) {
+      if (voice.buffer && voice.level > level) {
+        return false;
+      }
+    }
+
+    voice_t* free_voice = nullptr;
+    voice_t* oldest = nullptr;
+    for (auto& voice : _voices) {
+      if (voice.buffer && voice.level < level) {
+        voice = {}; // pre-empted
+      }
+      if (!voice.buffer) {
+        free_voice = free_voice ? free_voice : &voice;
+      } else if (!oldest || voice.start < oldest->start) {
+        oldest = &voice;
+      }
+    }
+
+    voice_t& voice = free_voice ? *free_voice : *oldest;
+    voice = { std::move(buffer), 0, level, ++_start_count };
+    return true;
+  }
+
+  /**
+   * stop all sounds, thread safe.
+   */
+  void stop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _voices = {};
+  }
+
+  bool active() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::any_of(_voices.begin(), _voices.end(), [](const voice_t& voice) {
+      return !!voice.buffer;
+    });
+  }
+
+  /**
+   * write <frames> samples of all playing sounds to <out>, saturated sum,
+   * silence when nothing is playing.
+   * @return number of playing sounds before this call.
+   */
+  unsigned mix(int16_t* out, size_t frames) {
+    std::fill_n(_accumulator.begin(), std::min(frames, _accumulator.size()), 0);
+    if (_accumulator.size() < frames) {
+      _accumulator.resize(frames, 0);
+    }
+
+    unsigned count = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto& voice : _voices) {
+        if (!voice.buffer) {
+          continue;
+        }
+        ++count;
+        const auto& samples = voice.buffer->samples;
+        const size_t size = std::min(frames, samples.size() - voice.position);
+        for (size_t i = 0; i < size; ++i) {
+          _accumulator[i] += samples[voice.position + i];
+        }
+        voice.position += size;
+        if (voice.position >= samples.size()) {
+          voice = {};
+        }
+      }
+    }
+
+    for (size_t i = 0; i < frames; ++i) {
+      out[i] = static_cast<int16_t>(std::clamp<int32_t>(_accumulator[i], INT16_MIN, INT16_MAX));
+    }
+    return count;
+  }
+
+ private:
+  struct voice_t {
+    pcm_buffer_ptr buffer;
+    size_t position = 0;
+    priority level = priority::click;
+    uint64_t start = 0;
+  };
+
+  mutable std::mutex _mutex;
+  std::array<voice_t, max_voices> _voices;
+  uint64_t _start_count = 0;
+
+  std::vector<int32_t> _accumulator; // mix() thread only
+};
+
+/**
+ * output of mixed samples, `write()` block until samples are accepted.
+ */
+class pcm_sink {
+ public:
+  virtual ~pcm_sink() = default;
+
+  /**
+   * called before first write after `stop()`
+   */
+  virtual void start() {}
+
+  virtual void write(const int16_t* samples, size_t frames) = 0;
+
+  /**
+   * nothing to play anymore : play buffered samples and stop output.
+   */
+  virtual void stop() {}
+};
+
+/**
+ * discard samples : sound without audio device.
+ */
+class null_pcm_sink final : public pcm_sink {
+ public:
+  void write(const int16_t*, size_t frames) override {
+    _frames += frames;
+  }
+
+  uint64_t frames() const {
+    return _frames;
+  }
+
+ private:
+  uint64_t _frames = 0;
+};
+
+/**
+ * append raw samples ( S16 native endian, mono, 22050 Hz ) to file, for
+ * headless test and debug.
+ */
+class file_pcm_sink final : public pcm_sink {
+ public:
+  explicit file_pcm_sink(FILE* file) : _file(file) {}
+
+  void write(const int16_t* samples, size_t frames) override {
+    if (_file) {
+      fwrite(samples, sizeof(int16_t), frames, _file);
+    }
+  }
+
+ private:
+  FILE* _file;
+};
+
+/**
+ * mix one period of <frames> samples and write it to <sink>.
+ * @return false if nothing was playing.
+ */
+inline bool render(sound_mixer& mixer, pcm_sink& sink, std::vector<int16_t>& period, size_t frames) {
+  period.resize(frames);
+  if (mixer.mix(period.data(), frames) == 0) {
+    return false;
+  }
+  sink.write(period.data(), frames);
+  return true;
+}
+
+} // namespace sound
+
+#endif // _SOUND_SOUND_MIXER_H_
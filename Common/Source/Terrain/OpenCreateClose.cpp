@@ -10,6 +10,7 @@
 #include "RasterTerrain.h"
 #include "Dialogs/dlgProgress.h"
 #include "Message.h"
+#include "Draw/LayerCache.h"
 
 std::unique_ptr<RasterMap> RasterTerrain::TerrainMap;
 Mutex RasterTerrain::mutex;
@@ -43,6 +44,7 @@ bool RasterTerrain::CreateTerrainMap(const TCHAR* zfilename) {
   } catch (std::exception&) {
     TerrainMap = nullptr;
   }
+  layer_cache::invalidate(layer_cache::terrain);
   return static_cast<bool>(TerrainMap);
 }
 
@@ -53,4 +55,5 @@ void RasterTerrain::CloseTerrain() {
 
   ScopeLock lock(mutex);
   TerrainMap = nullptr;
+  layer_cache::invalidate(layer_cache::terrain);
 }
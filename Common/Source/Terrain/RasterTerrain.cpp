@@ -85,21 +85,31 @@ void RasterMap::SetFieldRounding(double xr, double yr) {
   if (!isMapLoaded()) {
     return;
   }
+  Rounding = GetFieldRounding(xr, yr);
+}
+
+RasterMap::FieldRounding RasterMap::GetFieldRounding(double xr, double yr) const {
+  FieldRounding rounding = {};
+  if (!isMapLoaded()) {
+    return rounding;
+  }
 
   assert(TerrainInfo.StepSize > 0);
 
-  Xrounding = std::max(iround(xr/TerrainInfo.StepSize), 1);
-  fXrounding = 1.0/(Xrounding*TerrainInfo.StepSize);
-  fXroundingFine = fXrounding*256.0;
+  rounding.Xrounding = std::max(iround(xr/TerrainInfo.StepSize), 1);
+  rounding.fXrounding = 1.0/(rounding.Xrounding*TerrainInfo.StepSize);
+  rounding.fXroundingFine = rounding.fXrounding*256.0;
+
+  rounding.Yrounding = std::max(iround(yr/TerrainInfo.StepSize), 1);
+  rounding.fYrounding = 1.0/(rounding.Yrounding*TerrainInfo.StepSize);
+  rounding.fYroundingFine = rounding.fYrounding*256.0;
 
-  Yrounding = std::max(iround(yr/TerrainInfo.StepSize), 1);
-  fYrounding = 1.0/(Yrounding*TerrainInfo.StepSize);
-  fYroundingFine = fYrounding*256.0;
+  rounding.xlleft = (int)(TerrainInfo.Left*rounding.fXroundingFine)+128;
+  rounding.xlltop  = (int)(TerrainInfo.Top*rounding.fYroundingFine)-128;
 
-  xlleft = (int)(TerrainInfo.Left*fXroundingFine)+128;
-  xlltop  = (int)(TerrainInfo.Top*fYroundingFine)-128;
+  rounding.Interpolate = ((rounding.Xrounding==1)&&(rounding.Yrounding==1));
 
-  Interpolate = ((Xrounding==1)&&(Yrounding==1));
+  return rounding;
 }
 
 
@@ -74,7 +74,7 @@ public:
             LockFlightData();
             FLARM_RefreshSlots(&GPS_INFO);
             Fanet_RefreshSlots(&GPS_INFO); //refresh slots of FANET
-            memcpy(&tmpGPS, &GPS_INFO, sizeof (NMEA_INFO));
+            CopyInfo(tmpGPS, GPS_INFO);
             memcpy(&tmpCALCULATED, &CALCULATED_INFO, sizeof (DERIVED_INFO));
             UnlockFlightData();
 
@@ -13,7 +13,7 @@
 #define	SHAPESPECIALRENDERER_H
 
 #include "tchar.h"
-#include <list>
+#include <vector>
 #include "Screen/Point.hpp"
 
 class LKSurface;
@@ -41,7 +41,8 @@ private:
     const TCHAR* szLabel;
   };
 
-  using lstLabel_t = std::list<Label_t>;
+  // vector keep its capacity after Clear() : no allocation in steady state
+  using lstLabel_t = std::vector<Label_t>;
 
   lstLabel_t lstLabel;
 };
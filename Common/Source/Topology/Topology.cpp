@@ -14,7 +14,10 @@
 #include "resource_data.h"
 
 #include "../Draw/ScreenProjection.h"
+#include "../Draw/LayerCache.h"
 #include "ShapeSpecialRenderer.h"
+#include "Geographic/LocalFrame.h"
+#include "nearest_shape.h"
 #include "NavFunctions.h"
 #include "ScreenGeometry.h"
 #include "utils/charset_helper.h"
@@ -379,6 +382,9 @@ void Topology::updateCache(rectObj thebounds, bool purgeonly) {
 
   if (!shapefileopen || !shpCache) return;
 
+  // visible shapes can change from here : cached map is outdated
+  layer_cache::invalidate(layer_cache::topology);
+
   in_scale = CheckScale();
 
   if (!in_scale) {
@@ -852,60 +858,66 @@ void Topology::SearchNearest(const rectObj& bounds) {
     return;
   }
 
+  // candidates : shape bounds in memory if any, otherwise shapefile spatial
+  // index ( quadtree file if any, or bounds read from shapefile ).
+  if (cache_mode != 1) {
+    msShapefileWhichShapes(&shpfile, bounds, 0);
+    if (!shpfile.status) {
+      return;
+    }
+  }
+
+  const GeoPoint position = { GPS_INFO.Latitude, GPS_INFO.Longitude };
+  const LocalFrame frame(position);
+  auto project = [&](double lon, double lat) {
+    return frame.Forward({lat, lon});
+  };
+
   for (int ixshp = 0; ixshp < shpfile.numshapes; ixshp++) {
 
+    if (cache_mode == 1) {
+      if (msRectOverlap(&shpBounds[ixshp], &bounds) != MS_TRUE) {
+        continue;
+      }
+    } else if (!msGetBit(shpfile.status, ixshp)) {
+      continue;
+    }
+
     std::unique_ptr<XShape> shape_tmp;
     XShape *cshape = shpCache[ixshp];
     if(!cshape) {
-      if((cache_mode == 1) && (msRectOverlap(&shpBounds[ixshp], &bounds) != MS_TRUE)) {
-          // if bounds is in cache and does not overlap no need to load shape;
-          continue;
-      }
       shape_tmp.reset(addShape(ixshp));
       cshape = shape_tmp.get();
     }
 
-	if (!cshape || cshape->hide || !cshape->HasLabel()) continue;
-	const shapeObj& shape = cshape->shape;
+    if (!cshape || cshape->hide || !cshape->HasLabel()) continue;
+    const shapeObj& shape = cshape->shape;
 
-    if(msRectOverlap(&(cshape->shape.bounds), &bounds) != MS_TRUE) {
+    topology::shape_kind kind;
+    switch(shape.type) {
+      case MS_SHAPE_POINT:
+        kind = topology::shape_kind::points;
+        break;
+      case MS_SHAPE_LINE:
+        kind = topology::shape_kind::polyline;
+        break;
+      case MS_SHAPE_POLYGON:
+        kind = topology::shape_kind::polygon;
+        break;
+      default:
         continue;
     }
 
-	switch(shape.type) {
-
-	   case(MS_SHAPE_POINT):
-
-			for (int tt = 0; tt < shape.numlines; tt++) {
-				for (int jj=0; jj< shape.line[tt].numpoints; jj++) {
-					cshape->nearestItem(scaleCategory, shape.line[tt].point[jj].x, shape.line[tt].point[jj].y);
-				}
-			}
-		break;
-
-	   case(MS_SHAPE_LINE):
-/*
-			for (int tt = 0; tt < shape->numlines; tt ++) {
-				//  right implementation is in #msDistancePointToShape, but this don't use great circle ditance.
-				cshape->nearestItem(scaleCategory, shape->line[tt].point[0].x, shape->line[tt].point[0].y);
-			}
-*/
-		break;
-
-	   case(MS_SHAPE_POLYGON):
-
-			for (int tt = 0; tt < shape.numlines; tt ++) {
-                // TODO : check if that is good
-                //  it's surprising distance to Polygon are not distance to first point but
-                //  distance to nearest vertex.
-                //  right implementation is in #msDistancePointToShape, but this don't use great circle ditance.
-				cshape->nearestItem(scaleCategory, shape.line[tt].point[0].x, shape.line[tt].point[0].y);
-			}
-        break;
-
-	   default:
-		break;
-
-    } // switch type of shape
+    // exact distance : nearest vertex, nearest point of lines, or zero inside polygon
+    const topology::nearest_point nearest = topology::shape_nearest(shape, kind, project);
+    if (!nearest.valid()) {
+      continue;
+    }
+    if (nearest.inside) {
+      cshape->nearestItem(scaleCategory, position.longitude, position.latitude);
+    } else {
+      const auto point = nearest.position(shape);
+      cshape->nearestItem(scaleCategory, point.first, point.second);
+    }
   } // for all shapes in this category
 } // Topology SearchNearest
@@ -0,0 +1,217 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   nearest_shape.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _TOPOLOGY_NEAREST_SHAPE_H_
+#define _TOPOLOGY_NEAREST_SHAPE_H_
+
+#include "Math/Point2D.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+/**
+ * Exact nearest point of a shape to a reference position, in a local metric
+ * frame where the reference is the origin : nearest vertex of a point shape,
+ * nearest point of any segment of a polyline, and for a polygon, the reference
+ * itself if it is inside ( even-odd rule, holes are rings too ) or the nearest
+ * point of its border.
+ *
+ * <Shape> is any `shapeObj` like type ( numlines, line[i].numpoints,
+ * line[i].point[j].x/y ), <Project> convert (x, y) of one vertex to local
+ * frame.
+ */
+namespace topology {
+
+using point_t = Point2D<double>;
+
+enum class shape_kind {
+  points,
+  polyline,
+  polygon,
+};
+
+struct nearest_point {
+  double distance = std::numeric_limits<double>::infinity(); // m
+  bool inside = false; // reference is inside polygon
+  int line = -1;       // part of shape
+  int vertex = -1;     // first vertex of nearest segment
+  double ratio = 0.;   // position of nearest point on segment, 0 is <vertex>
+
+  bool valid() const {
+    return line >= 0;
+  }
+
+  /**
+   * geographic coordinate of nearest point, interpolated on segment.
+   */
+  template<typename Shape>
+  std::pair<double, double> position(const Shape& shape) const {
+    const auto& part = shape.line[line];
+    const auto& a = part.point[vertex];
+    if (ratio <= 0.) {
+      return { a.x, a.y };
+    }
+    // last vertex of polygon ring : closing segment
+    const auto& b = part.point[(vertex + 1 < part.numpoints) ? vertex + 1 : 0];
+    return { a.x + (b.x - a.x) * ratio, a.y + (b.y - a.y) * ratio };
+  }
+};
+
+namespace detail {
+
+// squared distance from origin to segment [a, b], <ratio> of nearest point
+inline double segment_distance_sq(const point_t& a, const point_t& b, double& ratio) {
+  const point_t ab = b - a;
+  const double length_sq = ab.x * ab.x + ab.y * ab.y;
+  ratio = (length_sq > 0.) ? std::clamp(-(a.x * ab.x + a.y * ab.y) / length_sq, 0., 1.) : 0.;
+  const point_t p = a + ab * ratio;
+  return p.x * p.x + p.y * p.y;
+}
+
+// does ray from origin toward +x cross segment [a, b]
+inline bool crossing(const point_t& a, const point_t& b) {
+  if ((a.y > 0.) == (b.y > 0.)) {
+    return false;
+  }
+  return a.x + (b.x - a.x) * (-a.y) / (b.y - a.y) > 0.;
+}
+
+} // namespace detail
+
+template<typename Shape, typename Project>
+nearest_point shape_nearest(const Shape& shape, shape_kind kind, Project&& project) {
+  nearest_point result;
+  double best_sq = std::numeric_limits<double>::infinity();
+  bool inside = false;
+
+  for (int l = 0; l < shape.numlines; ++l) {
+    const auto& line = shape.line[l];
+    if (line.numpoints <= 0) {
+      continue;
+    }
+
+    point_t previous = project(line.point[0].x, line.point[0].y);
+    double distance_sq = previous.x * previous.x + previous.y * previous.y;
+    if (distance_sq < best_sq) {
+      best_sq = distance_sq;
+      result.line = l;
+      result.vertex = 0;
+      result.ratio = 0.;
+    }
+
+    for (int v = 1; v < line.numpoints; ++v) {
+      const point_t current = project(line.point[v].x, line.point[v].y);
+      if (kind == shape_kind::points) {
+        distance_sq = current.x * current.x + current.y * current.y;
+        if (distance_sq < best_sq) {
+          best_sq = distance_sq;
+          result.line = l;
+          result.vertex = v;
+          result.ratio = 0.;
+        }
+      } else {
+        double ratio;
+        distance_sq = detail::segment_distance_sq(previous, current, ratio);
+        if (distance_sq < best_sq) {
+          best_sq = distance_sq;
+          result.line = l;
+          result.vertex = (ratio < 1.) ? v - 1 : v;
+          result.ratio = (ratio < 1.) ? ratio : 0.;
+        }
+        if (kind == shape_kind::polygon && detail::crossing(previous, current)) {
+          inside = !inside;
+        }
+      }
+      previous = current;
+    }
+
+    if (kind == shape_kind::polygon && line.numpoints > 1) {
+      // ring closing segment, ignored if ring is already closed
+      const point_t first = project(line.point[0].x, line.point[0].y);
+      if (first != previous) {
+        double ratio;
+        distance_sq = detail::segment_distance_sq(previous, first, ratio);
+        if (distance_sq < best_sq) {
+          best_sq = distance_sq;
+          result.line = l;
+          result.vertex = (ratio < 1.) ? line.numpoints - 1 : 0;
+          result.ratio = (ratio < 1.) ? ratio : 0.;
+        }
+        if (detail::crossing(previous, first)) {
+          inside = !inside;
+        }
+      }
+    }
+  }
+
+  if (result.valid()) {
+    result.inside = inside;
+    result.distance = inside ? 0. : std::sqrt(best_sq);
+  }
+  return result;
+}
+
+/**
+ * <Count> nearest values, sorted by distance.
+ */
+template<typename Value, size_t Count>
+class nearest_list final {
+ public:
+  struct item_t {
+    double distance;
+    Value value;
+  };
+
+  /**
+   * @return false if <value> is not one of nearest
+   */
+  bool insert(double distance, const Value& value) {
+    if (_size == Count && distance >= _items[Count - 1].distance) {
+      return false;
+    }
+    size_t i = (_size < Count) ? _size++ : Count - 1;
+    for (; i > 0 && _items[i - 1].distance > distance; --i) {
+      _items[i] = _items[i - 1];
+    }
+    _items[i] = { distance, value };
+    return true;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  bool empty() const {
+    return _size == 0;
+  }
+
+  const item_t& operator[](size_t i) const {
+    return _items[i];
+  }
+
+  const item_t* begin() const {
+    return _items.data();
+  }
+
+  const item_t* end() const {
+    return _items.data() + _size;
+  }
+
+ private:
+  std::array<item_t, Count> _items = {};
+  size_t _size = 0;
+};
+
+} // namespace topology
+
+#endif // _TOPOLOGY_NEAREST_SHAPE_H_
@@ -10,6 +10,7 @@
 #include "Waypointparser.h"
 #include "LKStyle.h"
 #include "NavFunctions.h"
+#include "Geographic/LocalFrame.h"
 
 
 
@@ -21,6 +22,8 @@ int FindNearestWayPoint(double X, double Y, double MaxRange)
 
   NearestDistance = MaxRange;
 
+  const LocalFrame frame({Y, X});
+
     for(unsigned i=RESWP_FIRST_MARKER;i<WayPointList.size(); ++i) {
 
       // Consider only valid markers
@@ -31,9 +34,7 @@ int FindNearestWayPoint(double X, double Y, double MaxRange)
           continue;
       }
 
-      DistanceBearing(Y,X,
-                      WayPointList[i].Latitude,
-                      WayPointList[i].Longitude, &Dist, NULL);
+      frame.DistanceBearing({WayPointList[i].Latitude, WayPointList[i].Longitude}, &Dist, NULL);
       if(Dist < NearestDistance) {
         NearestIndex = i;
         NearestDistance = Dist;
@@ -326,7 +326,7 @@ bool Startup(const TCHAR* szCmdLine) {
   memset( &(CALCULATED_INFO), 0,sizeof(CALCULATED_INFO));
 
   memset( SnailTrail, 0, sizeof(SnailTrail));
-  memset( LongSnailTrail, 0, sizeof(LongSnailTrail));
+  LongSnailTrail.clear();
 
   ResetBaroAvailable(GPS_INFO);
   ResetVarioAvailable(GPS_INFO);
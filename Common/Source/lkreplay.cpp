@@ -0,0 +1,277 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   lkreplay.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+/*
+ * Headless flight replay.
+ *
+ * Feed an IGC or NMEA file through the real parsers and the calculation
+ * pipeline ( DoCalculationsVario, DoCalculations, DoCalculationsSlow, so also
+ * airspace warnings and contest solving ), without window, draw thread nor
+ * calculation thread, as fast as cpu allow.
+ *
+ * Time is driven by a simulated clock :
+ *  - IGC : ReplayLogger advance of <step> seconds by iteration.
+ *  - NMEA : time of fix, a calculation is done each time the parser trigger
+ *           a gps update, like the calculation thread does.
+ *
+ * Derived values of each fix are written as csv, to stdout or to file.
+ * Without -timing option, output only depends on input files and profile :
+ * it can be used as regression reference for calculation changes.
+ *
+ * usage : LK8000-LINUX-replay [-profile=file] [-step=s] [-out=file] [-timing] flight.igc|flight.nmea
+ */
+
+#include "externs.h"
+#include "Logger.h"
+#include "Comm/device.h"
+#include "ContestMgr.h"
+#include "Headless.h"
+#include "Profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace {
+
+using headless::calculation_pipeline;
+using clock_type = std::chrono::steady_clock;
+
+struct options_t {
+  std::string profile;
+  std::string input;
+  std::string output;
+  double step = 1.0;
+  bool timing = false;
+};
+
+void usage() {
+  fprintf(stderr,
+          "usage : LK8000-replay [options] flight.igc|flight.nmea\n"
+          " -profile=file  profile to load instead of default one\n"
+          " -step=s        IGC replay clock step in seconds, default 1\n"
+          " -out=file      csv output, default stdout\n"
+          " -timing        add calculation time of each fix in csv\n");
+}
+
+bool parse_options(int argc, char *argv[], options_t& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg.compare(0, 9, "-profile=") == 0) {
+      options.profile = arg.substr(9);
+    } else if (arg.compare(0, 6, "-step=") == 0) {
+      options.step = strtod(arg.c_str() + 6, nullptr);
+    } else if (arg.compare(0, 5, "-out=") == 0) {
+      options.output = arg.substr(5);
+    } else if (arg == "-timing") {
+      options.timing = true;
+    } else if (arg[0] == '-') {
+      return false;
+    } else {
+      options.input = arg;
+    }
+  }
+  return !options.input.empty() && options.step > 0;
+}
+
+bool is_igc(const std::string& path) {
+  const size_t dot = path.rfind('.');
+  return dot != std::string::npos && strcasecmp(path.c_str() + dot, ".igc") == 0;
+}
+
+class csv_writer {
+ public:
+  csv_writer(FILE* file, bool timing) : _file(file), _timing(timing) {
+    fprintf(_file, "time,latitude,longitude,altitude,speed,track,nav_altitude,agl,"
+                   "vario,netto,wind_speed,wind_bearing,flying,circling,ld,thermal_avg,"
+                   "task_togo,olc_classic,airspace_warnings%s\n",
+                   _timing ? ",calc_us" : "");
+  }
+
+  void write(const calculation_pipeline& pipeline, unsigned elapsed_us) {
+    const NMEA_INFO& basic = pipeline.basic;
+    const DERIVED_INFO& calculated = pipeline.calculated;
+    const auto olc = CContestMgr::Instance().Result(CContestMgr::TYPE_OLC_CLASSIC, false);
+
+    fprintf(_file, "%.0f,%.6f,%.6f,%.1f,%.2f,%.1f,%.1f,%.1f,%.2f,%.2f,%.2f,%.0f,%d,%d,%.1f,%.2f,%.0f,%u,%u",
+            basic.Time, basic.Latitude, basic.Longitude, basic.Altitude,
+            basic.Speed, basic.TrackBearing, calculated.NavAltitude, calculated.AltitudeAGL,
+            calculated.Vario, calculated.NettoVario, calculated.WindSpeed, calculated.WindBearing,
+            calculated.Flying ? 1 : 0, calculated.Circling ? 1 : 0, calculated.LD,
+            calculated.AverageThermal, calculated.TaskDistanceToGo, olc.Distance(),
+            pipeline.airspace_warnings);
+    if (_timing) {
+      fprintf(_file, ",%u", elapsed_us);
+    }
+    fputc('\n', _file);
+  }
+
+ private:
+  FILE* _file;
+  const bool _timing;
+};
+
+struct replay_stats_t {
+  unsigned fixes = 0;
+  double first_time = -1;
+  double last_time = 0; // replay don't set time before first valid point
+  clock_type::duration calc_time = {};
+};
+
+/**
+ * run calculations and write csv row if we have a valid fix and time has
+ * advanced since last row.
+ */
+void process_fix(calculation_pipeline& pipeline, csv_writer& csv, replay_stats_t& stats) {
+  const auto start = clock_type::now();
+  pipeline.run();
+  const auto elapsed = clock_type::now() - start;
+  stats.calc_time += elapsed;
+
+  const double time = pipeline.basic.Time;
+  if (pipeline.basic.NAVWarning || time <= stats.last_time) {
+    return;
+  }
+  if (stats.first_time < 0) {
+    stats.first_time = time;
+  }
+  stats.last_time = time;
+  ++stats.fixes;
+
+  csv.write(pipeline, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+bool replay_igc(const options_t& options, calculation_pipeline& pipeline, csv_writer& csv, replay_stats_t& stats) {
+  RUN_MODE = RUN_SIM;
+
+  LockFlightData();
+  GPS_INFO.NAVWarning = false;
+  GPS_INFO.SatellitesUsed = 6;
+  UnlockFlightData();
+
+  const tstring path = to_tstring(options.input.c_str());
+  ReplayLogger::SimulatedStep = options.step;
+  ReplayLogger::SetFilename(path.c_str());
+  ReplayLogger::Start();
+  if (!ReplayLogger::IsEnabled()) {
+    return false;
+  }
+  while (ReplayLogger::Update()) {
+    process_fix(pipeline, csv, stats);
+  }
+
+  return true;
+}
+
+bool replay_nmea(const options_t& options, calculation_pipeline& pipeline, csv_writer& csv, replay_stats_t& stats) {
+  RUN_MODE = RUN_FLY;
+
+  FILE* file = fopen(options.input.c_str(), "rt");
+  if (!file) {
+    return false;
+  }
+
+  DeviceDescriptor_t& device = DeviceList[0];
+  device.nmeaParser.activeGPS = true;
+
+  dataTriggerEvent.reset();
+
+  char line[MAX_NMEA_LEN];
+  while (fgets(line, std::size(line), file)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    device.nmeaParser.ParseNMEAString_Internal(device, line, &GPS_INFO);
+
+    if (dataTriggerEvent.tryWait(0)) {
+      dataTriggerEvent.reset();
+      process_fix(pipeline, csv, stats);
+    }
+  }
+  fclose(file);
+
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+
+  options_t options;
+  if (!parse_options(argc, argv, options)) {
+    usage();
+    return 2;
+  }
+
+  if (options.input[0] != '/') {
+    // ReplayLogger use LKD_LOGS for relative path.
+    char* absolute = realpath(options.input.c_str(), nullptr);
+    if (absolute) {
+      options.input = absolute;
+      free(absolute);
+    }
+  }
+
+  FILE* input = fopen(options.input.c_str(), "rt");
+  if (!input) {
+    fprintf(stderr, "cannot open <%s>\n", options.input.c_str());
+    return 1;
+  }
+  fclose(input);
+
+  FILE* output = stdout;
+  if (!options.output.empty()) {
+    output = fopen(options.output.c_str(), "wt");
+    if (!output) {
+      fprintf(stderr, "cannot create <%s>\n", options.output.c_str());
+      return 1;
+    }
+  }
+
+  headless::initialise(options.profile.empty() ? nullptr : options.profile.c_str());
+  profiler::reset();
+
+  auto pipeline = std::make_unique<calculation_pipeline>();
+  csv_writer csv(output, options.timing);
+  replay_stats_t stats;
+
+  const auto start = clock_type::now();
+  const bool success = is_igc(options.input)
+                     ? replay_igc(options, *pipeline, csv, stats)
+                     : replay_nmea(options, *pipeline, csv, stats);
+  const auto wall_time = clock_type::now() - start;
+
+  if (output != stdout) {
+    fclose(output);
+  }
+
+  if (!success) {
+    fprintf(stderr, "replay of <%s> failed\n", options.input.c_str());
+    return 1;
+  }
+
+  using seconds = std::chrono::duration<double>;
+  const double wall = seconds(wall_time).count();
+  const double calc = seconds(stats.calc_time).count();
+  const double flight = (stats.fixes > 0) ? stats.last_time - stats.first_time : 0.;
+
+  fprintf(stderr, "fixes : %u, flight time : %.0f s\n", stats.fixes, flight);
+  fprintf(stderr, "wall time : %.3f s, calculation time : %.3f s\n", wall, calc);
+  if (wall > 0) {
+    fprintf(stderr, "%.0f fixes/s, %.0fx real time\n", stats.fixes / wall, flight / wall);
+  }
+  for (auto id : { profiler::probe::DoCalculations, profiler::probe::DoCalculationsSlow }) {
+    const profiler::stats_t probe = profiler::get_stats(id);
+    fprintf(stderr, "%s : count %u, mean %u us, p95 %u us, max %u us\n",
+            to_utf8(profiler::name(id)).c_str(), probe.count, probe.mean, probe.p95, probe.max);
+  }
+
+  return 0;
+}
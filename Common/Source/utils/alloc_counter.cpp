@@ -0,0 +1,95 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   alloc_counter.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "alloc_counter.h"
+
+#ifndef NDEBUG
+
+#include "Compiler.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local uint64_t allocation_count = 0;
+
+} // namespace
+
+namespace alloc_counter {
+
+uint64_t thread_count() {
+  return allocation_count;
+}
+
+} // namespace alloc_counter
+
+/*
+ * replacement operators are never inlined, to avoid false positive of
+ * -Wmismatched-new-delete.
+ */
+gcc_noinline
+void* operator new(size_t size) {
+  ++allocation_count;
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    void* ptr = malloc(size);
+    if (ptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+gcc_noinline
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+gcc_noinline
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return operator new(size);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+gcc_noinline
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return operator new(size, std::nothrow);
+}
+
+gcc_noinline
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete[](void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+#endif // !NDEBUG
@@ -0,0 +1,38 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   alloc_counter.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_ALLOC_COUNTER_H_
+#define _UTILS_ALLOC_COUNTER_H_
+
+#include <cstdint>
+
+/**
+ * Number of heap allocations done through operator new by the calling thread.
+ *
+ * Only available in debug build : global operator new is replaced by a
+ * counting one, release build keep the default operator.
+ */
+namespace alloc_counter {
+
+#ifndef NDEBUG
+constexpr bool enabled = true;
+
+uint64_t thread_count();
+#else
+constexpr bool enabled = false;
+
+inline uint64_t thread_count() {
+  return 0;
+}
+#endif
+
+} // namespace alloc_counter
+
+#endif // _UTILS_ALLOC_COUNTER_H_
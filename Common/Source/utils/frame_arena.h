@@ -0,0 +1,158 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   frame_arena.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_FRAME_ARENA_H_
+#define _UTILS_FRAME_ARENA_H_
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * Bump allocator for scratch buffers whose lifetime is one draw frame.
+ *
+ * Allocation only advance an offset inside current block, memory is released
+ * all at once by `reset()`, at end of frame. When a frame needs more than
+ * current capacity, a new heap block is added, and `reset()` merge all blocks
+ * in one block large enough for the peak usage : after first frames,
+ * steady-state drawing doesn't allocate from heap anymore.
+ *
+ * Not thread safe : an arena belongs to one thread.
+ */
+class frame_arena final {
+  static constexpr size_t max_align = alignof(std::max_align_t);
+
+ public:
+  explicit frame_arena(size_t initial_size) {
+    add_block(initial_size);
+  }
+
+  frame_arena(const frame_arena&) = delete;
+  frame_arena& operator=(const frame_arena&) = delete;
+
+  void* allocate(size_t size, size_t align) {
+    if (align > max_align) {
+      throw std::bad_alloc();
+    }
+    size_t offset = align_up(_offset, align);
+    if (offset + size > _blocks.back().size) {
+      add_block(std::max(size, _blocks.back().size * 2));
+      offset = 0;
+    }
+    _last = _offset;
+    _offset = offset + size;
+    return _blocks.back().data.get() + offset;
+  }
+
+  /**
+   * memory is released by `reset()`, except for the most recent allocation,
+   * which is given back immediately : short-lived temporaries don't consume
+   * the block.
+   */
+  void deallocate(void* ptr, size_t size) noexcept {
+    std::byte* p = static_cast<std::byte*>(ptr);
+    if (p + size == _blocks.back().data.get() + _offset) {
+      _offset = _last;
+    }
+  }
+
+  /**
+   * release all allocations, must be called when no container using this
+   * arena is alive anymore.
+   */
+  void reset() {
+    if (_blocks.size() > 1) {
+      size_t capacity = 0;
+      for (const auto& block : _blocks) {
+        capacity += block.size;
+      }
+      _blocks.clear();
+      add_block(capacity);
+    }
+    _offset = 0;
+    _last = 0;
+  }
+
+  size_t capacity() const {
+    return _blocks.back().size;
+  }
+
+  size_t block_count() const {
+    return _blocks.size();
+  }
+
+ private:
+  static constexpr size_t align_up(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+  }
+
+  void add_block(size_t size) {
+    size = align_up(size, max_align);
+    // operator new return memory aligned for any fundamental type
+    _blocks.push_back({ std::make_unique<std::byte[]>(size), size });
+    _offset = 0;
+    _last = 0;
+  }
+
+  struct block_t {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+  };
+
+  std::vector<block_t> _blocks;
+  size_t _offset = 0;  // first free byte of last block
+  size_t _last = 0;    // offset before the most recent allocation
+};
+
+/**
+ * STL allocator on top of frame_arena.
+ */
+template<typename T>
+class frame_allocator {
+ public:
+  using value_type = T;
+
+  explicit frame_allocator(frame_arena& arena) noexcept : _arena(&arena) {}
+
+  template<typename U>
+  frame_allocator(const frame_allocator<U>& other) noexcept : _arena(other.arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, size_t n) noexcept {
+    _arena->deallocate(ptr, n * sizeof(T));
+  }
+
+  frame_arena* arena() const noexcept {
+    return _arena;
+  }
+
+ private:
+  frame_arena* _arena;
+};
+
+template<typename T, typename U>
+bool operator==(const frame_allocator<T>& lhs, const frame_allocator<U>& rhs) noexcept {
+  return lhs.arena() == rhs.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const frame_allocator<T>& lhs, const frame_allocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+template<typename T>
+using frame_vector = std::vector<T, frame_allocator<T>>;
+
+#endif // _UTILS_FRAME_ARENA_H_
@@ -0,0 +1,119 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   log_queue.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_LOG_QUEUE_H_
+#define _UTILS_LOG_QUEUE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Bounded multi-producer queue without lock, for log lines.
+ *
+ * Ring of <Capacity> cells, each cell has a sequence number telling if it's
+ * ready for writing or for reading ( D. Vyukov bounded MPMC queue ) :
+ * producers and consumer only compete on an atomic index, never on a mutex,
+ * so a thread that log never waits for the thread writing to storage.
+ *
+ * When queue is full, `push()` discard the oldest entries : recent lines are
+ * the most useful to understand what happen.
+ */
+template<typename T, size_t Capacity>
+class log_queue final {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+  static constexpr size_t mask = Capacity - 1;
+
+ public:
+  log_queue() {
+    for (size_t i = 0; i < Capacity; ++i) {
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  log_queue(const log_queue&) = delete;
+  log_queue& operator=(const log_queue&) = delete;
+
+  /**
+   * @return false if queue is full
+   */
+  bool try_push(const T& value) {
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+      cell_t& cell = _cells[pos & mask];
+      const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.data = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false; // full
+      } else {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @return false if queue is empty
+   */
+  bool pop(T& value) {
+    size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+    while (true) {
+      cell_t& cell = _cells[pos & mask];
+      const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          value = cell.data;
+          cell.sequence.store(pos + Capacity, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false; // empty
+      } else {
+        pos = _dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * push <value>, discarding oldest entries if queue is full.
+   * @return number of discarded entries
+   */
+  unsigned push(const T& value) {
+    unsigned dropped = 0;
+    while (!try_push(value)) {
+      T oldest;
+      if (pop(oldest)) {
+        ++dropped;
+      }
+    }
+    return dropped;
+  }
+
+ private:
+  struct cell_t {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  std::array<cell_t, Capacity> _cells;
+
+  // producers and consumer indexes on different cache line
+  alignas(64) std::atomic<size_t> _enqueue_pos = 0;
+  alignas(64) std::atomic<size_t> _dequeue_pos = 0;
+};
+
+#endif // _UTILS_LOG_QUEUE_H_
@@ -0,0 +1,163 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   log_writer.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_LOG_WRITER_H_
+#define _UTILS_LOG_WRITER_H_
+
+#include "log_queue.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+/**
+ * Background writer of log lines.
+ *
+ * Lines are queued by calling threads in a `log_queue` and written to
+ * <Output> by a background thread : caller never waits for storage. Output is
+ * flushed after each batch of lines and synced at most every `sync_period`.
+ *
+ * <Output> must provide :
+ *  - `void write(const Line& line)`
+ *  - `void lost(unsigned count)` : <count> lines dropped, queue was full
+ *  - `void flush(bool sync)` : end of batch, <sync> to sync storage
+ *
+ * Before `start()` and after `stop()`, lines are written by calling thread.
+ */
+template<typename Line, size_t Capacity, typename Output>
+class log_writer final {
+ public:
+  static constexpr std::chrono::milliseconds sync_period = std::chrono::milliseconds(2000);
+  static constexpr std::chrono::milliseconds idle_period = std::chrono::milliseconds(1000);
+
+  explicit log_writer(Output& output) : _output(output) {}
+
+  log_writer(const log_writer&) = delete;
+  log_writer& operator=(const log_writer&) = delete;
+
+  ~log_writer() {
+    stop();
+  }
+
+  /**
+   * start writer thread.
+   * @return false if thread can't be started, lines are written by caller.
+   */
+  bool start() {
+    // set before thread start : run() can be entered before start() return.
+    _running.store(true, std::memory_order_release);
+    try {
+      _thread = std::thread(&log_writer::run, this);
+    } catch (const std::system_error&) {
+      _running.store(false, std::memory_order_release);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * stop writer thread, then write pending lines and sync output.
+   */
+  void stop() {
+    if (_thread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(_event_mutex);
+        _running.store(false, std::memory_order_release);
+      }
+      _event.notify_one();
+      _thread.join();
+    }
+    write_pending(true);
+  }
+
+  void push(const Line& line) {
+    const unsigned dropped = _queue.push(line);
+    if (dropped) {
+      _dropped_count.fetch_add(dropped, std::memory_order_relaxed);
+    }
+    if (_running.load(std::memory_order_acquire)) {
+      {
+        std::lock_guard<std::mutex> lock(_event_mutex);
+        _signaled = true;
+      }
+      _event.notify_one();
+    } else {
+      write_pending(false);
+    }
+  }
+
+  /**
+   * write pending lines and sync output, from calling thread.
+   */
+  void flush() {
+    write_pending(true);
+  }
+
+ private:
+  void run() {
+    while (_running.load(std::memory_order_acquire)) {
+      {
+        std::unique_lock<std::mutex> lock(_event_mutex);
+        _event.wait_for(lock, idle_period, [&]() {
+          return _signaled || !_running.load(std::memory_order_acquire);
+        });
+        _signaled = false;
+      }
+      write_pending(false);
+    }
+  }
+
+  void write_pending(bool sync) {
+    std::lock_guard<std::mutex> lock(_write_mutex);
+
+    bool written = false;
+    while (_queue.pop(_line)) {
+      _output.write(_line);
+      written = true;
+    }
+
+    const unsigned dropped = _dropped_count.exchange(0, std::memory_order_relaxed);
+    if (dropped) {
+      _output.lost(dropped);
+      written = true;
+    }
+
+    _unsynced = _unsynced || written;
+    const auto now = std::chrono::steady_clock::now();
+    const bool do_sync = _unsynced && (sync || (now - _last_sync) >= sync_period);
+    if (written || do_sync) {
+      _output.flush(do_sync);
+    }
+    if (do_sync) {
+      _unsynced = false;
+      _last_sync = now;
+    }
+  }
+
+  Output& _output;
+
+  log_queue<Line, Capacity> _queue;
+  std::atomic<unsigned> _dropped_count = 0;
+  std::atomic<bool> _running = false;
+
+  std::mutex _event_mutex;
+  std::condition_variable _event;
+  bool _signaled = false;
+  std::thread _thread;
+
+  std::mutex _write_mutex; // writer thread, or caller of flush()
+  Line _line; // read buffer
+  bool _unsynced = false;
+  std::chrono::steady_clock::time_point _last_sync = {};
+};
+
+#endif // _UTILS_LOG_WRITER_H_
@@ -0,0 +1,177 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   name_search_index.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+#include "options.h"
+#include "name_search_index.h"
+#include "stringext.h"
+#include <algorithm>
+#include <iterator>
+#include <cctype>
+
+bool name_search_index::trigrams(const TCHAR* string, std::vector<key_t>& out) {
+  out.clear();
+
+  char folded[256];
+  const size_t length = to_usascii(string, folded);
+  for (size_t i = 0; i < length; ++i) {
+    folded[i] = tolower(static_cast<unsigned char>(folded[i]));
+  }
+
+  for (size_t i = 2; i < length; ++i) {
+    out.push_back(static_cast<unsigned char>(folded[i - 2]) << 16
+                | static_cast<unsigned char>(folded[i - 1]) << 8
+                | static_cast<unsigned char>(folded[i]));
+  }
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+
+  return length < std::size(folded) - 1;
+}
+
+void name_search_index::add(const TCHAR* name) {
+  const unsigned id = _size++;
+
+  std::vector<key_t> keys;
+  if (!trigrams(name, keys)) {
+    _unindexed.push_back(id);
+    return;
+  }
+  for (key_t key : keys) {
+    _postings.push_back({key, id});
+  }
+}
+
+void name_search_index::build() {
+  // id are added in ascending order : stable sort keep ids sorted for each key.
+  std::stable_sort(_postings.begin(), _postings.end(), [](const posting_t& a, const posting_t& b) {
+    return a.key < b.key;
+  });
+  _postings.shrink_to_fit();
+}
+
+bool name_search_index::candidates(const TCHAR* filter, std::vector<unsigned>& out) const {
+  out.clear();
+
+  std::vector<key_t> keys;
+  trigrams(filter, keys);
+  if (keys.empty()) {
+    return false;
+  }
+
+  auto by_key = [](const posting_t& a, const posting_t& b) {
+    return a.key < b.key;
+  };
+
+  using range_t = std::pair<std::vector<posting_t>::const_iterator, std::vector<posting_t>::const_iterator>;
+  std::vector<range_t> ranges;
+  ranges.reserve(keys.size());
+  for (key_t key : keys) {
+    ranges.push_back(std::equal_range(_postings.begin(), _postings.end(), posting_t{key, 0}, by_key));
+  }
+
+  // start from rarest trigram, each intersection can only reduce the result.
+  std::sort(ranges.begin(), ranges.end(), [](const range_t& a, const range_t& b) {
+    return std::distance(a.first, a.second) < std::distance(b.first, b.second);
+  });
+
+  std::transform(ranges.front().first, ranges.front().second, std::back_inserter(out), [](const posting_t& p) {
+    return p.id;
+  });
+
+  std::vector<unsigned> next;
+  for (auto it = std::next(ranges.begin()); it != ranges.end() && !out.empty(); ++it) {
+    next.clear();
+    auto posting = it->first;
+    for (unsigned id : out) {
+      // both list are sorted by id.
+      posting = std::lower_bound(posting, it->second, id, [](const posting_t& p, unsigned id) {
+        return p.id < id;
+      });
+      if (posting == it->second) {
+        break;
+      }
+      if (posting->id == id) {
+        next.push_back(id);
+      }
+    }
+    std::swap(out, next);
+  }
+
+  if (!_unindexed.empty()) {
+    next.clear();
+    std::merge(out.begin(), out.end(), _unindexed.begin(), _unindexed.end(), std::back_inserter(next));
+    std::swap(out, next);
+  }
+  return true;
+}
+
+#ifndef DOCTEST_CONFIG_DISABLE
+#include <doctest/doctest.h>
+
+TEST_CASE("name_search_index") {
+
+  const TCHAR* names[] = {
+    _T("Saint-Auban"),
+    _T("Sisteron"),
+    _T("Serres La Batie"),
+    _T("ST AUBAN AERODROME"),
+    _T("Gap Tallard"),
+    _T("Puimoisson"),
+    _T("Vinon"),
+    _T("Fayence"),
+    _T("Château-Arnoux"),
+  };
+
+  name_search_index index;
+  for (auto name : names) {
+    index.add(name);
+  }
+  index.build();
+  CHECK(index.size() == std::size(names));
+
+  std::vector<unsigned> out;
+
+  SUBCASE("short filter") {
+    CHECK_FALSE(index.candidates(_T(""), out));
+    CHECK_FALSE(index.candidates(_T("au"), out));
+  }
+
+  SUBCASE("superset of substring match") {
+    for (auto filter : { _T("aub"), _T("AUBAN"), _T("ron"), _T("Tal"), _T("ence"), _T("xyz"), _T("on"), _T("CHÂT") }) {
+      std::vector<unsigned> expected;
+      for (unsigned i = 0; i < std::size(names); ++i) {
+        if (ci_search_substr(names[i], filter)) {
+          expected.push_back(i);
+        }
+      }
+      if (index.candidates(filter, out)) {
+        CHECK(std::is_sorted(out.begin(), out.end()));
+        CHECK(std::includes(out.begin(), out.end(), expected.begin(), expected.end()));
+      }
+    }
+  }
+
+  SUBCASE("exact candidates") {
+    CHECK(index.candidates(_T("auban"), out));
+    CHECK(out == std::vector<unsigned>({0, 3}));
+
+    CHECK(index.candidates(_T("xyz"), out));
+    CHECK(out.empty());
+
+    CHECK(index.candidates(_T("-Au"), out));
+    CHECK(out == std::vector<unsigned>({0}));
+
+    // accents are folded
+    CHECK(index.candidates(_T("chat"), out));
+    CHECK(out == std::vector<unsigned>({8}));
+  }
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   name_search_index.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_NAME_SEARCH_INDEX_H_
+#define _UTILS_NAME_SEARCH_INDEX_H_
+
+#include <tchar.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Trigram index of names, to find names that can contain a substring without
+ * testing all of them.
+ *
+ * Names are folded to lower case US-ASCII ( `to_usascii()` ) before indexing,
+ * so the result is a superset of names matching `ci_search_substr()` : caller
+ * must still test each candidate.
+ */
+class name_search_index final {
+ public:
+  name_search_index() = default;
+
+  name_search_index(const name_search_index&) = delete;
+  name_search_index& operator=(const name_search_index&) = delete;
+
+  /**
+   * add <name> to index, id of name is number of names added before.
+   * `build()` must be called after last name.
+   */
+  void add(const TCHAR* name);
+
+  void build();
+
+  size_t size() const {
+    return _size;
+  }
+
+  /**
+   * @return false if <filter> is too short to use the index, all names must be tested.
+   *    otherwise, <out> is filled with id of names that can contain <filter>, in ascending order.
+   */
+  bool candidates(const TCHAR* filter, std::vector<unsigned>& out) const;
+
+ private:
+  using key_t = uint32_t;
+
+  struct posting_t {
+    key_t key;
+    unsigned id;
+  };
+
+  /**
+   * @return folded trigrams of <string>, false if string was too long to be entirely folded.
+   */
+  static bool trigrams(const TCHAR* string, std::vector<key_t>& out);
+
+  std::vector<posting_t> _postings; // sorted by key, then id
+  std::vector<unsigned> _unindexed; // names too long to be indexed, always candidate
+  unsigned _size = 0;
+};
+
+#endif // _UTILS_NAME_SEARCH_INDEX_H_
@@ -0,0 +1,146 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   time_series.h
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef _UTILS_TIME_SERIES_H_
+#define _UTILS_TIME_SERIES_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * (x, y) samples of a whole flight in bounded memory.
+ *
+ * Samples are stored in buckets of `span()` consecutive samples, keeping
+ * x range and y min/max/mean. When `capacity` buckets are used, pairs of
+ * buckets are merged and span is doubled : append is O(1) amortized,
+ * memory never exceed `capacity` buckets and the series always covers all
+ * samples, with a resolution between `capacity/2` and `capacity` buckets.
+ *
+ * x must be appended in ascending order.
+ *
+ * Storage is allocated at first append and never moved after : like the
+ * fixed arrays it replaces, a reader racing with the calc thread can see
+ * inconsistent values, but never freed memory.
+ */
+class time_series final {
+ public:
+  static constexpr size_t capacity = 1024;
+
+  struct bucket_t {
+    float x_first;
+    float x_last;
+    float y_min;
+    float y_max;
+    double y_sum;
+    unsigned count;
+
+    double y_mean() const {
+      return y_sum / count;
+    }
+
+    void merge(const bucket_t& other) {
+      x_last = other.x_last;
+      y_min = std::min(y_min, other.y_min);
+      y_max = std::max(y_max, other.y_max);
+      y_sum += other.y_sum;
+      count += other.count;
+    }
+  };
+
+  void clear() {
+    _buckets.clear();
+    _span = 1;
+  }
+
+  void append(double x, double y) {
+    const bucket_t sample = {
+      static_cast<float>(x), static_cast<float>(x),
+      static_cast<float>(y), static_cast<float>(y),
+      y, 1
+    };
+    if (!_buckets.empty() && _buckets.back().count < _span) {
+      _buckets.back().merge(sample);
+      return;
+    }
+    if (_buckets.size() >= capacity) {
+      compact();
+    }
+    if (_buckets.capacity() < capacity) {
+      _buckets.reserve(capacity);
+    }
+    _buckets.push_back(sample);
+  }
+
+  bool empty() const {
+    return _buckets.empty();
+  }
+
+  /**
+   * number of samples by bucket.
+   */
+  unsigned span() const {
+    return _span;
+  }
+
+  const std::vector<bucket_t>& buckets() const {
+    return _buckets;
+  }
+
+  /**
+   * Merge buckets into at most <bins> buckets of equal x range, empty bins
+   * are skipped. Cost is O(buckets), whatever the number of samples.
+   *
+   * @param bins usually width in pixels of the graph.
+   */
+  void resample(size_t bins, std::vector<bucket_t>& out) const {
+    out.clear();
+    if (_buckets.size() <= bins) {
+      out = _buckets;
+      return;
+    }
+    if (bins == 0) {
+      return;
+    }
+
+    const double x0 = _buckets.front().x_first;
+    const double range = _buckets.back().x_last - x0;
+    size_t last_bin = 0;
+    for (const bucket_t& bucket : _buckets) {
+      const double x = (bucket.x_first + bucket.x_last) / 2.;
+      const size_t bin = (range > 0) ? std::min<size_t>((x - x0) * bins / range, bins - 1) : 0;
+      if (!out.empty() && bin == last_bin) {
+        out.back().merge(bucket);
+      } else {
+        out.push_back(bucket);
+        last_bin = bin;
+      }
+    }
+  }
+
+ private:
+  void compact() {
+    const size_t size = _buckets.size();
+    for (size_t i = 0; i < size / 2; ++i) {
+      _buckets[i] = _buckets[2 * i];
+      _buckets[i].merge(_buckets[2 * i + 1]);
+    }
+    if (size & 1) {
+      _buckets[size / 2] = _buckets[size - 1];
+    }
+    _buckets.resize((size + 1) / 2);
+    _span *= 2;
+  }
+
+  std::vector<bucket_t> _buckets;
+  unsigned _span = 1;
+};
+
+#endif // _UTILS_TIME_SERIES_H_
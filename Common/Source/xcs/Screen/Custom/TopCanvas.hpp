@@ -57,6 +57,10 @@ Copyright_License {
 #include "Time/PeriodClock.hpp"
 #endif
 
+#ifdef USE_FB
+#include "Screen/Memory/DamageTracker.hpp"
+#endif
+
 #include <stdint.h>
 
 #ifdef SOFTWARE_ROTATE_DISPLAY
@@ -152,6 +156,12 @@ class TopCanvas
   unsigned map_pitch, map_bpp;
 
   uint32_t epd_update_marker;
+
+  /**
+   * Regions of #buffer changed since last Flip(), only those are
+   * converted and sent to the display.
+   */
+  DamageTracker damage;
 #endif
 
 #ifdef KOBO
@@ -189,6 +189,7 @@ TopCanvas::Create(PixelSize new_size,
 
   map_pitch = finfo.line_length;
   epd_update_marker = 0;
+  damage.Invalidate();
 
 #ifdef KOBO
   int updateSheme = UPDATE_SCHEME_QUEUE_AND_MERGE;
@@ -262,6 +263,9 @@ TopCanvas::CheckResize(const PixelSize new_native_size)
 
   buffer.Free();
   buffer.Allocate(new_size.cx, new_size.cy);
+#ifdef USE_FB
+  damage.Invalidate();
+#endif
   return true;
 }
 
@@ -281,28 +285,53 @@ TopCanvas::Flip()
 {
 #ifdef USE_FB
 
+  DamageTracker::Regions regions;
+  unsigned n_regions = damage.Update(buffer.data, buffer.pitch,
+                                     buffer.width, buffer.height,
+                                     sizeof(*buffer.data), regions);
+
+#if defined(GREYSCALE) && defined(DITHER) && !defined(KOBO)
+  if (n_regions > 0 && map_bpp == 4) {
+    /* in place 8 to 32 bits expansion works only on whole frame */
+    regions[0] = { 0, 0, buffer.width, buffer.height };
+    n_regions = 1;
+  }
+#endif
+
+  for (unsigned i = 0; i < n_regions; ++i) {
+    const DamageTracker::Region &rc = regions[i];
+    const decltype(buffer) src = {
+      buffer.At(rc.left, rc.top), buffer.pitch, rc.Width(), rc.Height()
+    };
+    uint8_t *dest = static_cast<uint8_t *>(map)
+      + rc.top * map_pitch + rc.left * map_bpp;
+
 #ifdef GREYSCALE
-  CopyFromGreyscale(
+    CopyFromGreyscale(
 #ifdef DITHER
-                    dither,
+                      dither,
 #endif
 #ifdef KOBO
-                    enable_dither,
+                      enable_dither,
 #endif
-                    map, map_pitch, map_bpp,
-                    buffer);
+                      dest, map_pitch, map_bpp,
+                      src);
 #else
-  CopyFromBGRA(map, map_pitch, map_bpp, buffer);
+    CopyFromBGRA(dest, map_pitch, map_bpp, src);
 #endif
+  }
 
 
 #ifdef KOBO
-  
+
+  if (n_regions == 0 && !unghost) {
+    /* nothing changed since last update */
+    return;
+  }
+
   if(frame_sync) {
     Wait();
   }
-  
-  epd_update_marker++;
 
   struct mxcfb_update_data epd_update_data = {
     {
@@ -321,14 +350,24 @@ TopCanvas::Flip()
     // 1s + 0 to gps fix interval delay before do unghost
     if (unghost_request_time.Check(1000)) {
         unghost = false;
+        epd_update_data.update_marker = ++epd_update_marker;
         epd_update_data.flags |= EPDC_FLAG_ENABLE_INVERSION;
         ioctl(fd, MXCFB_SEND_UPDATE, &epd_update_data);
         Wait();
         epd_update_data.flags &= ~EPDC_FLAG_ENABLE_INVERSION;
+        /* restore whole screen */
+        regions[0] = { 0, 0, buffer.width, buffer.height };
+        n_regions = 1;
     }
   }
-  
-  ioctl(fd, MXCFB_SEND_UPDATE, &epd_update_data);
+
+  // one update by damaged region, the controller merge them.
+  for (unsigned i = 0; i < n_regions; ++i) {
+    const DamageTracker::Region &rc = regions[i];
+    epd_update_data.update_region = { rc.top, rc.left, rc.Width(), rc.Height() };
+    epd_update_data.update_marker = ++epd_update_marker;
+    ioctl(fd, MXCFB_SEND_UPDATE, &epd_update_data);
+  }
 #endif
 
 #endif /* USE_FB */
@@ -0,0 +1,185 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   DamageTracker.hpp
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef XCSOAR_SCREEN_MEMORY_DAMAGE_TRACKER_HPP
+#define XCSOAR_SCREEN_MEMORY_DAMAGE_TRACKER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * Regions of a memory frame buffer changed since last flip.
+ *
+ * Damage is found by comparing the back buffer with a shadow copy of the
+ * last flipped frame, so every drawing path (Canvas, SubCanvas, bitmap
+ * copy, direct pixel access ...) is covered without tracking each
+ * operation. Comparing is a plain `memcmp`, much cheaper than dithering
+ * and sending the whole screen to the display controller.
+ *
+ * Changed rows are grouped by bands of `band_height` lines, consecutive
+ * bands with overlapping columns are merged, and the result is reduced
+ * to at most `max_regions` rectangles.
+ */
+class DamageTracker {
+public:
+  struct Region {
+    unsigned left, top, right, bottom; // right and bottom excluded
+
+    unsigned Width() const {
+      return right - left;
+    }
+
+    unsigned Height() const {
+      return bottom - top;
+    }
+
+    unsigned Area() const {
+      return Width() * Height();
+    }
+  };
+
+  static constexpr unsigned band_height = 16;
+  static constexpr unsigned max_regions = 4;
+
+  using Regions = Region[max_regions];
+
+private:
+  std::vector<uint8_t> shadow;
+  unsigned width = 0, height = 0, bpp = 0;
+  bool valid = false;
+
+  static Region Union(const Region &a, const Region &b) {
+    return {
+      std::min(a.left, b.left), std::min(a.top, b.top),
+      std::max(a.right, b.right), std::max(a.bottom, b.bottom)
+    };
+  }
+
+  /**
+   * merge the two consecutive regions which add the smallest area.
+   */
+  static void MergeClosest(Region *regions, unsigned &count) {
+    unsigned best = 0;
+    unsigned best_cost = UINT32_MAX;
+    for (unsigned i = 0; i + 1 < count; ++i) {
+      const Region u = Union(regions[i], regions[i + 1]);
+      const unsigned cost = u.Area() - regions[i].Area() - regions[i + 1].Area();
+      if (cost < best_cost) {
+        best_cost = cost;
+        best = i;
+      }
+    }
+    regions[best] = Union(regions[best], regions[best + 1]);
+    std::copy(regions + best + 2, regions + count, regions + best + 1);
+    --count;
+  }
+
+public:
+  /**
+   * next `Update()` will report the whole frame as damaged.
+   */
+  void Invalidate() {
+    valid = false;
+  }
+
+  /**
+   * Compare <data> with last frame and remember it as last frame.
+   *
+   * @param data first pixel of frame
+   * @param pitch bytes per row of <data>
+   * @param bytes_per_pixel size of one pixel
+   * @return number of damaged regions stored in <out>, sorted top to bottom
+   */
+  unsigned Update(const void *data, unsigned pitch,
+                  unsigned _width, unsigned _height, unsigned bytes_per_pixel,
+                  Regions &out) {
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    const size_t row_size = size_t(_width) * bytes_per_pixel;
+
+    if (!valid || _width != width || _height != height || bytes_per_pixel != bpp) {
+      width = _width;
+      height = _height;
+      bpp = bytes_per_pixel;
+      shadow.resize(row_size * height);
+      for (unsigned y = 0; y < height; ++y) {
+        memcpy(&shadow[y * row_size], src + size_t(y) * pitch, row_size);
+      }
+      valid = true;
+      if (width == 0 || height == 0) {
+        return 0;
+      }
+      out[0] = { 0, 0, width, height };
+      return 1;
+    }
+
+    Region regions[max_regions + 1];
+    unsigned count = 0;
+
+    for (unsigned band = 0; band < height; band += band_height) {
+      const unsigned band_end = std::min(band + band_height, height);
+
+      size_t first = row_size, last = 0; // byte range, last excluded
+      unsigned top = band_end, bottom = band;
+
+      for (unsigned y = band; y < band_end; ++y) {
+        const uint8_t *row = src + size_t(y) * pitch;
+        uint8_t *old_row = &shadow[y * row_size];
+        if (memcmp(row, old_row, row_size) == 0) {
+          continue;
+        }
+
+        size_t l = 0;
+        while (row[l] == old_row[l]) {
+          ++l;
+        }
+        size_t r = row_size;
+        while (row[r - 1] == old_row[r - 1]) {
+          --r;
+        }
+        memcpy(old_row + l, row + l, r - l);
+
+        first = std::min(first, l);
+        last = std::max(last, r);
+        top = std::min(top, y);
+        bottom = y + 1;
+      }
+
+      if (first >= last) {
+        continue; // band unchanged
+      }
+
+      const Region region = {
+        unsigned(first / bpp), top,
+        unsigned((last + bpp - 1) / bpp), bottom
+      };
+
+      if (count > 0) {
+        Region &previous = regions[count - 1];
+        // consecutive bands with overlapping columns are the same object.
+        if (previous.bottom + band_height > band && region.left < previous.right && previous.left < region.right) {
+          previous = Union(previous, region);
+          continue;
+        }
+      }
+
+      regions[count++] = region;
+      if (count > max_regions) {
+        MergeClosest(regions, count);
+      }
+    }
+
+    std::copy(regions, regions + count, out);
+    return count;
+  }
+};
+
+#endif
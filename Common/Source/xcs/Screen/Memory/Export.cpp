@@ -94,17 +94,17 @@ CopyFromGreyscale(
 
   const unsigned src_pitch = src.pitch;
 
+  /* dest_pitch is in bytes */
+  uint8_t *dst_pixels = reinterpret_cast<uint8_t *>(dest_pixels);
   if (dest_bpp == 2) {
-    RGB565Color* dst_pixels = reinterpret_cast<RGB565Color*>(dest_pixels);
     for (unsigned row = height; row > 0;
          --row, src_pixels += src_pitch, dst_pixels += dest_pitch)
-      CopyGreyscaleToRGB565(dst_pixels,
+      CopyGreyscaleToRGB565(reinterpret_cast<RGB565Color *>(dst_pixels),
                             (const Luminosity8 *)src_pixels, width);
   } else {
-    uint32_t* dst_pixels = reinterpret_cast<uint32_t*>(dest_pixels);
     for (unsigned row = height; row > 0;
          --row, src_pixels += src_pitch, dst_pixels += dest_pitch)
-      CopyGreyscaleToRGB8(dst_pixels,
+      CopyGreyscaleToRGB8(reinterpret_cast<uint32_t *>(dst_pixels),
                            (const Luminosity8 *)src_pixels, width);
   }
 
@@ -27,6 +27,17 @@ Copyright_License {
 #include "PixelTraits.hpp"
 #include "Screen/PortableColor.hpp"
 
+/* SIMD conversions, the portable code converts the remainder */
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include "NEON.hpp"
+#define HAVE_OPTIMISED_EXPORT
+typedef NEONExport OptimisedExport;
+#elif defined(__SSE2__)
+#include "SSE2.hpp"
+#define HAVE_OPTIMISED_EXPORT
+typedef SSE2Export OptimisedExport;
+#endif
+
 #ifdef DITHER
 class Dither;
 #endif
@@ -47,6 +58,14 @@ CopyGreyscaleToRGB8(uint32_t *gcc_restrict dest,
                      const Luminosity8 *gcc_restrict src,
                      unsigned width)
 {
+#ifdef HAVE_OPTIMISED_EXPORT
+  const unsigned n = width & ~(OptimisedExport::BLOCK - 1);
+  OptimisedExport::GreyscaleToRGB8(dest, (const uint8_t *)src, n);
+  dest += n;
+  src += n;
+  width -= n;
+#endif
+
   for (unsigned i = 0; i < width; ++i)
     *dest++ = GreyscaleToRGB8(*src++);
 }
@@ -64,6 +83,14 @@ CopyGreyscaleToRGB565(RGB565Color *gcc_restrict dest,
                       const Luminosity8 *gcc_restrict src,
                       unsigned width)
 {
+#ifdef HAVE_OPTIMISED_EXPORT
+  const unsigned n = width & ~(OptimisedExport::BLOCK - 1);
+  OptimisedExport::GreyscaleToRGB565((uint16_t *)dest, (const uint8_t *)src, n);
+  dest += n;
+  src += n;
+  width -= n;
+#endif
+
   for (unsigned i = 0; i < width; ++i)
     *dest++ = GreyscaleToRGB565(*src++);
 }
@@ -77,6 +104,15 @@ ToRGB565(BGRA8Color c)
 static inline void
 BGRAToRGB565(RGB565Color *dest, const BGRA8Color *src, unsigned n)
 {
+#ifdef HAVE_OPTIMISED_EXPORT
+  const unsigned n_optimised = n & ~(OptimisedExport::BLOCK - 1);
+  OptimisedExport::BGRAToRGB565((uint16_t *)dest, (const uint32_t *)src,
+                                n_optimised);
+  dest += n_optimised;
+  src += n_optimised;
+  n -= n_optimised;
+#endif
+
   for (unsigned i = 0; i < n; ++i)
     dest[i] = ToRGB565(src[i]);
 }
@@ -231,4 +231,52 @@ struct NEONBytesQuad {
     CopyPixels((uint8_t *)p, (const uint8_t *)q, n);
   }
 };
+
+/**
+ * Frame buffer export conversions using ARM NEON instructions, same
+ * interface as SSE2Export.
+ */
+class NEONExport {
+public:
+  static constexpr unsigned BLOCK = 16;
+
+  /**
+   * Y8 to RGB565, same as RGB565Color(y, y, y)
+   */
+  gcc_flatten
+  static void GreyscaleToRGB565(uint16_t *gcc_restrict dest,
+                                const uint8_t *gcc_restrict src,
+                                unsigned n) {
+    for (unsigned i = 0; i < n; i += 8, src += 8, dest += 8) {
+      const uint16x8_t y = vshll_n_u8(vld1_u8(src), 8);
+      vst1q_u16(dest, vsriq_n_u16(vsriq_n_u16(y, y, 5), y, 11));
+    }
+  }
+
+  /**
+   * Y8 to 32 bits, luminosity copied in all bytes.
+   */
+  static void GreyscaleToRGB8(uint32_t *gcc_restrict dest,
+                              const uint8_t *gcc_restrict src,
+                              unsigned n) {
+    NEONBytesQuad().CopyPixels((uint8_t *)dest, src, n);
+  }
+
+  /**
+   * BGRA8 to RGB565, same as RGB565Color(r, g, b)
+   */
+  gcc_flatten
+  static void BGRAToRGB565(uint16_t *gcc_restrict dest,
+                           const uint32_t *gcc_restrict src,
+                           unsigned n) {
+    for (unsigned i = 0; i < n; i += 8, src += 8, dest += 8) {
+      const uint8x8x4_t bgra = vld4_u8((const uint8_t *)src);
+      const uint16x8_t r = vshll_n_u8(bgra.val[2], 8);
+      const uint16x8_t g = vshll_n_u8(bgra.val[1], 8);
+      const uint16x8_t b = vshll_n_u8(bgra.val[0], 8);
+      vst1q_u16(dest, vsriq_n_u16(vsriq_n_u16(r, g, 5), b, 11));
+    }
+  }
+};
+
 #endif
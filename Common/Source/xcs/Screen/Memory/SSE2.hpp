@@ -0,0 +1,109 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   SSE2.hpp
+ *
+ * Created on 19 October 2026
+ */
+
+#ifndef XCSOAR_SCREEN_SSE2_HPP
+#define XCSOAR_SCREEN_SSE2_HPP
+
+#include "Compiler.h"
+
+#ifndef __SSE2__
+#error SSE2 required
+#endif
+
+#include <emmintrin.h>
+#include <stdint.h>
+
+/**
+ * Frame buffer export conversions using SSE2 instructions.
+ *
+ * Each function converts <n> pixels, <n> must be a multiple of
+ * #SSE2Export::BLOCK; the caller converts the remainder with the portable
+ * code.  Results are bit identical to the portable code.
+ */
+class SSE2Export {
+public:
+  static constexpr unsigned BLOCK = 16;
+
+  /**
+   * Y8 to RGB565, same as RGB565Color(y, y, y)
+   */
+  gcc_flatten
+  static void GreyscaleToRGB565(uint16_t *gcc_restrict dest,
+                                const uint8_t *gcc_restrict src,
+                                unsigned n) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask_r = _mm_set1_epi16(0xf8);
+    const __m128i mask_g = _mm_set1_epi16(0xfc);
+
+    for (unsigned i = 0; i < n; i += BLOCK, src += BLOCK, dest += BLOCK) {
+      const __m128i y = _mm_loadu_si128((const __m128i *)src);
+      _mm_storeu_si128((__m128i *)dest,
+                       ToRGB565(_mm_unpacklo_epi8(y, zero), mask_r, mask_g));
+      _mm_storeu_si128((__m128i *)(dest + 8),
+                       ToRGB565(_mm_unpackhi_epi8(y, zero), mask_r, mask_g));
+    }
+  }
+
+  /**
+   * Y8 to 32 bits, luminosity copied in all bytes.
+   */
+  gcc_flatten
+  static void GreyscaleToRGB8(uint32_t *gcc_restrict dest,
+                              const uint8_t *gcc_restrict src,
+                              unsigned n) {
+    for (unsigned i = 0; i < n; i += BLOCK, src += BLOCK, dest += BLOCK) {
+      const __m128i y = _mm_loadu_si128((const __m128i *)src);
+      const __m128i lo = _mm_unpacklo_epi8(y, y);
+      const __m128i hi = _mm_unpackhi_epi8(y, y);
+      _mm_storeu_si128((__m128i *)dest, _mm_unpacklo_epi16(lo, lo));
+      _mm_storeu_si128((__m128i *)(dest + 4), _mm_unpackhi_epi16(lo, lo));
+      _mm_storeu_si128((__m128i *)(dest + 8), _mm_unpacklo_epi16(hi, hi));
+      _mm_storeu_si128((__m128i *)(dest + 12), _mm_unpackhi_epi16(hi, hi));
+    }
+  }
+
+  /**
+   * BGRA8 to RGB565, same as RGB565Color(r, g, b)
+   */
+  gcc_flatten
+  static void BGRAToRGB565(uint16_t *gcc_restrict dest,
+                           const uint32_t *gcc_restrict src,
+                           unsigned n) {
+    for (unsigned i = 0; i < n; i += 8, src += 8, dest += 8) {
+      const __m128i a = Pack565(_mm_loadu_si128((const __m128i *)src));
+      const __m128i b = Pack565(_mm_loadu_si128((const __m128i *)(src + 4)));
+      _mm_storeu_si128((__m128i *)dest, _mm_packs_epi32(a, b));
+    }
+  }
+
+private:
+  gcc_always_inline
+  static __m128i ToRGB565(__m128i y, __m128i mask_r, __m128i mask_g) {
+    const __m128i r = _mm_slli_epi16(_mm_and_si128(y, mask_r), 8);
+    const __m128i g = _mm_slli_epi16(_mm_and_si128(y, mask_g), 3);
+    const __m128i b = _mm_srli_epi16(y, 3);
+    return _mm_or_si128(_mm_or_si128(r, g), b);
+  }
+
+  /**
+   * 4 BGRA pixels to RGB565 in low half of each 32 bits lane, sign
+   * extended so that `_mm_packs_epi32` does not saturate.
+   */
+  gcc_always_inline
+  static __m128i Pack565(__m128i v) {
+    const __m128i r = _mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0xf800));
+    const __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07e0));
+    const __m128i b = _mm_and_si128(_mm_srli_epi32(v, 3), _mm_set1_epi32(0x001f));
+    const __m128i rgb = _mm_or_si128(_mm_or_si128(r, g), b);
+    return _mm_srai_epi32(_mm_slli_epi32(rgb, 16), 16);
+  }
+};
+
+#endif
@@ -54,6 +54,7 @@ Copyright_License {
 #include "Util/UTF8.hpp"
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <assert.h>
 #include "utils/stl_utils.h"
@@ -260,6 +261,116 @@ Canvas::DrawPolyline(const FloatPoint *points, unsigned num_points) {
 }
 
 
+/**
+ * Vertices of many polylines for a single glDrawArrays() : one GL_LINES pair
+ * by segment for thin pen, or triangle strips joined by degenerate triangles
+ * for wide pen.
+ *
+ * @return number of vertices in <vertices>
+ */
+template<typename PT>
+static unsigned
+PolylinesToVertices(const PT *points, const unsigned *firsts,
+                    const unsigned *counts, unsigned num_lines,
+                    unsigned line_width, AllocatedArray<PT> &strip,
+                    AllocatedArray<PT> &vertices)
+{
+  unsigned size = 0;
+
+  if (line_width <= OpenGL::max_line_width) {
+    unsigned segments = 0;
+    for (unsigned i = 0; i < num_lines; ++i)
+      if (counts[i] > 1)
+        segments += counts[i] - 1;
+
+    vertices.GrowDiscard(segments * 2);
+    for (unsigned i = 0; i < num_lines; ++i) {
+      const PT *line = points + firsts[i];
+      for (unsigned j = 1; j < counts[i]; ++j) {
+        vertices[size++] = line[j - 1];
+        vertices[size++] = line[j];
+      }
+    }
+    return size;
+  }
+
+  for (unsigned i = 0; i < num_lines; ++i) {
+    const unsigned n = LineToTriangles(points + firsts[i], counts[i], strip,
+                                       line_width, false);
+    if (n == 0)
+      continue;
+
+    // 2 vertices to join with previous strip
+    const unsigned join = size > 0 ? 2 : 0;
+    vertices.GrowPreserve(size + join + n, size);
+    if (join) {
+      vertices[size] = vertices[size - 1];
+      vertices[size + 1] = strip[0];
+      size += join;
+    }
+    std::copy_n(strip.begin(), n, vertices.begin() + size);
+    size += n;
+  }
+  return size;
+}
+
+template<typename PT>
+static void
+DrawPolylines(const Pen &pen, const PT *points, const unsigned *firsts,
+              const unsigned *counts, unsigned num_lines,
+              AllocatedArray<PT> &strip)
+{
+  static AllocatedArray<PT> vertices;
+
+  const unsigned size = PolylinesToVertices(points, firsts, counts, num_lines,
+                                            pen.GetWidth(), strip, vertices);
+  if (size == 0)
+    return;
+
+#ifdef USE_GLSL
+  glm::mat4 matrix = glm::translate(glm::mat4(1),glm::vec3(1, 1, 0));
+  glUniformMatrix4fv(OpenGL::solid_modelview, 1, GL_FALSE, glm::value_ptr(matrix));
+  OpenGL::solid_shader->Use();
+#else
+  glPushMatrix();
+
+#ifdef HAVE_GLES
+  glTranslatex((GLfixed)1 << 16, (GLfixed)1 << 16, 0);
+#else
+  glTranslatef(1, 1, 0.);
+#endif
+#endif
+
+  pen.Bind();
+
+  const ScopeVertexPointer vp(vertices.begin());
+  glDrawArrays(pen.GetWidth() <= OpenGL::max_line_width
+               ? GL_LINES : GL_TRIANGLE_STRIP, 0, size);
+
+  pen.Unbind();
+
+#ifdef USE_GLSL
+  glUniformMatrix4fv(OpenGL::solid_modelview, 1, GL_FALSE,
+                     glm::value_ptr(glm::mat4(1)));
+#else
+  glPopMatrix();
+#endif
+}
+
+void
+Canvas::DrawPolylines(const RasterPoint *points, const unsigned *firsts,
+                      const unsigned *counts, unsigned num_lines)
+{
+  ::DrawPolylines(pen, points, firsts, counts, num_lines, vertex_buffer);
+}
+
+void
+Canvas::DrawPolylines(const FloatPoint *points, const unsigned *firsts,
+                      const unsigned *counts, unsigned num_lines)
+{
+  ::DrawPolylines(pen, points, firsts, counts, num_lines, vertex_buffer_float);
+}
+
 void
 Canvas::DrawPolygon(const RasterPoint *points, unsigned num_points)
 {
@@ -276,6 +276,15 @@ public:
   void DrawPolyline(const RasterPoint *points, unsigned num_points);
   void DrawPolyline(const FloatPoint *points, unsigned num_points);
 
+  /**
+   * Draw <num_lines> polylines with the same pen, in a single draw call.
+   * Polyline i is the <counts[i]> points of <points> starting at <firsts[i]>.
+   */
+  void DrawPolylines(const RasterPoint *points, const unsigned *firsts,
+                     const unsigned *counts, unsigned num_lines);
+  void DrawPolylines(const FloatPoint *points, const unsigned *firsts,
+                     const unsigned *counts, unsigned num_lines);
+
   void DrawPolygon(const RasterPoint *points, unsigned num_points);
 
   /**
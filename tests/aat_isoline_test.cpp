@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "Calc/Task/aat_isoline.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace task;
+
+namespace {
+
+constexpr size_t isoline_count = 32;
+
+using points_t = GeoPoint[isoline_count];
+using valid_t = bool[isoline_count];
+
+GeoPoint move(const GeoPoint& origin, double bearing, double distance) {
+    GeoPoint out;
+    sphere::FindLatitudeLongitude(origin, &bearing, &distance, 1, &out);
+    return out;
+}
+
+double distance(const GeoPoint& a, const GeoPoint& b) {
+    double d;
+    sphere::DistanceBearing(a, &b, 1, &d, nullptr);
+    return d;
+}
+
+double bearing(const GeoPoint& a, const GeoPoint& b) {
+    double d;
+    sphere::DistanceBearing(a, &b, 1, nullptr, &d);
+    return d;
+}
+
+// same as `InTurnSector()`, on the sphere
+bool reference_inside(const isoline_zone& zone, const GeoPoint& position) {
+    const double range = distance(zone.center, position);
+    const double radial = bearing(zone.center, position);
+    switch (zone.kind) {
+        case isoline_zone::circle:
+            return range < zone.radius;
+        case isoline_zone::sector:
+            return range < zone.radius && detail::angle_in_range(zone.start_radial, zone.end_radial, radial);
+        case isoline_zone::dae:
+            return range < 500. || (range < 10000. && std::fabs(detail::angle_180(radial - zone.bisector)) <= 45.);
+        default:
+            return false;
+    }
+}
+
+/*
+ * previous implementation : gradient of double leg distance from finite
+ * difference with 25 m steps, each step on the sphere.
+ */
+void reference_isoline(const isoline_input& input, points_t& points, valid_t& valid) {
+    constexpr double stepsize = 25.;
+    auto leg_distance = [&](const GeoPoint& position) {
+        return distance(input.previous, position) + distance(position, input.next);
+    };
+
+    std::fill_n(valid, isoline_count, false);
+    const double delta = input.max_distance * 2.4 / isoline_count;
+    GeoPoint position = input.target;
+    bool left = false;
+    bool in_sector = true;
+
+    size_t j = 0;
+    points[j] = position;
+    valid[j++] = true;
+    do {
+        const double dist_0 = leg_distance(position);
+        const double dist_north = leg_distance(move(position, 0., stepsize));
+        const double dist_east = leg_distance(move(position, 90., stepsize));
+
+        double angle = detail::angle_360(std::atan2(dist_east - dist_0, dist_north - dist_0) * sphere::detail::rad_to_deg + 90.);
+        if (left) {
+            angle += 180.;
+        }
+        position = move(position, angle, delta);
+
+        in_sector = reference_inside(input.zone, position);
+        if (in_sector) {
+            points[j] = position;
+            valid[j++] = true;
+        } else {
+            j++;
+            if (!left && (j < isoline_count - 2)) {
+                left = true;
+                position = input.target;
+                in_sector = true;
+                points[j] = position;
+                valid[j++] = true;
+            }
+        }
+    } while (in_sector && (j < isoline_count));
+}
+
+// valid points of each walk : right of target, then left of target
+std::vector<std::vector<GeoPoint>> branches(const points_t& points, const valid_t& valid) {
+    std::vector<std::vector<GeoPoint>> out(1);
+    for (size_t i = 0; i < isoline_count; ++i) {
+        if (valid[i]) {
+            out.back().push_back(points[i]);
+        } else if (!out.back().empty()) {
+            out.emplace_back();
+        }
+    }
+    if (out.back().empty()) {
+        out.pop_back();
+    }
+    return out;
+}
+
+/*
+ * same walk as previous implementation : same branches, one step more or
+ * less at zone border, same points within a small fraction of step.
+ */
+void check_isoline(const isoline_input& input) {
+    points_t points, expected_points;
+    valid_t valid, expected_valid;
+    compute_isoline(input, points, valid);
+    reference_isoline(input, expected_points, expected_valid);
+
+    const auto result = branches(points, valid);
+    const auto expected = branches(expected_points, expected_valid);
+    ASSERT_EQ(result.size(), expected.size());
+
+    const double delta = input.max_distance * 2.4 / isoline_count;
+    double max_error = 0.;
+    for (size_t b = 0; b < result.size(); ++b) {
+        const size_t size = std::min(result[b].size(), expected[b].size());
+        EXPECT_LE(std::max(result[b].size(), expected[b].size()) - size, 1U) << "branch " << b;
+        for (size_t i = 0; i < size; ++i) {
+            const double error = distance(result[b][i], expected[b][i]);
+            max_error = std::max(max_error, error);
+            EXPECT_LT(error, delta * 0.02) << "branch " << b << " point " << i;
+        }
+    }
+    printf("isoline : %zu points, max error %.1f m (step %.0f m)\n",
+           result.size() > 1 ? result[0].size() + result[1].size() : result[0].size(), max_error, delta);
+}
+
+isoline_input circle_task() {
+    const GeoPoint center = { 45.5, 6.2 };
+    const isoline_zone zone = { isoline_zone::circle, center, 20000., 0., 0., 0., 0. };
+    return {
+        move(center, 230., 60000.),
+        move(center, 350., 8000.),
+        move(center, 80., 70000.),
+        20000.,
+        zone
+    };
+}
+
+isoline_input sector_task() {
+    const GeoPoint center = { 46.1, 7.4 };
+    const isoline_zone zone = { isoline_zone::sector, center, 30000., 120., 240., 0., 0. };
+    return {
+        move(center, 300., 80000.),
+        move(center, 170., 18000.),
+        move(center, 20., 50000.),
+        30000.,
+        zone
+    };
+}
+
+} // namespace
+
+TEST(aat_isoline, circle_same_as_reference) {
+    check_isoline(circle_task());
+
+    // target at zone center
+    isoline_input input = circle_task();
+    input.target = input.zone.center;
+    check_isoline(input);
+
+    // out and return
+    input.next = input.previous;
+    check_isoline(input);
+}
+
+TEST(aat_isoline, sector_same_as_reference) {
+    check_isoline(sector_task());
+
+    // target near far edge
+    isoline_input input = sector_task();
+    input.target = move(input.zone.center, 200., 27000.);
+    check_isoline(input);
+
+    // sector across north
+    input.zone.start_radial = 300.;
+    input.zone.end_radial = 60.;
+    input.target = move(input.zone.center, 10., 15000.);
+    input.previous = move(input.zone.center, 200., 70000.);
+    input.next = move(input.zone.center, 120., 60000.);
+    check_isoline(input);
+}
+
+TEST(aat_isoline, input_change) {
+    const isoline_input input = sector_task();
+    isoline_input copy = input;
+    EXPECT_EQ(copy, input);
+
+    copy.target = move(input.target, 90., 10.);
+    EXPECT_NE(copy, input);
+    copy = input;
+    copy.next.longitude += 1e-6;
+    EXPECT_NE(copy, input);
+    copy = input;
+    copy.zone.end_radial = 250.;
+    EXPECT_NE(copy, input);
+    copy = input;
+    copy.zone.kind = isoline_zone::circle;
+    EXPECT_NE(copy, input);
+}
+
+TEST(aat_isoline, repeated_walks_match_reference) {
+    const isoline_input input = sector_task();
+    constexpr unsigned loops = 200;
+
+    // output buffers are reused, like isoline cache of each task point.
+    points_t points, expected_points;
+    valid_t valid, expected_valid;
+    for (unsigned i = 0; i < loops; ++i) {
+        reference_isoline(input, expected_points, expected_valid);
+        compute_isoline(input, points, valid);
+    }
+
+    const auto branch = branches(points, valid);
+    const auto expected = branches(expected_points, expected_valid);
+    ASSERT_EQ(branch.size(), expected.size());
+    for (size_t b = 0; b < branch.size(); ++b) {
+        EXPECT_NEAR(branch[b].size(), expected[b].size(), 1) << "branch " << b;
+    }
+}
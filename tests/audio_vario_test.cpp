@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+#include "Sound/audio_vario.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace sound;
+
+namespace {
+
+constexpr size_t period_frames = 256;
+
+// headless output : keep all samples in memory
+class memory_pcm_sink final : public pcm_sink {
+ public:
+    void write(const int16_t* samples, size_t frames) override {
+        output.insert(output.end(), samples, samples + frames);
+    }
+
+    std::vector<int16_t> output;
+};
+
+// vario trace, one value every 100 ms like a baro sensor
+struct trace_point_t {
+    unsigned time; // ms
+    double vario;  // m/s
+};
+
+std::vector<trace_point_t> thermal_trace() {
+    std::vector<trace_point_t> trace;
+    unsigned time = 0;
+    auto segment = [&](double vario, unsigned duration) {
+        for (unsigned end = time + duration; time < end; time += 100) {
+            trace.push_back({ time, vario });
+        }
+    };
+    segment(0., 2000);    // cruise in dead-band
+    segment(1., 4000);    // thermal entry
+    segment(2.5, 4000);   // core
+    segment(-0.5, 2000);  // leaving
+    segment(-3.5, 4000);  // sink
+    return trace;
+}
+
+/*
+  * play <trace> through mixer and <vario>, period by period.
+  */
+std::vector<int16_t> play(audio_vario& vario, const std::vector<trace_point_t>& trace, unsigned duration) {
+    sound_mixer mixer;
+    memory_pcm_sink sink;
+    std::vector<int16_t> period;
+    size_t next = 0;
+    size_t frames = 0;
+    while (frames * 1000 / sample_rate < duration) {
+        const unsigned now = frames * 1000 / sample_rate;
+        for (; next < trace.size() && trace[next].time <= now; ++next) {
+            vario.update(trace[next].vario, trace[next].time);
+        }
+        if (!render(mixer, vario, sink, period, period_frames, now)) {
+            // silence, like a stopped stream
+            sink.output.insert(sink.output.end(), period_frames, 0);
+        }
+        frames += period_frames;
+    }
+    return sink.output;
+}
+
+size_t to_index(unsigned time) {
+    return static_cast<size_t>(time) * sample_rate / 1000;
+}
+
+bool silent(const std::vector<int16_t>& output, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        if (output[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// frequency from rising zero crossings between <begin> and <end>
+double frequency(const std::vector<int16_t>& output, size_t begin, size_t end) {
+    size_t first = 0, last = 0;
+    unsigned count = 0;
+    for (size_t i = begin + 1; i < end; ++i) {
+        if (output[i - 1] < 0 && output[i] >= 0) {
+            if (count++ == 0) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+    return count < 2 ? 0. : (count - 1) * double(sample_rate) / (last - first);
+}
+
+// start of beeps : sound after at least 10 ms of silence, sound already playing at <begin> is not a start
+std::vector<size_t> beep_starts(const std::vector<int16_t>& output, size_t begin, size_t end) {
+    constexpr size_t min_gap = sample_rate / 100;
+    std::vector<size_t> starts;
+    size_t zeros = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (output[i] == 0) {
+            ++zeros;
+            continue;
+        }
+        if (zeros >= min_gap) {
+            starts.push_back(i);
+        }
+        zeros = 0;
+    }
+    return starts;
+}
+
+} // namespace
+
+TEST(audio_vario, curve) {
+    const vario_curve curve = {
+        { 2., 800., 400, 0.5 },
+        { 0., 600., 600, 0.5 },
+    };
+    EXPECT_EQ(curve.at(-1.).frequency, 600.);
+    EXPECT_EQ(curve.at(1.).frequency, 700.);
+    EXPECT_EQ(curve.at(1.).period, 500U);
+    EXPECT_EQ(curve.at(5.).frequency, 800.);
+    EXPECT_TRUE(vario_curve().empty());
+}
+
+TEST(audio_vario, config_from_settings) {
+    const audio_vario_config defaults;
+    const audio_vario_config same = make_audio_vario_config(-2., 0.2, 600., 1200., 400., 50);
+    for (double value = -6.; value <= 6.; value += 0.25) {
+        EXPECT_DOUBLE_EQ(same.lift.at(value).frequency, defaults.lift.at(value).frequency) << value;
+        EXPECT_EQ(same.lift.at(value).period, defaults.lift.at(value).period) << value;
+        EXPECT_DOUBLE_EQ(same.sink.at(value).frequency, defaults.sink.at(value).frequency) << value;
+    }
+    EXPECT_DOUBLE_EQ(same.volume, defaults.volume);
+
+    const audio_vario_config config = make_audio_vario_config(-3., 1.5, 800., 1600., 500., 150);
+    EXPECT_DOUBLE_EQ(config.lift_threshold, 1.5);
+    EXPECT_DOUBLE_EQ(config.sink_threshold, -3.);
+    EXPECT_DOUBLE_EQ(config.volume, 1.);
+    // default shape, scaled to user frequencies
+    const double expected = 800. + (defaults.lift.at(1.5).frequency - 600.) * 800. / 600.;
+    EXPECT_DOUBLE_EQ(config.lift.at(1.5).frequency, expected);
+    EXPECT_DOUBLE_EQ(config.lift.at(5.).frequency, 1600.);
+    EXPECT_DOUBLE_EQ(config.lift.at(8.).frequency, 1600.);
+    EXPECT_EQ(config.lift.at(3.).period, defaults.lift.at(3.).period);
+    EXPECT_DOUBLE_EQ(config.sink.at(-3.).frequency, 500.);
+    EXPECT_DOUBLE_EQ(config.sink.at(-6.).frequency, 250.);
+}
+
+TEST(audio_vario, configure_dead_band) {
+    audio_vario vario;
+    vario.update(0.5, 1000);
+    EXPECT_TRUE(vario.audible(1000));
+    vario.configure(make_audio_vario_config(-2., 1., 600., 1200., 400., 50));
+    EXPECT_FALSE(vario.audible(1000));
+    vario.update(1.2, 1100);
+    EXPECT_TRUE(vario.audible(1100));
+}
+
+TEST(audio_vario, frequency_and_cadence) {
+    audio_vario vario;
+    const auto& config = vario.config();
+    const auto output = play(vario, thermal_trace(), 16000);
+
+    // dead-band : nothing
+    EXPECT_TRUE(silent(output, 0, to_index(2000)));
+
+    // lift : beeps, at curve frequency and cadence
+    for (double value : { 1., 2.5 }) {
+        const unsigned begin = (value == 1.) ? 2000 : 6000;
+        const vario_tone tone = config.lift.at(value);
+        const auto starts = beep_starts(output, to_index(begin), to_index(begin + 4000));
+        ASSERT_GE(starts.size(), 5U) << value;
+        // first beep can follow previous cadence
+        for (size_t i = 2; i < starts.size(); ++i) {
+            const double period = (starts[i] - starts[i - 1]) * 1000. / sample_rate;
+            EXPECT_NEAR(period, tone.period, 1.) << value;
+        }
+        const size_t beep_end = starts[2] + to_index(tone.period * tone.duty);
+        EXPECT_NEAR(frequency(output, starts[2], beep_end), tone.frequency, tone.frequency * 0.01) << value;
+        EXPECT_TRUE(silent(output, beep_end + to_index(config.ramp) + 1, starts[3])) << value;
+    }
+
+    // back in dead-band : end of last beep, then nothing
+    EXPECT_TRUE(silent(output, to_index(10000 + 400), to_index(12000)));
+
+    // sink : continuous tone
+    const vario_tone tone = config.sink.at(-3.5);
+    const size_t sink_begin = to_index(12000 + 20);
+    const size_t sink_end = to_index(16000 - 20);
+    EXPECT_EQ(beep_starts(output, sink_begin, sink_end).size(), 0U);
+    EXPECT_NEAR(frequency(output, sink_begin, sink_end), tone.frequency, tone.frequency * 0.01);
+}
+
+/*
+  * vario leaves dead-band : first beep must start in the first period
+  * rendered after the value, whatever the cadence position.
+  */
+TEST(audio_vario, tone_latency) {
+    const std::vector<trace_point_t> trace = {
+        { 0, 0. }, { 100, 0. }, { 200, 0. },
+        { 250, 3. },
+    };
+    audio_vario vario;
+    const auto output = play(vario, trace, 1000);
+
+    const auto starts = beep_starts(output, 0, output.size());
+    ASSERT_FALSE(starts.empty());
+    const size_t request = to_index(250);
+    ASSERT_GE(starts.front(), request);
+    const double latency_ms = (starts.front() - request) * 1000. / sample_rate;
+    printf("tone latency : %.1f ms + device buffer\n", latency_ms);
+    EXPECT_LT(starts.front() - request, period_frames);
+
+    unsigned latency;
+    EXPECT_TRUE(vario.take_latency(latency));
+    EXPECT_LE(latency * sample_rate / 1000, period_frames);
+    EXPECT_FALSE(vario.take_latency(latency));
+}
+
+TEST(audio_vario, silent_when_vario_is_lost) {
+    audio_vario vario;
+    const unsigned timeout = vario.config().timeout;
+    const std::vector<trace_point_t> trace = { { 0, 3. } };
+    const auto output = play(vario, trace, timeout + 1000);
+
+    EXPECT_FALSE(silent(output, 0, to_index(timeout)));
+    EXPECT_TRUE(silent(output, to_index(timeout + 100), output.size()));
+    EXPECT_FALSE(vario.active(timeout + 1000));
+}
+
+TEST(audio_vario, mixed_with_sounds) {
+    audio_vario_config config;
+    config.volume = 1.;
+    audio_vario vario(config);
+    sound_mixer mixer;
+    null_pcm_sink sink;
+    std::vector<int16_t> period;
+
+    const std::vector<int16_t> loud(sample_rate, 30000);
+    mixer.play(make_pcm_buffer(loud.data(), loud.size(), 1, sample_rate), priority::alarm);
+    vario.update(-4., 0);
+    ASSERT_TRUE(render(mixer, vario, sink, period, period_frames, 0));
+    EXPECT_EQ(sink.frames(), period_frames);
+    // saturated sum of alarm and sink tone
+    EXPECT_EQ(*std::max_element(period.begin(), period.end()), INT16_MAX);
+    EXPECT_LT(*std::min_element(period.begin(), period.end()), 0);
+}
@@ -0,0 +1,620 @@
+/*
+ * LK8000 Tactical Flight Computer -  WWW.LK8000.IT
+ * Released under GNU/GPL License v.2 or later
+ * See CREDITS.TXT file for authors and copyrights
+ *
+ * File:   calc_benchmark.cpp
+ *
+ * Created on 19 October 2026
+ */
+
+/*
+ * Calculation pipeline benchmark.
+ *
+ * Each IGC file of <corpus>/_Logger is replayed through the headless
+ * calculation pipeline, with terrain, waypoints and airspaces of <corpus>
+ * loaded by <profile>. If <corpus>/_Tasks/<flight>.lkt exist, it's loaded
+ * before replay.
+ *
+ * For each flight, a test by function report execution time percentiles and
+ * allocations per cycle ( one cycle by replayed fix ) :
+ *  - DoCalculations, DoCalculationsSlow : timed inside the pipeline.
+ *  - TerrainFootprint, AirspaceWarning ( both steps ), DoNearest,
+ *    DoRangeWaypointList, LKFormatValue ( all values ) : extra call after each
+ *    cycle, on copy of derived info.
+ *  - ContestMgr::Add : second pass on the fixes of the flight, after reset of
+ *    the contest manager.
+ *  - LongTrail : draw thread part of LKDrawLongTrail after each cycle, ranked
+ *    copy of LongSnailTrail if changed and level of detail at 50 m by pixel.
+ *
+ * With --baseline, a test fail if p50 time or allocations are higher than
+ * baseline + threshold. --save write results to be used as next baseline.
+ *
+ * Corpus is copied to temporary directory before use, files written at
+ * runtime never modify it.
+ *
+ * usage : LK8000-LINUX-benchmark [gtest options] [--corpus=dir] [--profile=file]
+ *                                [--baseline=file] [--save=file] [--threshold=percent]
+ */
+
+#include <gtest/gtest.h> // first, LK8000 headers define Bool macro
+#include "externs.h"
+#include "Headless.h"
+#include "Logger.h"
+#include "ContestMgr.h"
+#include "InputEvents.h"
+#include "MapWindow.h"
+#include "utils/alloc_counter.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+extern void TerrainFootprint(NMEA_INFO *Basic, DERIVED_INFO *Calculated);
+
+#ifdef NDEBUG
+
+namespace {
+
+std::atomic<uint64_t> allocation_count = 0;
+
+uint64_t allocations() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+/*
+ * count all allocations done through operator new, whatever the thread.
+ * replacement operators are never inlined, to avoid false positive of
+ * -Wmismatched-new-delete.
+ */
+gcc_noinline
+void* operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+gcc_noinline
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+gcc_noinline
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+gcc_noinline
+void operator delete[](void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+#else
+
+namespace {
+
+// debug build already count allocations ( utils/alloc_counter.cpp )
+uint64_t allocations() {
+  return alloc_counter::thread_count();
+}
+
+} // namespace
+
+#endif // NDEBUG
+
+namespace {
+
+namespace fs = std::filesystem;
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * below this difference, p50 time is never considered as regression :
+ * clock resolution and scheduler noise are of the same order.
+ */
+constexpr double noise_floor_us = 0.5;
+
+struct options_t {
+  fs::path corpus = "Common/Distribution/LK8000";
+  std::string profile = "_Configuration/DEMO.prf";
+  std::string baseline;
+  std::string save;
+  double threshold = 20.; // percent
+};
+
+options_t options;
+
+void usage() {
+  fprintf(stderr,
+          "usage : LK8000-benchmark [gtest options] [options]\n"
+          " --corpus=dir        LK8000 data directory, flights are <dir>/_Logger/*.igc\n"
+          "                     default Common/Distribution/LK8000\n"
+          " --profile=file      profile, relative to corpus, default _Configuration/DEMO.prf\n"
+          " --baseline=file     fail if results are worse than this previous results\n"
+          " --save=file         save results as csv, to be used as baseline\n"
+          " --threshold=percent allowed regression from baseline, default 20\n");
+}
+
+bool parse_options(int argc, char *argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg.compare(0, 9, "--corpus=") == 0) {
+      options.corpus = arg.substr(9);
+    } else if (arg.compare(0, 10, "--profile=") == 0) {
+      options.profile = arg.substr(10);
+    } else if (arg.compare(0, 11, "--baseline=") == 0) {
+      options.baseline = arg.substr(11);
+    } else if (arg.compare(0, 7, "--save=") == 0) {
+      options.save = arg.substr(7);
+    } else if (arg.compare(0, 12, "--threshold=") == 0) {
+      options.threshold = strtod(arg.c_str() + 12, nullptr);
+    } else {
+      return false;
+    }
+  }
+  return options.threshold >= 0;
+}
+
+enum class function : unsigned {
+  DoCalculations,
+  DoCalculationsSlow,
+  TerrainFootprint,
+  AirspaceWarning,
+  ContestMgrAdd,
+  DoNearest,
+  DoRangeWaypointList,
+  LKFormatValue,
+  LongTrail,
+
+  count // must be last
+};
+
+constexpr unsigned function_count = static_cast<unsigned>(function::count);
+
+const char* name(function id) {
+  switch (id) {
+    case function::DoCalculations:
+      return "DoCalculations";
+    case function::DoCalculationsSlow:
+      return "DoCalculationsSlow";
+    case function::TerrainFootprint:
+      return "TerrainFootprint";
+    case function::AirspaceWarning:
+      return "AirspaceWarning";
+    case function::ContestMgrAdd:
+      return "ContestMgrAdd";
+    case function::DoNearest:
+      return "DoNearest";
+    case function::DoRangeWaypointList:
+      return "DoRangeWaypointList";
+    case function::LKFormatValue:
+      return "LKFormatValue";
+    case function::LongTrail:
+      return "LongTrail";
+    case function::count:
+      break;
+  }
+  return "";
+}
+
+struct result_t {
+  unsigned count = 0;
+  double mean_us = 0;
+  double p50_us = 0;
+  double p95_us = 0;
+  double p99_us = 0;
+  double max_us = 0;
+  double allocations = 0; // by cycle
+};
+
+/**
+ * elapsed time and allocations of each call
+ */
+class samples_t final {
+ public:
+  template<typename Function>
+  void measure(Function&& func) {
+    const uint64_t start_allocations = allocations();
+    const auto start = clock_type::now();
+    func();
+    const auto elapsed = clock_type::now() - start;
+    _allocations += allocations() - start_allocations;
+    _elapsed_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  result_t result() const {
+    result_t result;
+    if (_elapsed_ns.empty()) {
+      return result;
+    }
+    std::vector<uint64_t> sorted = _elapsed_ns;
+    std::sort(sorted.begin(), sorted.end());
+
+    const auto percentile = [&](unsigned percent) {
+      const size_t rank = (sorted.size() * percent + 99) / 100;
+      return sorted[std::max<size_t>(rank, 1) - 1] / 1000.;
+    };
+
+    uint64_t total = 0;
+    for (auto ns : sorted) {
+      total += ns;
+    }
+
+    result.count = sorted.size();
+    result.mean_us = total / 1000. / sorted.size();
+    result.p50_us = percentile(50);
+    result.p95_us = percentile(95);
+    result.p99_us = percentile(99);
+    result.max_us = sorted.back() / 1000.;
+    result.allocations = static_cast<double>(_allocations) / sorted.size();
+    return result;
+  }
+
+ private:
+  std::vector<uint64_t> _elapsed_ns;
+  uint64_t _allocations = 0;
+};
+
+struct fix_t {
+  double time;
+  double latitude;
+  double longitude;
+  double altitude;
+};
+
+/**
+ * replay one flight and measure all functions.
+ */
+class flight_benchmark final {
+ public:
+  explicit flight_benchmark(const fs::path& igc_file) {
+    load_task(igc_file.stem());
+    replay(igc_file);
+    contest();
+  }
+
+  result_t result(function id) const {
+    return _samples[static_cast<unsigned>(id)].result();
+  }
+
+ private:
+  samples_t& samples(function id) {
+    return _samples[static_cast<unsigned>(id)];
+  }
+
+  static void load_task(const fs::path& flight) {
+    const fs::path task = fs::path(LKD_TASKS) / flight;
+    if (fs::exists(fs::path(task).replace_extension(LKS_TSK))) {
+      InputEvents::eventTaskLoad(flight.string().append(LKS_TSK).c_str());
+    } else {
+      LockTaskData();
+      ClearTask();
+      UnlockTaskData();
+    }
+  }
+
+  void replay(const fs::path& igc_file) {
+    RUN_MODE = RUN_SIM;
+
+    LockFlightData();
+    GPS_INFO.NAVWarning = false;
+    GPS_INFO.SatellitesUsed = 6;
+    UnlockFlightData();
+
+    const auto pipeline = std::make_unique<headless::calculation_pipeline>();
+    const auto scratch = std::make_unique<DERIVED_INFO>();
+
+    using long_trail_t = decltype(LongSnailTrail);
+    LongSnailTrail.clear();
+    std::vector<long_trail_t::point_t> trail;
+    unsigned trail_version = 0;
+    std::vector<GeoPoint> polyline;
+
+    ReplayLogger::SimulatedStep = 1.;
+    ReplayLogger::SetFilename(fs::absolute(igc_file).c_str());
+    ReplayLogger::Start();
+
+    double last_time = 0;
+    while (ReplayLogger::Update()) {
+      samples(function::DoCalculations).measure([&] {
+        pipeline->calculate();
+      });
+      samples(function::DoCalculationsSlow).measure([&] {
+        pipeline->calculate_slow();
+      });
+
+      NMEA_INFO& basic = pipeline->basic;
+      if (basic.NAVWarning || basic.Time <= last_time) {
+        continue;
+      }
+      last_time = basic.Time;
+      _fixes.push_back({ basic.Time, basic.Latitude, basic.Longitude, basic.Altitude });
+
+      *scratch = pipeline->calculated;
+      samples(function::TerrainFootprint).measure([&] {
+        TerrainFootprint(&basic, scratch.get());
+      });
+
+      *scratch = pipeline->calculated;
+      samples(function::AirspaceWarning).measure([&] {
+        // warning calculation is done in 2 steps, by 2 consecutive calls.
+        CAirspaceManager::Instance().AirspaceWarning(&basic, scratch.get());
+        CAirspaceManager::Instance().AirspaceWarning(&basic, scratch.get());
+      });
+
+      *scratch = pipeline->calculated;
+      LKForceDoNearest = true;
+      LastDoNearest = 0;
+      samples(function::DoNearest).measure([&] {
+        DoNearest(&basic, scratch.get());
+      });
+
+      *scratch = pipeline->calculated;
+      samples(function::DoRangeWaypointList).measure([&] {
+        DoRangeWaypointList(&basic, scratch.get());
+      });
+
+      MapWindow::UpdateInfo(&basic, &pipeline->calculated);
+      samples(function::LKFormatValue).measure([&] {
+        TCHAR value[LKSIZEBUFFERVALUE];
+        TCHAR unit[LKSIZEBUFFERUNIT];
+        TCHAR title[LKSIZEBUFFERTITLE];
+        for (short index = 0; index < NumDataOptions; ++index) {
+          MapWindow::LKFormatValue(index, false, value, unit, title);
+        }
+      });
+
+      samples(function::LongTrail).measure([&] {
+        if (LongSnailTrail.copy(trail, trail_version)) {
+          long_trail_t::rank(trail);
+        }
+        // 2 pixels, like LKDrawLongTrail
+        constexpr float tolerance = 2 * 50.f;
+        polyline.clear();
+        long_trail_t::for_each_visible(trail, tolerance, [&](const long_trail_t::point_t& pt) {
+          polyline.push_back({ pt.latitude, pt.longitude });
+        });
+      });
+    }
+    ReplayLogger::Stop();
+  }
+
+  void contest() {
+    CContestMgr& manager = CContestMgr::Instance();
+    manager.Reset(Handicap);
+    for (const fix_t& fix : _fixes) {
+      // below sea level fix would wrap to 4 billion meters
+      const unsigned altitude = static_cast<unsigned>(std::max(fix.altitude, 0.));
+      samples(function::ContestMgrAdd).measure([&] {
+        manager.Add(static_cast<unsigned>(fix.time), fix.latitude, fix.longitude, altitude);
+      });
+    }
+  }
+
+  std::array<samples_t, function_count> _samples;
+  std::vector<fix_t> _fixes;
+};
+
+/**
+ * flights are replayed once, at first test using it.
+ */
+const flight_benchmark& get_flight(const fs::path& igc_file) {
+  static std::map<fs::path, std::unique_ptr<flight_benchmark>> flights;
+  auto& flight = flights[igc_file];
+  if (!flight) {
+    flight = std::make_unique<flight_benchmark>(igc_file);
+  }
+  return *flight;
+}
+
+using result_key = std::pair<std::string, std::string>; // flight, function
+
+std::map<result_key, result_t> baseline;
+std::map<result_key, result_t> results;
+
+constexpr char csv_header[] = "flight,function,count,mean_us,p50_us,p95_us,p99_us,max_us,allocations";
+
+bool load_baseline(const std::string& file_path) {
+  std::ifstream file(file_path);
+  if (!file) {
+    return false;
+  }
+  std::string line;
+  std::getline(file, line); // header
+  while (std::getline(file, line)) {
+    std::istringstream stream(line);
+    std::string flight, function, value;
+    std::getline(stream, flight, ',');
+    std::getline(stream, function, ',');
+
+    std::vector<double> values;
+    while (std::getline(stream, value, ',')) {
+      values.push_back(strtod(value.c_str(), nullptr));
+    }
+    if (values.size() == 7) {
+      result_t& result = baseline[{ flight, function }];
+      result.count = values[0];
+      result.mean_us = values[1];
+      result.p50_us = values[2];
+      result.p95_us = values[3];
+      result.p99_us = values[4];
+      result.max_us = values[5];
+      result.allocations = values[6];
+    }
+  }
+  return true;
+}
+
+bool save_results(const std::string& file_path) {
+  FILE* file = fopen(file_path.c_str(), "wt");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "%s\n", csv_header);
+  for (const auto& [key, result] : results) {
+    fprintf(file, "%s,%s,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.6f\n",
+            key.first.c_str(), key.second.c_str(), result.count, result.mean_us,
+            result.p50_us, result.p95_us, result.p99_us, result.max_us, result.allocations);
+  }
+  fclose(file);
+  return true;
+}
+
+class benchmark_test : public testing::Test {
+ public:
+  benchmark_test(fs::path igc_file, function id) : _igc_file(std::move(igc_file)), _id(id) {}
+
+  void TestBody() override {
+    const result_t result = get_flight(_igc_file).result(_id);
+    const result_key key = { _igc_file.stem().string(), name(_id) };
+    results[key] = result;
+
+    printf("  %-20s count %6u, mean %9.2f, p50 %9.2f, p95 %9.2f, p99 %9.2f, max %10.2f us, %.2f alloc/cycle\n",
+           name(_id), result.count, result.mean_us, result.p50_us, result.p95_us,
+           result.p99_us, result.max_us, result.allocations);
+
+    RecordProperty("count", std::to_string(result.count));
+    RecordProperty("p50_us", std::to_string(result.p50_us));
+    RecordProperty("p95_us", std::to_string(result.p95_us));
+    RecordProperty("p99_us", std::to_string(result.p99_us));
+    RecordProperty("allocations", std::to_string(result.allocations));
+
+    EXPECT_GT(result.count, 0U) << name(_id) << " never called";
+
+    auto it = baseline.find(key);
+    if (it == baseline.end()) {
+      return;
+    }
+    const result_t& base = it->second;
+    const double factor = 1. + options.threshold / 100.;
+    EXPECT_LE(result.p50_us, std::max(base.p50_us * factor, base.p50_us + noise_floor_us))
+        << name(_id) << " p50 regression, baseline " << base.p50_us << " us";
+    EXPECT_LE(result.allocations, base.allocations * factor)
+        << name(_id) << " allocations regression, baseline " << base.allocations << " by cycle";
+  }
+
+ private:
+  const fs::path _igc_file;
+  const function _id;
+};
+
+std::vector<fs::path> list_flights(const fs::path& corpus) {
+  std::vector<fs::path> flights;
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(corpus / LKD_LOGS, ec)) {
+    std::string extension = entry.path().extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    if (entry.is_regular_file() && extension == ".igc") {
+      flights.push_back(fs::path(LKD_LOGS) / entry.path().filename());
+    }
+  }
+  std::sort(flights.begin(), flights.end());
+  return flights;
+}
+
+/**
+ * copy of corpus used as current directory and $HOME, so data path resolve
+ * to it and nothing is written inside corpus.
+ */
+fs::path make_workdir(const fs::path& corpus) {
+  std::string path = (fs::temp_directory_path() / "lkbench.XXXXXX").string();
+  if (!mkdtemp(path.data())) {
+    return {};
+  }
+  std::error_code ec;
+  fs::copy(corpus, path, fs::copy_options::recursive, ec);
+  if (ec) {
+    fs::remove_all(path, ec);
+    return {};
+  }
+  return path;
+}
+
+std::string test_suite_name(const fs::path& flight) {
+  std::string suite = flight.stem().string();
+  std::replace_if(suite.begin(), suite.end(), [](char c) { return !isalnum(c); }, '_');
+  return suite;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  if (!parse_options(argc, argv)) {
+    usage();
+    return 2;
+  }
+
+  const std::vector<fs::path> flights = list_flights(options.corpus);
+  if (flights.empty()) {
+    fprintf(stderr, "no IGC file in <%s/%s>\n", options.corpus.c_str(), LKD_LOGS);
+    return 1;
+  }
+
+  if (!options.baseline.empty() && !load_baseline(options.baseline)) {
+    fprintf(stderr, "cannot read baseline <%s>\n", options.baseline.c_str());
+    return 1;
+  }
+
+  // paths given on command line are relative to initial directory
+  if (!options.save.empty()) {
+    options.save = fs::absolute(options.save).string();
+  }
+
+  const fs::path workdir = make_workdir(options.corpus);
+  if (workdir.empty()) {
+    fprintf(stderr, "cannot copy corpus <%s>\n", options.corpus.c_str());
+    return 1;
+  }
+  setenv("HOME", workdir.c_str(), 1);
+  fs::current_path(workdir);
+
+  headless::initialise(options.profile.c_str());
+
+  for (const fs::path& flight : flights) {
+    for (unsigned i = 0; i < function_count; ++i) {
+      const function id = static_cast<function>(i);
+      testing::RegisterTest(test_suite_name(flight).c_str(), name(id), nullptr, nullptr,
+                            __FILE__, __LINE__, [=]() -> testing::Test* {
+                              return new benchmark_test(flight, id);
+                            });
+    }
+  }
+
+  const int ret = RUN_ALL_TESTS();
+
+  if (!options.save.empty() && !save_results(options.save)) {
+    fprintf(stderr, "cannot write <%s>\n", options.save.c_str());
+  }
+
+  std::error_code ec;
+  fs::current_path(fs::temp_directory_path(), ec);
+  fs::remove_all(workdir, ec);
+
+  return ret;
+}
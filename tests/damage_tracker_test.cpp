@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "Screen/Memory/DamageTracker.hpp"
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+// greyscale frame, like KOBO back buffer.
+struct Frame {
+    unsigned width, height;
+    std::vector<uint8_t> pixels;
+
+    Frame(unsigned w, unsigned h) : width(w), height(h), pixels(w * h, 0xFF) {}
+
+    void Fill(unsigned left, unsigned top, unsigned right, unsigned bottom, uint8_t value) {
+        for (unsigned y = top; y < bottom; ++y) {
+            std::fill_n(&pixels[y * width + left], right - left, value);
+        }
+    }
+};
+
+using Regions = DamageTracker::Regions;
+
+// all changed pixels must be inside a region
+void check_covered(const Frame& before, const Frame& after, const Regions& regions, unsigned count) {
+    for (unsigned y = 0; y < after.height; ++y) {
+        for (unsigned x = 0; x < after.width; ++x) {
+            if (before.pixels[y * after.width + x] == after.pixels[y * after.width + x]) {
+                continue;
+            }
+            bool covered = false;
+            for (unsigned i = 0; i < count && !covered; ++i) {
+                covered = x >= regions[i].left && x < regions[i].right && y >= regions[i].top && y < regions[i].bottom;
+            }
+            ASSERT_TRUE(covered) << "pixel " << x << "," << y;
+        }
+    }
+}
+
+unsigned converted_pixels(const Regions& regions, unsigned count) {
+    unsigned pixels = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        pixels += regions[i].Area();
+    }
+    return pixels;
+}
+
+unsigned flip(DamageTracker& damage, const Frame& frame, Regions& regions) {
+    return damage.Update(frame.pixels.data(), frame.width, frame.width, frame.height, 1, regions);
+}
+
+} // namespace
+
+TEST(damage_tracker, first_frame_and_invalidate) {
+    Frame frame(600, 800);
+    DamageTracker damage;
+    Regions regions;
+
+    ASSERT_EQ(flip(damage, frame, regions), 1U);
+    EXPECT_EQ(regions[0].Area(), 600U * 800U);
+
+    EXPECT_EQ(flip(damage, frame, regions), 0U);
+
+    damage.Invalidate();
+    ASSERT_EQ(flip(damage, frame, regions), 1U);
+    EXPECT_EQ(regions[0].Area(), 600U * 800U);
+}
+
+TEST(damage_tracker, multi_bytes_pixel) {
+    const unsigned width = 100, height = 50;
+    std::vector<uint32_t> pixels(width * height);
+    DamageTracker damage;
+    Regions regions;
+    damage.Update(pixels.data(), width * 4, width, height, 4, regions);
+
+    // change only one byte of pixel 10,20 : region must cover whole pixel.
+    reinterpret_cast<uint8_t*>(&pixels[20 * width + 10])[2] = 1;
+    ASSERT_EQ(damage.Update(pixels.data(), width * 4, width, height, 4, regions), 1U);
+    EXPECT_EQ(regions[0].left, 10U);
+    EXPECT_EQ(regions[0].right, 11U);
+    EXPECT_EQ(regions[0].top, 20U);
+    EXPECT_EQ(regions[0].bottom, 21U);
+}
+
+TEST(damage_tracker, max_regions) {
+    Frame frame(600, 800);
+    DamageTracker damage;
+    Regions regions;
+    flip(damage, frame, regions);
+
+    // 10 distant small changes must fit in max_regions, and stay covered.
+    const Frame before = frame;
+    for (unsigned i = 0; i < 10; ++i) {
+        frame.Fill(i * 50, i * 70, i * 50 + 20, i * 70 + 10, 0);
+    }
+    const unsigned count = flip(damage, frame, regions);
+    ASSERT_GE(count, 1U);
+    ASSERT_LE(count, DamageTracker::max_regions);
+    check_covered(before, frame, regions, count);
+}
+
+// typical flight frames on KOBO portrait screen, converted pixels by frame.
+TEST(damage_tracker, flight_scenarios) {
+    const unsigned width = 600, height = 800;
+    const unsigned full = width * height;
+
+    Frame frame(width, height);
+    DamageTracker damage;
+    Regions regions;
+    flip(damage, frame, regions);
+
+    std::mt19937 gen(3);
+
+    struct scenario_t {
+        const char* name;
+        void (*draw)(Frame&, unsigned);
+        double max_ratio;
+    };
+
+    const scenario_t scenarios[] = {
+        { "vario bar", [](Frame& f, unsigned step) {
+            f.Fill(0, 200, 20, 600, 0xFF);
+            f.Fill(0, 400 - step % 150, 20, 400, 0x40);
+        }, 0.05 },
+        { "one infobox", [](Frame& f, unsigned step) {
+            f.Fill(450, 700, 590, 740, (step & 1) ? 0x00 : 0xFF);
+        }, 0.05 },
+        { "bottom bar", [](Frame& f, unsigned step) {
+            for (unsigned i = 0; i < 5; ++i) {
+                f.Fill(10 + i * 120, 760, 60 + i * 120, 790, (step + i) & 1 ? 0x00 : 0x80);
+            }
+        }, 0.15 },
+        { "map moving", [](Frame& f, unsigned step) {
+            for (unsigned y = 0; y < 700; ++y) {
+                for (unsigned x = 0; x < f.width; ++x) {
+                    f.pixels[y * f.width + x] = static_cast<uint8_t>(x + y + step);
+                }
+            }
+        }, 1.0 },
+    };
+
+    for (const auto& scenario : scenarios) {
+        unsigned total = 0;
+        constexpr unsigned frames = 20;
+        for (unsigned step = 1; step <= frames; ++step) {
+            const Frame before = frame;
+            scenario.draw(frame, step + gen() % 7);
+            const unsigned count = flip(damage, frame, regions);
+            ASSERT_LE(count, DamageTracker::max_regions);
+            check_covered(before, frame, regions, count);
+            total += converted_pixels(regions, count);
+        }
+        const double ratio = double(total) / (double(full) * frames);
+        std::cout << "damage " << scenario.name << " : " << total / frames << " pixels/frame, "
+                  << ratio * 100. << "% of full screen" << std::endl;
+        EXPECT_LE(ratio, scenario.max_ratio) << scenario.name;
+    }
+}
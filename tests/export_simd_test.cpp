@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "Screen/Memory/Export.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+// portable reference, same as Export.hpp without SIMD.
+void ref_greyscale_to_rgb565(uint16_t* dest, const uint8_t* src, unsigned n) {
+    for (unsigned i = 0; i < n; ++i) {
+        dest[i] = RGB565Color(src[i], src[i], src[i]).GetNativeValue();
+    }
+}
+
+void ref_greyscale_to_rgb8(uint32_t* dest, const uint8_t* src, unsigned n) {
+    for (unsigned i = 0; i < n; ++i) {
+        dest[i] = src[i] | (src[i] << 8) | (src[i] << 16) | (uint32_t(src[i]) << 24);
+    }
+}
+
+void ref_bgra_to_rgb565(uint16_t* dest, const BGRA8Color* src, unsigned n) {
+    for (unsigned i = 0; i < n; ++i) {
+        dest[i] = RGB565Color(src[i].Red(), src[i].Green(), src[i].Blue()).GetNativeValue();
+    }
+}
+
+struct screen_t {
+    unsigned width, height;
+};
+
+constexpr screen_t screens[] = {
+    { 600, 800 },   // Kobo Touch / Glo
+    { 1072, 1448 }, // Kobo Glo HD / Clara HD
+    { 37, 3 },      // odd width, portable remainder
+};
+
+template<typename F>
+double ms_per_frame(F&& f) {
+    constexpr int rounds = 20;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        f();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count() / rounds;
+}
+
+std::vector<uint8_t> random_bytes(size_t size) {
+    std::mt19937 gen(11);
+    std::vector<uint8_t> bytes(size);
+    for (auto& b : bytes) {
+        b = gen();
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(export_simd, greyscale_to_rgb565) {
+    for (const auto& screen : screens) {
+        const unsigned n = screen.width * screen.height;
+        const auto src = random_bytes(n);
+        std::vector<uint16_t> expected(n), out(n);
+
+        const double ref = ms_per_frame([&]() {
+            ref_greyscale_to_rgb565(expected.data(), src.data(), n);
+        });
+        const double simd = ms_per_frame([&]() {
+            for (unsigned y = 0; y < screen.height; ++y) {
+                CopyGreyscaleToRGB565(reinterpret_cast<RGB565Color*>(&out[y * screen.width]),
+                                      reinterpret_cast<const Luminosity8*>(&src[y * screen.width]),
+                                      screen.width);
+            }
+        });
+        ASSERT_EQ(out, expected);
+
+        std::cout << "Y8 -> RGB565 " << screen.width << "x" << screen.height
+                  << " portable : " << ref << " ms, export : " << simd << " ms" << std::endl;
+    }
+}
+
+TEST(export_simd, greyscale_to_rgb8) {
+    for (const auto& screen : screens) {
+        const unsigned n = screen.width * screen.height;
+        const auto src = random_bytes(n);
+        std::vector<uint32_t> expected(n), out(n);
+
+        const double ref = ms_per_frame([&]() {
+            ref_greyscale_to_rgb8(expected.data(), src.data(), n);
+        });
+        const double simd = ms_per_frame([&]() {
+            for (unsigned y = 0; y < screen.height; ++y) {
+                CopyGreyscaleToRGB8(&out[y * screen.width],
+                                    reinterpret_cast<const Luminosity8*>(&src[y * screen.width]),
+                                    screen.width);
+            }
+        });
+        ASSERT_EQ(out, expected);
+
+        std::cout << "Y8 -> RGB8 " << screen.width << "x" << screen.height
+                  << " portable : " << ref << " ms, export : " << simd << " ms" << std::endl;
+    }
+}
+
+TEST(export_simd, bgra_to_rgb565) {
+    for (const auto& screen : screens) {
+        const unsigned n = screen.width * screen.height;
+        const auto bytes = random_bytes(n * sizeof(BGRA8Color));
+        const auto src = reinterpret_cast<const BGRA8Color*>(bytes.data());
+        std::vector<uint16_t> expected(n), out(n);
+
+        const double ref = ms_per_frame([&]() {
+            ref_bgra_to_rgb565(expected.data(), src, n);
+        });
+        const double simd = ms_per_frame([&]() {
+            for (unsigned y = 0; y < screen.height; ++y) {
+                BGRAToRGB565(reinterpret_cast<RGB565Color*>(&out[y * screen.width]),
+                             &src[y * screen.width], screen.width);
+            }
+        });
+        ASSERT_EQ(out, expected);
+
+        std::cout << "BGRA -> RGB565 " << screen.width << "x" << screen.height
+                  << " portable : " << ref << " ms, export : " << simd << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "FlarmSlotIndex.h"
+#include <cstring>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr unsigned slot_count = 500;
+
+using index_t = flarm_slot_index<slot_count>;
+
+// all zero must be a valid empty index : it live inside NMEA_INFO.
+index_t* make_index() {
+    static_assert(std::is_trivially_copyable_v<index_t>, "must be trivially copyable");
+    auto index = new index_t;
+    memset(static_cast<void*>(index), 0, sizeof(*index));
+    return index;
+}
+
+} // namespace
+
+TEST(flarm_slot_index, empty) {
+    std::unique_ptr<index_t> index(make_index());
+    EXPECT_EQ(index->find(0xdd8951), -1);
+    EXPECT_EQ(index->find(0), -1);
+    EXPECT_FALSE(index->full());
+    index->erase(0xdd8951);
+    EXPECT_EQ(index->find(0xdd8951), -1);
+}
+
+TEST(flarm_slot_index, insert_update_erase) {
+    std::unique_ptr<index_t> index(make_index());
+    index->insert(0xdd8951, 3);
+    index->insert(0xdd8944, 4);
+    EXPECT_EQ(index->find(0xdd8951), 3);
+    EXPECT_EQ(index->find(0xdd8944), 4);
+
+    index->insert(0xdd8951, 7);
+    EXPECT_EQ(index->find(0xdd8951), 7);
+
+    index->erase(0xdd8951);
+    EXPECT_EQ(index->find(0xdd8951), -1);
+    EXPECT_EQ(index->find(0xdd8944), 4);
+
+    // invalid id and slot are ignored
+    index->insert(0, 1);
+    index->insert(0xdd8a43, slot_count);
+    EXPECT_EQ(index->find(0), -1);
+    EXPECT_EQ(index->find(0xdd8a43), -1);
+
+    index->clear();
+    EXPECT_EQ(index->find(0xdd8944), -1);
+}
+
+TEST(flarm_slot_index, full) {
+    std::unique_ptr<index_t> index(make_index());
+    for (unsigned i = 0; i < slot_count; ++i) {
+        index->insert(0x800000 + i, i);
+    }
+    EXPECT_TRUE(index->full());
+    index->insert(0x900000, 0);
+    EXPECT_EQ(index->find(0x900000), -1);
+
+    index->erase(0x800000);
+    EXPECT_FALSE(index->full());
+    index->insert(0x900000, 0);
+    EXPECT_EQ(index->find(0x900000), 0);
+}
+
+// random insert/erase against std::unordered_map, to exercise backward shift deletion.
+TEST(flarm_slot_index, random_against_map) {
+    std::unique_ptr<index_t> index(make_index());
+    std::unordered_map<uint32_t, unsigned> ref;
+
+    std::mt19937 gen(7);
+    // narrow id range : many collisions, insert of existing and erase of missing id.
+    std::uniform_int_distribution<uint32_t> id_dist(1, 2000);
+    std::uniform_int_distribution<unsigned> slot_dist(0, slot_count - 1);
+
+    for (int step = 0; step < 200000; ++step) {
+        const uint32_t id = id_dist(gen);
+        if (gen() % 3 == 0) {
+            index->erase(id);
+            ref.erase(id);
+        } else if (ref.size() < slot_count || ref.count(id)) {
+            const unsigned slot = slot_dist(gen);
+            index->insert(id, slot);
+            ref[id] = slot;
+        }
+
+        if (step % 1000 == 0) {
+            for (uint32_t i = 1; i <= 2000; ++i) {
+                auto it = ref.find(i);
+                ASSERT_EQ(index->find(i), it == ref.end() ? -1 : static_cast<int>(it->second));
+            }
+            ASSERT_EQ(index->full(), ref.size() >= slot_count);
+        }
+    }
+}
+
+// all slots used, each lookup against the old linear search.
+TEST(flarm_slot_index, full_table_matches_linear_search) {
+    std::unique_ptr<index_t> index(make_index());
+    std::vector<uint32_t> slots(slot_count);
+
+    std::mt19937 gen(42);
+    std::set<uint32_t> used;
+    for (unsigned i = 0; i < slot_count; ++i) {
+        do {
+            slots[i] = gen() & 0xFFFFFF;
+        } while (slots[i] == 0 || !used.insert(slots[i]).second);
+        index->insert(slots[i], i);
+    }
+    ASSERT_TRUE(index->full());
+
+    auto linear = [&](uint32_t id) {
+        for (unsigned i = 0; i < slot_count; ++i) {
+            if (slots[i] == id) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    };
+
+    for (unsigned i = 0; i < slot_count; ++i) {
+        const uint32_t id = slots[(i * 7) % slot_count];
+        ASSERT_EQ(index->find(id), linear(id)) << "id " << id;
+        // neighbour ids, often absent : RadioId are often sequential
+        ASSERT_EQ(index->find(id + 1), linear(id + 1)) << "id " << id + 1;
+    }
+}
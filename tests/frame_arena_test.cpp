@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "utils/frame_arena.h"
+#include <cstdint>
+
+namespace {
+
+struct point_t {
+    int x;
+    int y;
+};
+
+// one frame : fill some scratch vectors, like task and FAI sector polyline.
+void draw_frame(frame_arena& arena, unsigned point_count) {
+    frame_vector<point_t> polyline{frame_allocator<point_t>(arena)};
+    frame_vector<double> distances{frame_allocator<double>(arena)};
+    for (unsigned i = 0; i < point_count; ++i) {
+        polyline.push_back({ int(i), int(i * 2) });
+        distances.push_back(i * 0.5);
+    }
+    for (unsigned i = 0; i < point_count; ++i) {
+        ASSERT_EQ(polyline[i].x, int(i));
+        ASSERT_EQ(polyline[i].y, int(i * 2));
+        ASSERT_EQ(distances[i], i * 0.5);
+    }
+}
+
+} // namespace
+
+TEST(frame_arena, alignment) {
+    frame_arena arena(256);
+    arena.allocate(1, 1);
+    void* p8 = arena.allocate(8, alignof(double));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p8) % alignof(double), 0U);
+    arena.allocate(3, 1);
+    void* p16 = arena.allocate(16, alignof(std::max_align_t));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p16) % alignof(std::max_align_t), 0U);
+}
+
+TEST(frame_arena, last_allocation_is_given_back) {
+    frame_arena arena(256);
+    void* first = arena.allocate(32, 8);
+    void* second = arena.allocate(32, 8);
+    arena.deallocate(second, 32);
+    EXPECT_EQ(arena.allocate(32, 8), second);
+
+    // not the most recent one : released only by reset()
+    arena.deallocate(first, 32);
+    EXPECT_NE(arena.allocate(32, 8), first);
+
+    arena.reset();
+    EXPECT_EQ(arena.allocate(32, 8), first);
+}
+
+TEST(frame_arena, grow_then_steady_state) {
+    frame_arena arena(1024);
+    draw_frame(arena, 2000);
+    EXPECT_GT(arena.block_count(), 1U);
+
+    arena.reset();
+    EXPECT_EQ(arena.block_count(), 1U);
+    const size_t capacity = arena.capacity();
+
+    // same workload doesn't need more memory anymore
+    for (unsigned frame = 0; frame < 10; ++frame) {
+        draw_frame(arena, 2000);
+        EXPECT_EQ(arena.block_count(), 1U);
+        arena.reset();
+        EXPECT_EQ(arena.capacity(), capacity);
+    }
+}
+
+TEST(frame_arena, allocator_equality) {
+    frame_arena arena1(64), arena2(64);
+    frame_allocator<int> a1(arena1);
+    frame_allocator<double> b1(arena1);
+    frame_allocator<int> a2(arena2);
+    EXPECT_TRUE(a1 == b1);
+    EXPECT_TRUE(a1 != a2);
+    EXPECT_TRUE(frame_allocator<int>(b1) == a1);
+}
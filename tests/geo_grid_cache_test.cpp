@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "Calc/geo_grid_cache.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr double deg_to_rad = M_PI / 180.;
+constexpr double rad_to_deg = 180. / M_PI;
+
+/*
+ * magnetic variation like field : bearing to a geomagnetic pole moving with
+ * <key>, plus a smaller non dipole term.
+ */
+double declination(long key, double latitude, double longitude) {
+    const double pole_lat = 80.6 * deg_to_rad;
+    const double pole_lon = (-72.7 + 0.01 * key) * deg_to_rad;
+    const double lat = latitude * deg_to_rad;
+    const double dlon = pole_lon - longitude * deg_to_rad;
+    const double dipole = std::atan2(std::cos(pole_lat) * std::sin(dlon),
+                                     std::cos(lat) * std::sin(pole_lat) - std::sin(lat) * std::cos(pole_lat) * std::cos(dlon));
+    return dipole * rad_to_deg + 3. * std::sin(3. * longitude * deg_to_rad) * std::cos(2. * lat);
+}
+
+// deterministic random in [min, max]
+double random(unsigned& seed, double min, double max) {
+    seed = seed * 1103515245 + 12345;
+    return min + (max - min) * ((seed >> 16) & 0x7fff) / 32767.;
+}
+
+struct position_t {
+    double latitude;
+    double longitude;
+};
+
+std::vector<position_t> random_positions(unsigned seed, size_t count) {
+    std::vector<position_t> positions;
+    for (size_t i = 0; i < count; ++i) {
+        positions.push_back({ random(seed, -60., 70.), random(seed, -180., 180.) });
+    }
+    return positions;
+}
+
+} // namespace
+
+TEST(geo_grid_cache, same_as_direct_evaluation) {
+    geo_grid_cache<64> cache(1., declination);
+    double max_error = 0.;
+    double mean_error = 0.;
+    const auto positions = random_positions(3, 5000);
+    for (const auto& p : positions) {
+        const double error = std::fabs(cache.get(100, p.latitude, p.longitude) - declination(100, p.latitude, p.longitude));
+        max_error = std::max(max_error, error);
+        mean_error += error;
+    }
+    mean_error /= positions.size();
+    printf("declination error : mean %.4f, max %.4f degree\n", mean_error, max_error);
+    EXPECT_LT(max_error, 0.05);
+    EXPECT_LT(mean_error, 0.01);
+
+    // exact on grid nodes
+    EXPECT_DOUBLE_EQ(cache.get(100, 45., 6.), declination(100, 45., 6.));
+    EXPECT_DOUBLE_EQ(cache.get(100, -33., -71.), declination(100, -33., -71.));
+}
+
+TEST(geo_grid_cache, flight_only_evaluate_prefetched_cells) {
+    geo_grid_cache<64> cache(1., declination);
+
+    // 1000 km straight flight, prefetched every 5 km
+    size_t evaluate_count = cache.evaluate_count();
+    for (double d = 0.; d < 1000.; d += 5.) {
+        const double latitude = 44. + d / 111.;
+        const double longitude = 5. + d / 200.;
+        cache.prefetch(7, latitude, longitude);
+        evaluate_count = cache.evaluate_count();
+
+        cache.get(7, latitude, longitude);
+        cache.get(7, latitude + 0.5, longitude - 0.5);
+        EXPECT_EQ(cache.evaluate_count(), evaluate_count);
+    }
+    // each node is evaluated once
+    printf("%zu nodes evaluated for 1000 km\n", evaluate_count);
+    EXPECT_LT(evaluate_count, 100U);
+
+    // new date : evaluate again
+    cache.get(8, 50., 7.5);
+    EXPECT_EQ(cache.evaluate_count(), evaluate_count + 4);
+    EXPECT_NE(cache.get(8, 50., 7.5), cache.get(7, 50., 7.5));
+}
+
+TEST(geo_grid_cache, result_do_not_depend_on_cache_content) {
+    const auto positions = random_positions(5, 2000);
+
+    geo_grid_cache<64> reference(1., declination);
+    std::vector<double> expected;
+    for (const auto& p : positions) {
+        expected.push_back(reference.get(1, p.latitude, p.longitude));
+    }
+
+    // small cache, reverse order, cleared and prefetched elsewhere
+    geo_grid_cache<32> cache(1., declination);
+    for (size_t i = positions.size(); i-- > 0;) {
+        if (i % 100 == 0) {
+            cache.clear();
+            cache.prefetch(1, -positions[i].latitude, positions[i].longitude + 90.);
+        }
+        ASSERT_EQ(cache.get(1, positions[i].latitude, positions[i].longitude), expected[i]);
+    }
+}
+
+TEST(geo_grid_cache, failed_evaluation_not_cached) {
+    unsigned failures = 1;
+    geo_grid_cache<64> cache(1., [&](long key, double latitude, double longitude) {
+        if (failures) {
+            --failures;
+            return std::nan("");
+        }
+        return declination(key, latitude, longitude);
+    });
+
+    EXPECT_TRUE(std::isnan(cache.get(100, 45., 6.)));
+    EXPECT_EQ(cache.evaluate_count(), 4U);
+
+    // failed node is evaluated again, other nodes are cached
+    EXPECT_DOUBLE_EQ(cache.get(100, 45., 6.), declination(100, 45., 6.));
+    EXPECT_EQ(cache.evaluate_count(), 5U);
+    EXPECT_DOUBLE_EQ(cache.get(100, 45., 6.), declination(100, 45., 6.));
+    EXPECT_EQ(cache.evaluate_count(), 5U);
+}
+
+TEST(geo_grid_cache, thread_safe) {
+    const auto positions = random_positions(9, 2000);
+
+    geo_grid_cache<64> reference(1., declination);
+    std::vector<double> expected;
+    for (const auto& p : positions) {
+        expected.push_back(reference.get(1, p.latitude, p.longitude));
+    }
+
+    // like `SGMagVar`, evaluation is not reentrant
+    std::atomic<int> running = 0;
+    std::atomic<bool> reentrant = false;
+    geo_grid_cache<32> cache(1., [&](long key, double latitude, double longitude) {
+        if (++running > 1) {
+            reentrant = true;
+        }
+        const double value = declination(key, latitude, longitude);
+        --running;
+        return value;
+    });
+
+    std::atomic<size_t> mismatch = 0;
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < positions.size(); i += 2) {
+                const auto& p = positions[i];
+                if (t == 0) {
+                    cache.prefetch(1, p.latitude, p.longitude);
+                }
+                if (cache.get(1, p.latitude, p.longitude) != expected[i]) {
+                    ++mismatch;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatch, 0U);
+    EXPECT_FALSE(reentrant);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "Geographic/SphereBatch.h"
+#include "PolyTrig.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr double deg_to_rad = M_PI / 180.;
+constexpr double rad_to_deg = 180. / M_PI;
+
+// scalar libm reference, same formula as `DistanceBearing()` FAI sphere
+void ref_distance_bearing(const GeoPoint& origin, const GeoPoint& dest, double& distance, double& bearing) {
+    const double lat1 = origin.latitude * deg_to_rad;
+    const double lat2 = dest.latitude * deg_to_rad;
+    const double dlon = (dest.longitude - origin.longitude) * deg_to_rad;
+    const double clat1 = cos(lat1);
+    const double clat2 = cos(lat2);
+
+    const double s1 = sin((lat2 - lat1) / 2);
+    const double s2 = sin(dlon / 2);
+    const double a = std::max(0.0, std::min(1.0, s1 * s1 + clat1 * clat2 * s2 * s2));
+    distance = sphere::earth_radius * 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
+
+    const double y = sin(dlon) * clat2;
+    const double x = clat1 * sin(lat2) - sin(lat1) * clat2 * cos(dlon);
+    bearing = atan2(y, x) * rad_to_deg;
+    if (bearing < 0) {
+        bearing += 360;
+    }
+}
+
+std::vector<GeoPoint> random_points(const GeoPoint& origin, double range, size_t count) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-range, range);
+    std::vector<GeoPoint> points(count);
+    for (auto& p : points) {
+        p = { origin.latitude + dist(gen), origin.longitude + dist(gen) };
+    }
+    return points;
+}
+
+} // namespace
+
+TEST(poly_trig, accuracy) {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> angle(-1000., 1000.);
+    std::uniform_real_distribution<double> coord(-10., 10.);
+
+    for (int i = 0; i < 100000; ++i) {
+        const double x = angle(gen);
+        double s, c;
+        poly_sin_cos(x, s, c);
+        ASSERT_NEAR(s, sin(x), 1e-15);
+        ASSERT_NEAR(c, cos(x), 1e-15);
+
+        const double y = coord(gen);
+        const double z = coord(gen);
+        ASSERT_NEAR(poly_atan2(y, z), atan2(y, z), 1e-15);
+    }
+    EXPECT_EQ(poly_atan2(0., 0.), 0.);
+    EXPECT_NEAR(poly_atan2(1., 0.), M_PI / 2, 1e-16);
+    EXPECT_NEAR(poly_atan2(-1., 0.), -M_PI / 2, 1e-16);
+    EXPECT_NEAR(poly_atan2(0., -1.), M_PI, 1e-16);
+}
+
+TEST(sphere_batch, accuracy) {
+    const GeoPoint origin = { 45.8, 6.9 };
+    const auto points = random_points(origin, 5., 10000);
+
+    std::vector<double> distance(points.size());
+    std::vector<double> bearing(points.size());
+    sphere::DistanceBearing(origin, points.data(), points.size(), distance.data(), bearing.data());
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        double ref_distance, ref_bearing;
+        ref_distance_bearing(origin, points[i], ref_distance, ref_bearing);
+        ASSERT_NEAR(distance[i], ref_distance, 1e-6);
+        ASSERT_NEAR(bearing[i], ref_bearing, 1e-9);
+    }
+
+    // round trip
+    std::vector<GeoPoint> out(points.size());
+    sphere::FindLatitudeLongitude(origin, bearing.data(), distance.data(), points.size(), out.data());
+    for (size_t i = 0; i < points.size(); ++i) {
+        ASSERT_NEAR(out[i].latitude, points[i].latitude, 1e-9);
+        ASSERT_NEAR(out[i].longitude, points[i].longitude, 1e-9);
+    }
+}
+
+TEST(sphere_batch, matches_reference_at_short_range) {
+    // traffic and nearest waypoints range, a few km.
+    const GeoPoint origin = { 45.8, 6.9 };
+    const auto points = random_points(origin, 0.05, 1001);
+    std::vector<double> distance(points.size());
+    std::vector<double> bearing(points.size());
+    sphere::DistanceBearing(origin, points.data(), points.size(), distance.data(), bearing.data());
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        double ref_distance, ref_bearing;
+        ref_distance_bearing(origin, points[i], ref_distance, ref_bearing);
+        ASSERT_NEAR(distance[i], ref_distance, 1e-6) << "point " << i;
+        ASSERT_NEAR(bearing[i], ref_bearing, 1e-9) << "point " << i;
+    }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "utils/log_queue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct line_t {
+    unsigned producer;
+    unsigned index;
+    char text[240];
+};
+
+using clock_type = std::chrono::steady_clock;
+
+} // namespace
+
+TEST(log_queue, fifo) {
+    log_queue<unsigned, 8> queue;
+    unsigned value;
+    EXPECT_FALSE(queue.pop(value));
+    for (unsigned i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(8));
+    for (unsigned i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(log_queue, drop_oldest) {
+    log_queue<unsigned, 4> queue;
+    unsigned dropped = 0;
+    for (unsigned i = 0; i < 10; ++i) {
+        dropped += queue.push(i);
+    }
+    EXPECT_EQ(dropped, 6U);
+    unsigned value;
+    for (unsigned i = 6; i < 10; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.pop(value));
+}
+
+/*
+ * 4 producers at 2500 lines/s each, consumer drain queue as fast as it can :
+ * lines of each producer stay ordered, lost lines are only counted by
+ * `push()`, and the last line is never dropped. Push latency is printed only,
+ * it depends on host load.
+ */
+TEST(log_queue, producers_under_load) {
+    constexpr unsigned producer_count = 4;
+    constexpr unsigned lines_by_producer = 2500;
+    constexpr auto period = std::chrono::microseconds(400);
+
+    log_queue<line_t, 256> queue;
+    std::atomic<unsigned> dropped = 0;
+    std::atomic<bool> done = false;
+
+    std::vector<unsigned> received(producer_count + 1, 0);
+    std::vector<unsigned> next_index(producer_count + 1, 0);
+    bool ordered = true;
+    line_t last = {};
+
+    std::thread consumer([&] {
+        line_t line;
+        while (true) {
+            const bool end = done.load();
+            while (queue.pop(line)) {
+                ordered = ordered && (line.index >= next_index[line.producer]);
+                next_index[line.producer] = line.index + 1;
+                ++received[line.producer];
+                last = line;
+            }
+            if (end) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::vector<unsigned>> latencies(producer_count);
+    std::vector<std::thread> producers;
+    for (unsigned p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&, p] {
+            auto& latency = latencies[p];
+            latency.reserve(lines_by_producer);
+            auto next = clock_type::now();
+            for (unsigned i = 0; i < lines_by_producer; ++i) {
+                line_t line = { p, i, {} };
+                snprintf(line.text, sizeof(line.text), "[%09u] . producer %u line %u", i, p, i);
+
+                const auto start = clock_type::now();
+                dropped += queue.push(line);
+                const auto elapsed = clock_type::now() - start;
+                latency.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+                next += period;
+                std::this_thread::sleep_until(next);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    // pushed after all others : drop oldest never drop it.
+    dropped += queue.push({ producer_count, 0, "last" });
+    done = true;
+    consumer.join();
+
+    EXPECT_TRUE(ordered);
+    unsigned total = 0;
+    for (unsigned count : received) {
+        total += count;
+    }
+    EXPECT_EQ(total + dropped.load(), producer_count * lines_by_producer + 1);
+    EXPECT_EQ(last.producer, producer_count);
+    EXPECT_STREQ(last.text, "last");
+
+    std::vector<unsigned> all;
+    for (const auto& latency : latencies) {
+        all.insert(all.end(), latency.begin(), latency.end());
+    }
+    std::sort(all.begin(), all.end());
+    printf("push latency : p50 %u ns, p99 %u ns, max %u ns, %u lines dropped\n",
+           all[all.size() / 2], all[all.size() * 99 / 100], all.back(), dropped.load());
+}
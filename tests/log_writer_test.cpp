@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "utils/log_writer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+struct line_t {
+    unsigned index;
+    char text[64];
+};
+
+/**
+ * append lines to file, like Runtime.log
+ */
+class file_output {
+ public:
+    file_output() {
+        char name[] = "/tmp/log_writer_test_XXXXXX";
+        const int fd = mkstemp(name);
+        if (fd >= 0) {
+            file_name = name;
+            file = fdopen(fd, "w");
+        }
+    }
+
+    ~file_output() {
+        if (file) {
+            fclose(file);
+            unlink(file_name.c_str());
+        }
+    }
+
+    void write(const line_t& line) {
+        fprintf(file, "[%09u] %s\n", line.index, line.text);
+    }
+
+    void lost(unsigned count) {
+        fprintf(file, ". %u log lines lost, queue full\n", count);
+    }
+
+    void flush(bool sync) {
+        fflush(file);
+        std::lock_guard<std::mutex> lock(mutex);
+        sync_count += sync;
+    }
+
+    std::string content() const {
+        std::ifstream stream(file_name);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    unsigned syncs() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sync_count;
+    }
+
+    std::string file_name;
+    FILE* file = nullptr;
+
+ private:
+    std::mutex mutex;
+    unsigned sync_count = 0;
+};
+
+line_t make_line(unsigned index, const char* text) {
+    line_t line = { index, {} };
+    strncpy(line.text, text, sizeof(line.text) - 1);
+    return line;
+}
+
+} // namespace
+
+/*
+ * line pushed while writer thread is running reach the file before stop, and
+ * without flush from caller.
+ */
+TEST(log_writer, written_by_thread) {
+    file_output output;
+    ASSERT_NE(output.file, nullptr);
+    log_writer<line_t, 16, file_output> writer(output);
+    ASSERT_TRUE(writer.start());
+
+    writer.push(make_line(1, ". run log test"));
+
+    bool found = false;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!found && std::chrono::steady_clock::now() < deadline) {
+        found = (output.content().find("[000000001] . run log test") != std::string::npos);
+        if (!found) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    EXPECT_TRUE(found);
+    // first batch is synced, next one only after sync period.
+    EXPECT_EQ(output.syncs(), 1U);
+
+    writer.stop();
+}
+
+TEST(log_writer, written_by_caller_when_stopped) {
+    file_output output;
+    ASSERT_NE(output.file, nullptr);
+    log_writer<line_t, 16, file_output> writer(output);
+
+    writer.push(make_line(1, "before start"));
+    EXPECT_NE(output.content().find("before start"), std::string::npos);
+
+    ASSERT_TRUE(writer.start());
+    writer.push(make_line(2, "running"));
+    writer.stop();
+    // stop write pending lines and sync
+    EXPECT_NE(output.content().find("running"), std::string::npos);
+
+    writer.push(make_line(3, "after stop"));
+    EXPECT_NE(output.content().find("after stop"), std::string::npos);
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "Topology/nearest_shape.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace topology;
+
+namespace {
+
+// same layout as `shapeObj`
+struct test_point {
+    double x;
+    double y;
+};
+
+struct test_line {
+    int numpoints;
+    test_point* point;
+};
+
+class test_shape {
+ public:
+    void add(std::vector<test_point> points) {
+        rings.push_back(std::move(points));
+        lines.clear();
+        for (auto& ring : rings) {
+            lines.push_back({ static_cast<int>(ring.size()), ring.data() });
+        }
+        numlines = lines.size();
+        line = lines.data();
+    }
+
+    int numlines = 0;
+    test_line* line = nullptr;
+
+ private:
+    std::vector<std::vector<test_point>> rings;
+    std::vector<test_line> lines;
+};
+
+// deterministic random in [min, max]
+double random(unsigned& seed, double min, double max) {
+    seed = seed * 1103515245 + 12345;
+    return min + (max - min) * ((seed >> 16) & 0x7fff) / 32767.;
+}
+
+// star shaped ring around <center>, not closed
+std::vector<test_point> star(unsigned& seed, test_point center, double radius, size_t count) {
+    std::vector<test_point> ring;
+    for (size_t i = 0; i < count; ++i) {
+        const double angle = 2. * M_PI * i / count;
+        const double r = radius * random(seed, 0.5, 1.);
+        ring.push_back({ center.x + r * std::cos(angle), center.y + r * std::sin(angle) });
+    }
+    return ring;
+}
+
+/*
+ * linear reference : distance to vertices or to segments sampled every
+ * 1/1000 of their length, and winding angle sum for inside test.
+ */
+double reference_distance(const test_shape& shape, shape_kind kind, const test_point& p, bool& inside) {
+    double best = std::numeric_limits<double>::infinity();
+    double winding = 0.;
+    for (int l = 0; l < shape.numlines; ++l) {
+        const test_line& line = shape.line[l];
+        const int count = (kind == shape_kind::polygon) ? line.numpoints + 1 : line.numpoints;
+        for (int v = 0; v < count; ++v) {
+            const test_point& a = line.point[v % line.numpoints];
+            best = std::min(best, std::hypot(a.x - p.x, a.y - p.y));
+            if (kind == shape_kind::points || v == 0) {
+                continue;
+            }
+            const test_point& prev = line.point[v - 1];
+            for (int k = 0; k <= 1000; ++k) {
+                const double x = prev.x + (a.x - prev.x) * k / 1000.;
+                const double y = prev.y + (a.y - prev.y) * k / 1000.;
+                best = std::min(best, std::hypot(x - p.x, y - p.y));
+            }
+            if (kind == shape_kind::polygon) {
+                double angle = std::atan2(a.y - p.y, a.x - p.x) - std::atan2(prev.y - p.y, prev.x - p.x);
+                angle = std::remainder(angle, 2. * M_PI);
+                winding += angle;
+            }
+        }
+    }
+    // each ring add +-2pi if it contains <p>, even-odd rule on ring count.
+    const long rings = std::lround(std::fabs(winding) / (2. * M_PI));
+    inside = (kind == shape_kind::polygon) && (rings % 2 == 1);
+    return inside ? 0. : best;
+}
+
+nearest_point nearest(const test_shape& shape, shape_kind kind, const test_point& p) {
+    return shape_nearest(shape, kind, [&](double x, double y) {
+        return point_t{ x - p.x, y - p.y };
+    });
+}
+
+} // namespace
+
+TEST(nearest_shape, points_same_as_nearest_vertex) {
+    unsigned seed = 3;
+    test_shape shape;
+    shape.add(star(seed, { 0., 0. }, 5000., 40));
+    shape.add(star(seed, { 8000., 2000. }, 3000., 20));
+
+    for (unsigned i = 0; i < 200; ++i) {
+        const test_point p = { random(seed, -10000., 15000.), random(seed, -10000., 10000.) };
+        bool inside;
+        const double expected = reference_distance(shape, shape_kind::points, p, inside);
+        const nearest_point result = nearest(shape, shape_kind::points, p);
+        ASSERT_TRUE(result.valid());
+        EXPECT_FALSE(result.inside);
+        EXPECT_DOUBLE_EQ(result.distance, expected);
+
+        const auto position = result.position(shape);
+        EXPECT_DOUBLE_EQ(std::hypot(position.first - p.x, position.second - p.y), expected);
+    }
+}
+
+TEST(nearest_shape, polyline_same_as_sampled_segments) {
+    unsigned seed = 5;
+    test_shape shape;
+    // river with a tributary
+    std::vector<test_point> river, tributary;
+    for (int i = 0; i < 30; ++i) {
+        river.push_back({ i * 1000., 2000. * std::sin(i * 0.4) + random(seed, -300., 300.) });
+    }
+    for (int i = 0; i < 10; ++i) {
+        tributary.push_back({ 12000. + i * 300., 2000. + i * 900. });
+    }
+    shape.add(river);
+    shape.add(tributary);
+
+    for (unsigned i = 0; i < 200; ++i) {
+        const test_point p = { random(seed, -5000., 35000.), random(seed, -8000., 12000.) };
+        bool inside;
+        const double expected = reference_distance(shape, shape_kind::polyline, p, inside);
+        const nearest_point result = nearest(shape, shape_kind::polyline, p);
+        ASSERT_TRUE(result.valid());
+        // reference is sampled every 1/1000 of segment length ( < 2 m here )
+        EXPECT_LE(result.distance, expected + 1e-9);
+        EXPECT_NEAR(result.distance, expected, 2.);
+
+        const auto position = result.position(shape);
+        EXPECT_NEAR(std::hypot(position.first - p.x, position.second - p.y), result.distance, 1e-6);
+    }
+}
+
+TEST(nearest_shape, polygon_inside_and_border) {
+    unsigned seed = 11;
+    test_shape shape;
+    // lake with an island, and second open ring
+    shape.add(star(seed, { 0., 0. }, 10000., 60));
+    shape.add(star(seed, { 1000., 500. }, 2000., 12));
+    shape.add(star(seed, { 25000., 0. }, 4000., 16));
+
+    unsigned inside_count = 0;
+    for (unsigned i = 0; i < 300; ++i) {
+        const test_point p = { random(seed, -15000., 32000.), random(seed, -15000., 15000.) };
+        bool inside;
+        const double expected = reference_distance(shape, shape_kind::polygon, p, inside);
+        const nearest_point result = nearest(shape, shape_kind::polygon, p);
+        ASSERT_TRUE(result.valid());
+        ASSERT_EQ(result.inside, inside) << p.x << " " << p.y;
+        if (inside) {
+            EXPECT_EQ(result.distance, 0.);
+            ++inside_count;
+        } else {
+            EXPECT_LE(result.distance, expected + 1e-9);
+            EXPECT_NEAR(result.distance, expected, 2.);
+            const auto position = result.position(shape);
+            EXPECT_NEAR(std::hypot(position.first - p.x, position.second - p.y), result.distance, 1e-6);
+        }
+    }
+    EXPECT_GT(inside_count, 30U);
+
+    // island is not lake
+    bool inside;
+    EXPECT_FALSE(nearest(shape, shape_kind::polygon, { 1000., 500. }).inside);
+    reference_distance(shape, shape_kind::polygon, { 1000., 500. }, inside);
+    EXPECT_FALSE(inside);
+}
+
+TEST(nearest_shape, nearest_list_same_as_sorted_scan) {
+    unsigned seed = 17;
+    std::vector<std::pair<double, unsigned>> all;
+    nearest_list<unsigned, 5> list;
+    EXPECT_TRUE(list.empty());
+    for (unsigned i = 0; i < 1000; ++i) {
+        const double distance = random(seed, 0., 70000.);
+        all.emplace_back(distance, i);
+        list.insert(distance, i);
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(list.size(), 5U);
+    for (size_t i = 0; i < list.size(); ++i) {
+        EXPECT_EQ(list[i].distance, all[i].first);
+        EXPECT_EQ(list[i].value, all[i].second);
+    }
+    EXPECT_FALSE(list.insert(all[5].first, 9999));
+}
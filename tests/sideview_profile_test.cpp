@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "Draw/Multimaps/sideview_profile.h"
+#include <cmath>
+
+namespace {
+
+constexpr size_t sample_count = 800;
+constexpr double range = 40000.;          // m
+constexpr double start = -5000.;          // m
+constexpr double spacing = range / (sample_count - 1);
+
+using profile_t = sideview_profile<sample_count>;
+
+// smooth synthetic terrain
+double terrain_height(const GeoPoint& position) {
+    return 1000. + 500. * std::sin(position.latitude * 50.) * std::cos(position.longitude * 70.);
+}
+
+struct sampler_t {
+    size_t count = 0;
+
+    double operator()(const GeoPoint& position) {
+        ++count;
+        return terrain_height(position);
+    }
+};
+
+GeoPoint move(const GeoPoint& origin, double bearing, double distance) {
+    GeoPoint out;
+    sphere::FindLatitudeLongitude(origin, &bearing, &distance, 1, &out);
+    return out;
+}
+
+double distance(const GeoPoint& a, const GeoPoint& b) {
+    double d;
+    sphere::DistanceBearing(a, &b, 1, &d, nullptr);
+    return d;
+}
+
+/*
+ * each cached sample must be close to the sample computed from scratch, and
+ * have the terrain height of its own position.
+ */
+void check_profile(const profile_t& profile, const GeoPoint& origin, double bearing) {
+    profile_t reference;
+    sampler_t sampler;
+    reference.update(origin, bearing, start, range, 0, sampler);
+
+    for (size_t i = 0; i < sample_count; ++i) {
+        const GeoPoint cached = { profile.latitudes()[i], profile.longitudes()[i] };
+        const GeoPoint expected = { reference.latitudes()[i], reference.longitudes()[i] };
+        ASSERT_LT(distance(cached, expected), spacing) << "sample " << i;
+        ASSERT_EQ(profile.heights()[i], terrain_height(cached)) << "sample " << i;
+    }
+}
+
+} // namespace
+
+TEST(sideview_profile, same_line_is_not_sampled_again) {
+    const GeoPoint origin = { 45.5, 6.2 };
+    profile_t profile;
+    sampler_t sampler;
+    EXPECT_EQ(profile.update(origin, 30., start, range, 0, sampler), sample_count);
+    EXPECT_EQ(profile.update(origin, 30., start, range, 0, sampler), 0U);
+    EXPECT_EQ(sampler.count, sample_count);
+
+    // thermalling drift, much less than one sample
+    EXPECT_EQ(profile.update(move(origin, 120., 10.), 30., start, range, 0, sampler), 0U);
+    check_profile(profile, origin, 30.);
+}
+
+TEST(sideview_profile, straight_flight_shift_samples) {
+    GeoPoint origin = { 45.5, 6.2 };
+    const double bearing = 75.;
+    profile_t profile;
+    sampler_t sampler;
+    profile.update(origin, bearing, start, range, 0, sampler);
+
+    // 50 frames at 40 m/s, 4 fps
+    size_t sampled = 0;
+    for (unsigned frame = 0; frame < 50; ++frame) {
+        origin = move(origin, bearing, 10.);
+        sampled += profile.update(origin, bearing, start, range, 0, sampler);
+        check_profile(profile, origin, bearing);
+    }
+    // only new part of the line
+    EXPECT_NEAR(sampled, 500. / spacing, 2.);
+
+    // and backward
+    origin = move(origin, bearing + 180., 1000.);
+    EXPECT_NEAR(profile.update(origin, bearing, start, range, 0, sampler), 1000. / spacing, 1.);
+    check_profile(profile, origin, bearing);
+}
+
+TEST(sideview_profile, resample_on_change) {
+    const GeoPoint origin = { 45.5, 6.2 };
+    profile_t profile;
+    sampler_t sampler;
+    profile.update(origin, 30., start, range, 0, sampler);
+
+    // turn
+    EXPECT_EQ(profile.update(origin, 40., start, range, 0, sampler), sample_count);
+    check_profile(profile, origin, 40.);
+    // lateral move
+    EXPECT_EQ(profile.update(move(origin, 130., 200.), 40., start, range, 0, sampler), sample_count);
+    // zoom
+    EXPECT_EQ(profile.update(origin, 40., start, range * 2, 0, sampler), sample_count);
+    // terrain reload
+    EXPECT_EQ(profile.update(origin, 40., start, range * 2, 1, sampler), sample_count);
+    // jump farther than range
+    EXPECT_EQ(profile.update(move(origin, 40., range * 2), 40., start, range * 2, 1, sampler), sample_count);
+
+    profile.invalidate();
+    EXPECT_EQ(profile.update(origin, 40., start, range * 2, 1, sampler), sample_count);
+}
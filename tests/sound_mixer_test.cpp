@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include "Sound/sound_mixer.h"
+#include <cstdio>
+#include <vector>
+
+using namespace sound;
+
+namespace {
+
+constexpr size_t period_frames = 256;
+
+pcm_buffer_ptr constant_sound(int16_t value, size_t frames) {
+    const std::vector<int16_t> samples(frames, value);
+    return make_pcm_buffer(samples.data(), samples.size(), 1, sample_rate);
+}
+
+std::vector<int16_t> mix(sound_mixer& mixer, size_t frames) {
+    std::vector<int16_t> out(frames);
+    mixer.mix(out.data(), frames);
+    return out;
+}
+
+} // namespace
+
+TEST(sound_mixer, convert_to_mixer_format) {
+    // stereo 44100 Hz : channels averaged, half samples
+    std::vector<int16_t> stereo;
+    for (int i = 0; i < 1000; ++i) {
+        stereo.push_back(1000);
+        stereo.push_back(3000);
+    }
+    const auto buffer = make_pcm_buffer(stereo.data(), 1000, 2, 44100);
+    ASSERT_EQ(buffer->samples.size(), 500U);
+    for (int16_t sample : buffer->samples) {
+        EXPECT_EQ(sample, 2000);
+    }
+
+    const std::vector<int16_t> mono = { 0, 100, 200, 300 };
+    const auto same = make_pcm_buffer(mono.data(), mono.size(), 1, sample_rate);
+    EXPECT_EQ(same->samples, mono);
+}
+
+TEST(sound_mixer, voices_are_mixed_and_saturated) {
+    sound_mixer mixer;
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, 0));
+
+    EXPECT_TRUE(mixer.play(constant_sound(100, 10), priority::info));
+    EXPECT_TRUE(mixer.play(constant_sound(200, 5), priority::info));
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, 300));
+    // second sound ends after 1 sample
+    EXPECT_EQ(mix(mixer, 4), (std::vector<int16_t>{ 300, 100, 100, 100 }));
+    EXPECT_EQ(mix(mixer, 4), (std::vector<int16_t>{ 100, 100, 0, 0 }));
+    EXPECT_FALSE(mixer.active());
+
+    mixer.play(constant_sound(30000, 4), priority::info);
+    mixer.play(constant_sound(30000, 4), priority::info);
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, INT16_MAX));
+}
+
+TEST(sound_mixer, priorities) {
+    sound_mixer mixer;
+    mixer.play(constant_sound(100, 1000), priority::info);
+    mixer.play(constant_sound(10, 1000), priority::click);
+
+    // alarm pre-empts waypoint chime and click
+    EXPECT_TRUE(mixer.play(constant_sound(1000, 1000), priority::alarm));
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, 1000));
+
+    // nothing else while alarm is playing, except another alarm
+    EXPECT_FALSE(mixer.play(constant_sound(100, 1000), priority::info));
+    EXPECT_TRUE(mixer.play(constant_sound(2000, 1000), priority::alarm));
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, 3000));
+
+    mixer.stop();
+    EXPECT_FALSE(mixer.active());
+    EXPECT_TRUE(mixer.play(constant_sound(100, 1000), priority::info));
+}
+
+TEST(sound_mixer, sound_priorities_by_name) {
+    EXPECT_EQ(get_priority("LK_AIRSPACE.WAV"), priority::alarm);
+    EXPECT_EQ(get_priority("LK_SONAR_H1.WAV"), priority::alarm);
+    EXPECT_EQ(get_priority("TARGVISIBLE.WAV"), priority::alarm);
+    EXPECT_EQ(get_priority("LK_TASKPOINT.WAV"), priority::info);
+    EXPECT_EQ(get_priority("IDR_WAV_DRIP"), priority::click);
+    EXPECT_EQ(get_priority("IDR_WAV_CLICK"), priority::click);
+}
+
+/*
+ * task events : DoStatusMessage play its default drip, then event play
+ * its chime, which must not be dropped.
+ */
+TEST(sound_mixer, status_drip_followed_by_info_chime) {
+    sound_mixer mixer;
+    EXPECT_TRUE(mixer.play(constant_sound(10, 1000), get_priority("IDR_WAV_DRIP")));
+    EXPECT_TRUE(mixer.play(constant_sound(500, 1000), get_priority("LK_TASKPOINT.WAV")));
+    EXPECT_EQ(mix(mixer, 4), std::vector<int16_t>(4, 500));
+}
+
+TEST(sound_mixer, oldest_voice_replaced_when_full) {
+    sound_mixer mixer;
+    mixer.play(constant_sound(1, 1000), priority::info);
+    for (size_t i = 1; i < sound_mixer::max_voices; ++i) {
+        mixer.play(constant_sound(10, 1000), priority::info);
+    }
+    mixer.play(constant_sound(10, 1000), priority::info);
+    EXPECT_EQ(mix(mixer, 1).front(), int16_t(10 * sound_mixer::max_voices));
+}
+
+TEST(sound_mixer, request_queue_keeps_alarms_when_full) {
+    request_queue<int, 16> queue;
+    EXPECT_TRUE(queue.push(0, priority::alarm));
+    for (int i = 1; i < 16; ++i) {
+        EXPECT_TRUE(queue.push(i, (i % 2) ? priority::click : priority::info));
+    }
+    EXPECT_EQ(queue.size(), 16U);
+
+    // full : oldest click dropped, then oldest info once clicks are gone
+    for (int i = 16; i < 40; ++i) {
+        EXPECT_TRUE(queue.push(i, priority::info));
+    }
+    EXPECT_EQ(queue.size(), 16U);
+    // full of alarms : lower priority request is dropped
+    for (int i = 40; i < 56; ++i) {
+        EXPECT_TRUE(queue.push(i, priority::alarm));
+    }
+    EXPECT_FALSE(queue.push(56, priority::info));
+    EXPECT_TRUE(queue.push(57, priority::alarm));
+
+    const auto requests = queue.take();
+    EXPECT_TRUE(queue.empty());
+    ASSERT_EQ(requests.size(), 16U);
+    // first alarm dropped by last one, others in request order
+    for (size_t i = 0; i < 15; ++i) {
+        EXPECT_EQ(requests[i].first, int(41 + i));
+        EXPECT_EQ(requests[i].second, priority::alarm);
+    }
+    EXPECT_EQ(requests.back().first, 57);
+}
+
+TEST(sound_mixer, request_queue_drops_oldest_of_lowest_priority) {
+    request_queue<int, 4> queue;
+    queue.push(0, priority::alarm);
+    queue.push(1, priority::click);
+    queue.push(2, priority::info);
+    queue.push(3, priority::click);
+    queue.push(4, priority::info);  // drop 1
+    queue.push(5, priority::info);  // drop 3
+    queue.push(6, priority::alarm); // drop 2
+
+    const auto requests = queue.take();
+    std::vector<int> items;
+    for (const auto& request : requests) {
+        items.push_back(request.first);
+    }
+    EXPECT_EQ(items, (std::vector<int>{ 0, 4, 5, 6 }));
+}
+
+/*
+ * busy situation : file sink is fed period by period while waypoint chimes
+ * and clicks are requested, alarm must be in next period, alone.
+ */
+TEST(sound_mixer, alarm_latency_with_file_sink) {
+    FILE* file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    file_pcm_sink sink(file);
+    sound_mixer mixer;
+    std::vector<int16_t> period;
+
+    const auto chime = constant_sound(500, sample_rate);
+    const auto click = constant_sound(50, 100);
+    const auto alarm = constant_sound(8000, sample_rate / 2);
+
+    size_t written = 0;
+    size_t alarm_request = 0;
+    for (unsigned i = 0; i < 40; ++i) {
+        if (i % 4 == 0) {
+            mixer.play(chime, priority::info);
+        }
+        mixer.play(click, priority::click);
+        if (i == 21) {
+            mixer.play(alarm, priority::alarm);
+            alarm_request = written;
+        }
+        if (render(mixer, sink, period, period_frames)) {
+            written += period_frames;
+        }
+    }
+
+    std::vector<int16_t> output(written);
+    rewind(file);
+    ASSERT_EQ(fread(output.data(), sizeof(int16_t), written, file), written);
+    fclose(file);
+
+    size_t alarm_start = 0;
+    while (alarm_start < output.size() && output[alarm_start] != 8000) {
+        ++alarm_start;
+    }
+    ASSERT_LT(alarm_start, output.size());
+    const double latency_ms = (alarm_start - alarm_request) * 1000. / sample_rate;
+    printf("alarm latency : %zu frames, %.1f ms + device buffer\n", alarm_start - alarm_request, latency_ms);
+    EXPECT_LT(alarm_start - alarm_request, period_frames);
+
+    // alarm alone until its end, chimes and clicks are ignored meanwhile
+    const size_t alarm_end = std::min(output.size(), alarm_start + alarm->samples.size());
+    for (size_t i = alarm_start; i < alarm_end; ++i) {
+        ASSERT_EQ(output[i], 8000) << "sample " << i;
+    }
+}
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include "Calc/thermal_estimator.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using vector_t = thermal_estimator::vector_t;
+
+constexpr size_t history_size = 60;
+
+/*
+ * former `ThermalLocator` : last 60 points drifted with current wind, then
+ * lift and time weighted mean, in fixed point.
+ */
+class reference_locator {
+ public:
+    void add(double time, const vector_t& position, double lift) {
+        points[index] = { time, position, static_cast<int>(std::lround(std::max(lift, -0.1) * 10)), true };
+        index = (index + 1) % history_size;
+        if (count < history_size - 1) {
+            ++count;
+        }
+    }
+
+    bool center(double time, const vector_t& drift, vector_t& out) const {
+        if (count < thermal_estimator::min_samples) {
+            return false;
+        }
+        long xav = 0, yav = 0, sweight = 0;
+        for (const auto& p : points) {
+            if (p.valid) {
+                const int iweight = std::lround(std::exp(-1.5 * (time - p.time) / history_size) * 100);
+                const vector_t v = p.position + drift * (time - p.time);
+                xav += std::lround(v.x * iweight);
+                yav += std::lround(v.y * iweight);
+                sweight += iweight;
+            }
+        }
+        xav /= sweight;
+        yav /= sweight;
+        long sx = 0, sy = 0, slogw = 0;
+        for (const auto& p : points) {
+            if (p.valid) {
+                const int iweight = std::lround(std::exp(-1.5 * (time - p.time) / history_size) * 100);
+                const vector_t v = p.position + drift * (time - p.time);
+                sx += (std::lround(v.x * iweight) - xav * iweight) * p.iw;
+                sy += (std::lround(v.y * iweight) - yav * iweight) * p.iw;
+                slogw += p.iw * iweight;
+            }
+        }
+        if (slogw <= 0) {
+            return false;
+        }
+        out = { static_cast<double>(sx / slogw + xav), static_cast<double>(sy / slogw + yav) };
+        return true;
+    }
+
+ private:
+    struct point_t {
+        double time;
+        vector_t position;
+        int iw;
+        bool valid;
+    };
+    point_t points[history_size] = {};
+    size_t index = 0;
+    size_t count = 0;
+};
+
+// deterministic noise in [-1, 1]
+double noise(unsigned& seed) {
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 16) & 0x7fff) / 16383.5 - 1.;
+}
+
+/*
+ * circling flight in a drifting thermal, 1 Hz samples like GPS fix.
+ */
+struct thermal_flight {
+    vector_t drift;         // m/s
+    vector_t core_start;    // m
+    vector_t circle_start;  // m, circle center
+    double circle_radius;   // m
+    double period;          // s, one turn
+    double core_lift;       // m/s
+    double core_radius;     // m
+    double vario_noise;     // m/s
+
+    vector_t core(double time) const {
+        return core_start + drift * time;
+    }
+
+    vector_t position(double time) const {
+        const double angle = 2. * M_PI * time / period;
+        return circle_start + drift * time + vector_t{ circle_radius * std::sin(angle), circle_radius * std::cos(angle) };
+    }
+
+    double lift(const vector_t& position, double time) const {
+        const vector_t d = position - core(time);
+        return core_lift * std::exp(-(d.x * d.x + d.y * d.y) / (core_radius * core_radius)) - 0.5;
+    }
+};
+
+struct result_t {
+    double mean_error = 0.;   // m, distance to thermal core
+    double mean_jitter = 0.;  // m, move of center between samples, without drift
+};
+
+template<typename Center>
+result_t fly(const thermal_flight& flight, double duration, Center&& center) {
+    unsigned seed = 7;
+    result_t result;
+    unsigned count = 0;
+    vector_t previous = {};
+    bool has_previous = false;
+    for (double time = 0.; time < duration; time += 1.) {
+        const vector_t position = flight.position(time);
+        const double lift = flight.lift(position, time) + flight.vario_noise * noise(seed);
+        vector_t estimate;
+        if (!center(time, position, lift, estimate)) {
+            has_previous = false;
+            continue;
+        }
+        if (time >= 30.) { // first turn
+            const vector_t error = estimate - flight.core(time);
+            result.mean_error += std::hypot(error.x, error.y);
+            if (has_previous) {
+                const vector_t move = estimate - previous - flight.drift;
+                result.mean_jitter += std::hypot(move.x, move.y);
+            }
+            ++count;
+        }
+        previous = estimate;
+        has_previous = true;
+    }
+    result.mean_error /= count;
+    result.mean_jitter /= count;
+    return result;
+}
+
+result_t fly_reference(const thermal_flight& flight, double duration) {
+    reference_locator locator;
+    return fly(flight, duration, [&](double time, const vector_t& position, double lift, vector_t& out) {
+        locator.add(time, position, lift);
+        return locator.center(time, flight.drift, out);
+    });
+}
+
+result_t fly_estimator(const thermal_flight& flight, double duration) {
+    thermal_estimator estimator;
+    return fly(flight, duration, [&](double time, const vector_t& position, double lift, vector_t& out) {
+        estimator.add(time, position, flight.drift, lift);
+        return estimator.center(out);
+    });
+}
+
+std::vector<thermal_flight> recorded_circles() {
+    return {
+        // calm, centred
+        { { 0., 0. }, { 0., 0. }, { 30., -20. }, 100., 22., 3., 120., 0.3 },
+        // wind, glider circling off-centre
+        { { 3., 1. }, { 0., 0. }, { 120., 60. }, 110., 25., 2.5, 150., 0.5 },
+        // strong wind, narrow thermal, noisy vario
+        { { 7., -2. }, { 0., 0. }, { -60., 90. }, 90., 20., 4., 90., 1. },
+    };
+}
+
+} // namespace
+
+TEST(thermal_estimator, same_accuracy_smoother_than_former_locator) {
+    for (const auto& flight : recorded_circles()) {
+        const result_t reference = fly_reference(flight, 180.);
+        const result_t result = fly_estimator(flight, 180.);
+        printf("error %.0f m, jitter %.1f m/s ( former : error %.0f m, jitter %.1f m/s )\n",
+               result.mean_error, result.mean_jitter, reference.mean_error, reference.mean_jitter);
+
+        EXPECT_LT(result.mean_error, reference.mean_error * 1.1 + 5.);
+        EXPECT_LT(result.mean_jitter, reference.mean_jitter);
+    }
+}
+
+TEST(thermal_estimator, not_enough_samples_or_lift) {
+    thermal_estimator estimator;
+    vector_t center;
+    for (unsigned i = 0; i < thermal_estimator::min_samples - 1; ++i) {
+        estimator.add(i, { 10. * i, 0. }, {}, 2.);
+        EXPECT_FALSE(estimator.center(center));
+    }
+    estimator.add(4., { 40., 0. }, {}, 2.);
+    ASSERT_TRUE(estimator.center(center));
+    EXPECT_GT(center.x, 20.);
+
+    // time goes backward : replay restarted
+    estimator.add(1., { 0., 0. }, {}, 2.);
+    EXPECT_FALSE(estimator.center(center));
+
+    estimator.reset();
+    for (unsigned i = 0; i < thermal_estimator::min_samples; ++i) {
+        estimator.add(i, { 10. * i, 0. }, {}, -2.);
+    }
+    EXPECT_FALSE(estimator.center(center));
+}
+
+TEST(thermal_estimator, drift_follow_air_mass) {
+    thermal_estimator estimator;
+    const vector_t drift = { 5., 0. };
+    for (unsigned i = 0; i < 10; ++i) {
+        estimator.add(i, vector_t{ 0., 0. } + drift * i, drift, 2.);
+    }
+    vector_t center;
+    ASSERT_TRUE(estimator.center(center));
+    EXPECT_NEAR(center.x, 45., 1e-9);
+    EXPECT_NEAR(center.y, 0., 1e-9);
+}
+
+TEST(thermal_estimator, base_time) {
+    // flat terrain at 500 m, thermal at 2000 m, 2 m/s : 750 s
+    const double flat[] = { 500., 500., 500., 500., 500. };
+    EXPECT_NEAR(thermal_base_time(2000., 2., flat, 5, 1000.), 750., 1e-9);
+
+    // terrain rising along drift line : 200 m each 250 s
+    const double ramp[] = { 500., 700., 900., 1100., 1300. };
+    // 2000 - 2 t = 500 + 0.8 t
+    EXPECT_NEAR(thermal_base_time(2000., 2., ramp, 5, 1000.), 1500. / 2.8, 1e-9);
+
+    // sea level
+    const double sea[] = { 0., 0., 0. };
+    EXPECT_DOUBLE_EQ(thermal_base_time(2000., 2., sea, 3, 1000.), 1000.);
+
+    // glider below terrain
+    EXPECT_DOUBLE_EQ(thermal_base_time(400., 2., flat, 5, 200.), 0.);
+
+    // ridge in the middle
+    const double ridge[] = { 500., 500., 1800., 500., 500. };
+    const double t = thermal_base_time(2000., 2., ridge, 5, 1000.);
+    EXPECT_GT(t, 250.);
+    EXPECT_LT(t, 500.);
+    // thermal and terrain meet at <t>
+    const double terrain = 500. + (1800. - 500.) * (t - 250.) / 250.;
+    EXPECT_NEAR(2000. - 2. * t, terrain, 1e-6);
+}
+
+TEST(thermal_estimator, long_flight_as_accurate_and_smoother) {
+    const thermal_flight flight = recorded_circles()[1];
+    constexpr double duration = 3000.;
+
+    const result_t reference = fly_reference(flight, duration);
+    const result_t result = fly_estimator(flight, duration);
+
+    EXPECT_LT(result.mean_error, reference.mean_error * 1.1 + 5.);
+    EXPECT_LT(result.mean_jitter, reference.mean_jitter);
+}
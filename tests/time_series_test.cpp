@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "utils/time_series.h"
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+// 10 hours barograph, 1 sample by second
+constexpr unsigned flight_samples = 10 * 3600;
+
+double altitude(unsigned t) {
+    return 1000. + 800. * std::sin(t / 600.) + (t % 97);
+}
+
+} // namespace
+
+TEST(time_series, small_series_is_exact) {
+    time_series series;
+    for (unsigned i = 0; i < 100; ++i) {
+        series.append(i, altitude(i));
+    }
+    ASSERT_EQ(series.buckets().size(), 100U);
+    EXPECT_EQ(series.span(), 1U);
+    for (unsigned i = 0; i < 100; ++i) {
+        const auto& bucket = series.buckets()[i];
+        EXPECT_EQ(bucket.x_first, float(i));
+        EXPECT_EQ(bucket.x_last, float(i));
+        EXPECT_DOUBLE_EQ(bucket.y_mean(), altitude(i));
+    }
+
+    series.clear();
+    EXPECT_TRUE(series.empty());
+    EXPECT_EQ(series.span(), 1U);
+}
+
+TEST(time_series, bounded_and_cover_whole_flight) {
+    time_series series;
+    double y_min = altitude(0), y_max = altitude(0), y_sum = 0;
+    for (unsigned t = 0; t < flight_samples; ++t) {
+        const double y = altitude(t);
+        series.append(t, y);
+        y_min = std::min(y_min, y);
+        y_max = std::max(y_max, y);
+        y_sum += y;
+        ASSERT_LE(series.buckets().size(), time_series::capacity);
+    }
+
+    const auto& buckets = series.buckets();
+    EXPECT_GT(buckets.size(), time_series::capacity / 2);
+    EXPECT_EQ(buckets.front().x_first, 0.F);
+    EXPECT_EQ(buckets.back().x_last, float(flight_samples - 1));
+
+    unsigned count = 0;
+    double sum = 0;
+    float bucket_min = buckets.front().y_min, bucket_max = buckets.front().y_max;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        count += buckets[i].count;
+        sum += buckets[i].y_sum;
+        bucket_min = std::min(bucket_min, buckets[i].y_min);
+        bucket_max = std::max(bucket_max, buckets[i].y_max);
+        if (i > 0) {
+            // contiguous, ordered, no overlap
+            ASSERT_LT(buckets[i - 1].x_last, buckets[i].x_first);
+        }
+    }
+    EXPECT_EQ(count, flight_samples);
+    EXPECT_NEAR(sum, y_sum, 1e-6 * y_sum);
+    EXPECT_FLOAT_EQ(bucket_min, y_min);
+    EXPECT_FLOAT_EQ(bucket_max, y_max);
+}
+
+TEST(time_series, resample_to_pixels) {
+    time_series series;
+    for (unsigned t = 0; t < flight_samples; ++t) {
+        series.append(t, altitude(t));
+    }
+
+    std::vector<time_series::bucket_t> out;
+    for (size_t width : { 1, 240, 480, 800 }) {
+        series.resample(width, out);
+        ASSERT_FALSE(out.empty());
+        ASSERT_LE(out.size(), width);
+
+        unsigned count = 0;
+        for (const auto& bucket : out) {
+            count += bucket.count;
+        }
+        EXPECT_EQ(count, flight_samples);
+        EXPECT_EQ(out.front().x_first, 0.F);
+        EXPECT_EQ(out.back().x_last, float(flight_samples - 1));
+    }
+
+    // wider than stored buckets : copied as is.
+    series.resample(4000, out);
+    EXPECT_EQ(out.size(), series.buckets().size());
+
+    series.resample(0, out);
+    EXPECT_TRUE(out.empty());
+}
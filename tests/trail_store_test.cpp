@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+#include "Calc/trail_store.h"
+#include "Draw/polyline_buckets.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr size_t capacity = 600;
+constexpr size_t colour_count = 16;
+constexpr double meter_by_degree = 111195.;
+
+using store_t = trail_store<capacity>;
+using trail_point_t = store_t::point_t;
+
+struct fix_t {
+    double time;
+    double latitude;
+    double longitude;
+    bool circling;
+    unsigned short colour;
+};
+
+// deterministic random in [min, max]
+double random(unsigned& seed, double min, double max) {
+    seed = seed * 1103515245 + 12345;
+    return min + (max - min) * ((seed >> 16) & 0x7fff) / 32767.;
+}
+
+/*
+ * 6 hours cross country at 1 Hz : straight legs at 30 m/s with a turn every
+ * 15 min, 5 min of circling in drifting thermal every 20 min.
+ */
+std::vector<fix_t> six_hours_flight() {
+    unsigned seed = 13;
+    std::vector<fix_t> fixes;
+    double x = 0., y = 0.; // m
+    double heading = 0.7;
+    const double origin_latitude = 45.;
+    const double x_scale = std::cos(origin_latitude * M_PI / 180.) * meter_by_degree;
+    for (unsigned t = 0; t < 6 * 3600; ++t) {
+        const bool circling = (t % 1200) >= 900;
+        double vario;
+        if (circling) {
+            const double angle = 2. * M_PI * t / 25.;
+            x += 2. + 80. * 2. * M_PI / 25. * std::cos(angle);
+            y += 1. - 80. * 2. * M_PI / 25. * std::sin(angle);
+            vario = random(seed, 0.5, 4.);
+        } else {
+            if (t % 900 == 0) {
+                heading += random(seed, -1., 1.);
+            }
+            x += 30. * std::sin(heading) + random(seed, -1., 1.);
+            y += 30. * std::cos(heading) + random(seed, -1., 1.);
+            vario = random(seed, -3., 1.);
+        }
+        const unsigned short colour = 7 + std::clamp(static_cast<int>(vario * 2.), -7, 7);
+        fixes.push_back({ static_cast<double>(t), origin_latitude + y / meter_by_degree, x / x_scale, circling, colour });
+    }
+    return fixes;
+}
+
+/*
+ * former long trail : one point each 60 s, only one each 10 min in thermal,
+ * and no more points when 600 are stored.
+ */
+std::vector<trail_point_t> former_long_trail(const std::vector<fix_t>& fixes) {
+    std::vector<trail_point_t> trail;
+    double last_time = -1000.;
+    bool was_circling = false;
+    for (const fix_t& fix : fixes) {
+        if (trail.size() >= capacity || fix.time <= last_time + 60.) {
+            continue;
+        }
+        if (fix.circling && was_circling && fix.time < last_time + 600.) {
+            continue;
+        }
+        was_circling = fix.circling;
+        trail.push_back({ static_cast<float>(fix.latitude), static_cast<float>(fix.longitude), 0.f });
+        last_time = fix.time;
+    }
+    return trail;
+}
+
+// same feed as `AddSnailPoint`
+void add_flight(store_t& store, const std::vector<fix_t>& fixes) {
+    double last_time = -1000.;
+    bool was_circling = false;
+    for (const fix_t& fix : fixes) {
+        if (fix.circling && was_circling && fix.time < last_time + 600.) {
+            continue;
+        }
+        was_circling = fix.circling;
+        store.add(fix.latitude, fix.longitude);
+        last_time = fix.time;
+    }
+}
+
+struct screen_point_t {
+    float x;
+    float y;
+};
+
+// distance in m from <fix> to polyline
+double distance_to_trail(const fix_t& fix, const std::vector<screen_point_t>& trail) {
+    const double x_scale = std::cos(fix.latitude * M_PI / 180.) * meter_by_degree;
+    const double px = fix.longitude * x_scale;
+    const double py = fix.latitude * meter_by_degree;
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t i = 1; i < trail.size(); ++i) {
+        const double ax = trail[i - 1].x * x_scale, ay = trail[i - 1].y * meter_by_degree;
+        const double bx = trail[i].x * x_scale, by = trail[i].y * meter_by_degree;
+        const double abx = bx - ax, aby = by - ay;
+        const double length_sq = abx * abx + aby * aby;
+        const double ratio = length_sq > 0. ? std::clamp(((px - ax) * abx + (py - ay) * aby) / length_sq, 0., 1.) : 0.;
+        best = std::min(best, std::hypot(px - ax - abx * ratio, py - ay - aby * ratio));
+    }
+    return best;
+}
+
+std::vector<screen_point_t> to_polyline(const std::vector<trail_point_t>& trail, float tolerance) {
+    std::vector<screen_point_t> polyline;
+    store_t::for_each_visible(trail, tolerance, [&](const trail_point_t& p) {
+        polyline.push_back({ p.longitude, p.latitude });
+    });
+    return polyline;
+}
+
+// max distance of cruise fixes to trail, circling ones are not logged by design
+double max_cruise_error(const std::vector<fix_t>& fixes, const std::vector<screen_point_t>& trail) {
+    double max_error = 0.;
+    for (size_t i = 0; i < fixes.size(); i += 10) {
+        if (!fixes[i].circling) {
+            max_error = std::max(max_error, distance_to_trail(fixes[i], trail));
+        }
+    }
+    return max_error;
+}
+
+// simple projection, like `ScreenProjection::ToScreen`
+struct projection_t {
+    double latitude;
+    double longitude;
+    double scale; // pixel by degree
+
+    screen_point_t operator()(double lat, double lon) const {
+        return { static_cast<float>(400. + (lon - longitude) * scale * std::cos(lat * M_PI / 180.)),
+                 static_cast<float>(240. - (lat - latitude) * scale) };
+    }
+};
+
+} // namespace
+
+TEST(trail_store, whole_flight_within_capacity) {
+    const auto fixes = six_hours_flight();
+
+    store_t store;
+    add_flight(store, fixes);
+    EXPECT_EQ(store.size(), capacity);
+
+    std::vector<trail_point_t> trail;
+    unsigned version = 0;
+    ASSERT_TRUE(store.copy(trail, version));
+    EXPECT_FALSE(store.copy(trail, version));
+
+    // first and last point are kept
+    EXPECT_FLOAT_EQ(trail.front().latitude, static_cast<float>(fixes.front().latitude));
+    const auto last = std::find_if(fixes.rbegin(), fixes.rend(), [](const fix_t& fix) { return !fix.circling; });
+    EXPECT_FLOAT_EQ(trail.back().latitude, static_cast<float>(last->latitude));
+
+    const double error = max_cruise_error(fixes, to_polyline(trail, 0.f));
+
+    const auto former = former_long_trail(fixes);
+    std::vector<screen_point_t> former_polyline;
+    for (const auto& p : former) {
+        former_polyline.push_back({ p.longitude, p.latitude });
+    }
+    const double former_error = max_cruise_error(fixes, former_polyline);
+
+    printf("6 hours : %zu points, max error %.0f m ( former : %zu points, max error %.0f m )\n",
+           trail.size(), error, former.size(), former_error);
+    EXPECT_LT(error, former_error);
+    EXPECT_LT(error, 100.);
+}
+
+TEST(trail_store, level_of_detail) {
+    const auto fixes = six_hours_flight();
+    store_t store;
+    add_flight(store, fixes);
+    std::vector<trail_point_t> trail;
+    unsigned version = 0;
+    store.copy(trail, version);
+    store_t::rank(trail);
+
+    const auto full = to_polyline(trail, 0.f);
+    size_t previous_size = full.size();
+    for (float tolerance : { 50.f, 200.f, 1000.f }) {
+        const auto polyline = to_polyline(trail, tolerance);
+        // distance of hidden points to drawn trail
+        double max_error = 0.;
+        for (const auto& p : trail) {
+            const fix_t fix = { 0., p.latitude, p.longitude, false, 0 };
+            max_error = std::max(max_error, distance_to_trail(fix, polyline));
+        }
+        printf("tolerance %4.0f m : %zu points, max error %.0f m\n", tolerance, polyline.size(), max_error);
+        EXPECT_LE(max_error, 2. * tolerance);
+        EXPECT_LT(polyline.size(), previous_size);
+        previous_size = polyline.size();
+    }
+
+    // first and last point always drawn
+    const auto polyline = to_polyline(trail, 1e9f);
+    ASSERT_EQ(polyline.size(), 2U);
+    EXPECT_EQ(polyline.front().y, trail.back().latitude);
+    EXPECT_EQ(polyline.back().y, trail.front().latitude);
+}
+
+TEST(trail_store, clear_and_small_trail) {
+    store_t store;
+    std::vector<trail_point_t> trail;
+    unsigned version = 0;
+    EXPECT_FALSE(store.copy(trail, version));
+
+    store.add(45., 6.);
+    store.add(45.001, 6.);
+    store.add(45.002, 6.001);
+    ASSERT_TRUE(store.copy(trail, version));
+    ASSERT_EQ(trail.size(), 3U);
+    EXPECT_EQ(trail[0].tolerance, store_t::always_visible);
+    EXPECT_GT(trail[1].tolerance, 0.f);
+    EXPECT_EQ(trail[2].tolerance, store_t::always_visible);
+
+    store.clear();
+    ASSERT_TRUE(store.copy(trail, version));
+    EXPECT_TRUE(trail.empty());
+}
+
+TEST(polyline_buckets, same_segments_as_colour_runs) {
+    unsigned seed = 21;
+    std::vector<unsigned short> colours;
+    for (unsigned i = 0; i < 1000; ++i) {
+        colours.push_back(static_cast<unsigned short>(random(seed, 0., colour_count - 0.01)) / 3 * 3);
+    }
+
+    polyline_buckets<colour_count> buckets;
+    buckets.build(colours.data(), colours.size());
+
+    // each segment drawn once with its colour
+    std::vector<int> segment_colour(colours.size() - 1, -1);
+    int previous_colour = -1;
+    buckets.for_each([&](unsigned colour, const unsigned* firsts, const unsigned* counts, unsigned size) {
+        EXPECT_GT(static_cast<int>(colour), previous_colour);
+        previous_colour = colour;
+        for (unsigned i = 0; i < size; ++i) {
+            ASSERT_GE(counts[i], 2U);
+            for (unsigned j = firsts[i]; j + 1 < firsts[i] + counts[i]; ++j) {
+                EXPECT_EQ(segment_colour[j], -1);
+                segment_colour[j] = colour;
+            }
+        }
+    });
+    for (size_t i = 0; i < segment_colour.size(); ++i) {
+        EXPECT_EQ(segment_colour[i], colours[i]);
+    }
+
+    // single point or empty : nothing to draw
+    buckets.build(colours.data(), 1);
+    EXPECT_EQ(buckets.size(), 0U);
+}
+
+// draw time : LongTrail of tests/benchmark
+TEST(trail_store, draw_six_hours_flight) {
+    const auto fixes = six_hours_flight();
+    store_t store;
+    add_flight(store, fixes);
+    std::vector<trail_point_t> trail;
+    unsigned version = 0;
+    store.copy(trail, version);
+    store_t::rank(trail);
+    const auto former = former_long_trail(fixes);
+
+    const fix_t& last = fixes.back();
+    std::vector<screen_point_t> polyline;
+
+    for (double scale : { 20000., 2000., 200. }) { // ~5 m, 50 m, 500 m by pixel
+        const projection_t project = { last.latitude, last.longitude, scale };
+
+        // former : project all points, skip points near previous one
+        polyline.clear();
+        for (auto it = former.rbegin(); it != former.rend(); ++it) {
+            const screen_point_t p = project(it->latitude, it->longitude);
+            if (polyline.empty() || std::fabs(p.x - polyline.back().x) + std::fabs(p.y - polyline.back().y) > 10.f) {
+                polyline.push_back(p);
+            }
+        }
+        const size_t former_points = polyline.size();
+
+        // level of detail, first point is junction with short trail
+        const float tolerance = 2. * meter_by_degree / scale;
+        polyline.assign(1, project(last.latitude, last.longitude));
+        store_t::for_each_visible(trail, tolerance, [&](const trail_point_t& p) {
+            polyline.push_back(project(p.latitude, p.longitude));
+        });
+
+        printf("long trail, %5.0f m/pixel : %zu points ( former %zu points )\n",
+               meter_by_degree / scale, polyline.size(), former_points);
+        EXPECT_LT(polyline.size(), former_points);
+    }
+
+    // short trail : last 1000 fixes, draw call by colour change or by colour
+    std::vector<unsigned short> colours;
+    for (size_t i = fixes.size() - 1000; i < fixes.size(); ++i) {
+        colours.push_back(fixes[i].colour);
+    }
+    size_t former_calls = 1;
+    for (size_t i = 1; i + 1 < colours.size(); ++i) {
+        if (colours[i] != colours[i - 1]) {
+            ++former_calls;
+        }
+    }
+    polyline_buckets<colour_count> buckets;
+    buckets.build(colours.data(), colours.size());
+    size_t calls = 0;
+    buckets.for_each([&](unsigned, const unsigned*, const unsigned*, unsigned) {
+        ++calls;
+    });
+    printf("short trail : %zu draw calls for %zu runs ( former %zu draw calls )\n",
+           calls, buckets.size(), former_calls);
+    EXPECT_LE(calls, colour_count);
+    EXPECT_LT(calls, former_calls);
+}
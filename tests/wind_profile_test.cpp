@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include "Calc/wind_profile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using vector_t = wind_profile::vector_t;
+
+struct measurement_t {
+    vector_t vector;
+    int quality;
+    long time;
+    double altitude;
+};
+
+/*
+ * former `WindMeasurementList::getWind()` : weighted mean of all measurements.
+ */
+vector_t reference_wind(const std::vector<measurement_t>& measurements, double Time, double alt, bool* found) {
+    constexpr int altRange = 1000;
+    constexpr int timeRange = 3600;
+
+    unsigned int total_quality = 0;
+    vector_t result = { 0, 0 };
+    const int now = static_cast<int>(Time);
+    *found = false;
+    double override_time = 1.1;
+    bool overridden = false;
+
+    for (const auto& m : measurements) {
+        const double altdiff = (alt - m.altitude) / altRange;
+        const double timediff = std::fabs(static_cast<double>(now - m.time) / timeRange);
+        if ((std::fabs(altdiff) < 1.0) && (timediff < 1.0)) {
+            const unsigned q_quality = std::min(5, m.quality) * 100 / 5;
+            const unsigned a_quality = std::lround(((2.0 / (altdiff * altdiff + 1.0)) - 1.0) * 100);
+            const double k = 0.0025;
+            const unsigned t_quality = std::lround(k * (1.0 - timediff) / (timediff * timediff + k) * 200);
+
+            if (m.quality == 6) {
+                if (timediff < override_time) {
+                    override_time = timediff;
+                    total_quality = 0;
+                    result = { 0, 0 };
+                    overridden = true;
+                } else {
+                    continue;
+                }
+            } else if (timediff < override_time) {
+                override_time = timediff;
+                if (overridden) {
+                    overridden = false;
+                    total_quality = 0;
+                    result = { 0, 0 };
+                }
+            }
+            const unsigned quality = q_quality * (a_quality * t_quality);
+            result += m.vector * quality;
+            total_quality += quality;
+        }
+    }
+
+    if (total_quality > 0) {
+        *found = true;
+        result = result / total_quality;
+    }
+    return result;
+}
+
+// wind veering and increasing with altitude
+vector_t true_wind(double altitude) {
+    const double speed = 3. + 7. * std::clamp((altitude - 500.) / 2500., 0., 1.);
+    const double bearing = (240. + 50. * std::clamp((altitude - 500.) / 2500., 0., 1.)) * M_PI / 180.;
+    return { speed * std::cos(bearing), speed * std::sin(bearing) };
+}
+
+// deterministic noise in [-1, 1]
+double noise(unsigned& seed) {
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 16) & 0x7fff) / 16383.5 - 1.;
+}
+
+class store_t {
+ public:
+    void add(double time, const vector_t& wind, double altitude, int quality) {
+        measurements.push_back({ wind, quality, static_cast<long>(time), altitude });
+        profile.add(time, wind, altitude, quality);
+    }
+
+    std::vector<measurement_t> measurements;
+    wind_profile profile;
+};
+
+/*
+ * circling climb : one measurement by turn, like `WindAnalyser`, quality
+ * increase with the number of turns.
+ */
+void thermal(store_t& store, double& time, double& altitude, double top, unsigned& seed) {
+    int quality = 1;
+    while (altitude < top) {
+        time += 25.;
+        altitude += 25. * 2.5;
+        const vector_t wind = true_wind(altitude);
+        store.add(time, { wind.x + 0.7 * noise(seed), wind.y + 0.7 * noise(seed) }, altitude, quality);
+        quality = std::min(5, quality + 1);
+    }
+}
+
+struct comparison_t {
+    double max = 0.;
+    double sum = 0.;
+    unsigned count = 0;
+    unsigned found_mismatch = 0;
+    unsigned found_count = 0;
+
+    void check(const store_t& store, double time, double altitude) {
+        bool found, expected_found;
+        const vector_t wind = store.profile.get(time, altitude, &found);
+        const vector_t expected = reference_wind(store.measurements, time, altitude, &expected_found);
+        if (found != expected_found) {
+            ++found_mismatch;
+        }
+        if (found && expected_found) {
+            const double error = std::hypot(wind.x - expected.x, wind.y - expected.y);
+            max = std::max(max, error);
+            sum += error;
+            ++count;
+        }
+        ++found_count;
+    }
+};
+
+} // namespace
+
+TEST(wind_profile, same_as_former_list_on_circling_flight) {
+    store_t store;
+    unsigned seed = 1;
+    double time = 36000.;
+    double altitude = 600.;
+
+    comparison_t current; // at aircraft altitude, like `WindStore::recalculateWind()`
+    comparison_t profile; // whole profile, like analysis page
+
+    auto check_profile = [&]() {
+        for (double h = 0.; h <= 4000.; h += 50.) {
+            profile.check(store, time, h);
+        }
+    };
+
+    thermal(store, time, altitude, 2400., seed);
+    check_profile();
+
+    // 15 minutes glide down to 1200 m
+    for (unsigned i = 0; i < 36; ++i) {
+        time += 25.;
+        altitude -= 1200. / 36;
+        current.check(store, time, altitude);
+    }
+    check_profile();
+
+    // next thermal, through already measured altitudes
+    const size_t first = store.measurements.size();
+    thermal(store, time, altitude, 2800., seed);
+    for (size_t i = first; i < store.measurements.size(); ++i) {
+        // each new measurement
+        const auto& m = store.measurements[i];
+        current.check(store, m.time, m.altitude);
+    }
+    check_profile();
+
+    // one hour later : nothing left
+    bool found;
+    store.profile.get(time + 3600., altitude, &found);
+    EXPECT_FALSE(found);
+
+    printf("current : max error %.2f m/s, mean %.2f m/s\n", current.max, current.sum / current.count);
+    printf("profile : max error %.2f m/s, mean %.2f m/s, found mismatch %u/%u\n",
+           profile.max, profile.sum / profile.count, profile.found_mismatch, profile.found_count);
+
+    // exponential decay instead of former time weight : less than analyser
+    // noise ( 0.7 m/s here )
+    EXPECT_EQ(current.found_mismatch, 0U);
+    EXPECT_LT(current.max, 1.);
+    EXPECT_LT(current.sum / current.count, 0.3);
+
+    // can only differ at the limits of measured altitudes
+    EXPECT_LE(profile.found_mismatch, 6U);
+    EXPECT_LT(profile.max, 0.75);
+    EXPECT_LT(profile.sum / profile.count, 0.2);
+}
+
+TEST(wind_profile, override) {
+    store_t store;
+    unsigned seed = 1;
+    double time = 36000.;
+    double altitude = 600.;
+    thermal(store, time, altitude, 1500., seed);
+
+    const vector_t pilot = { 5., -5. };
+    store.add(time + 10., pilot, altitude, wind_profile::override_quality);
+
+    bool found;
+    vector_t wind = store.profile.get(time + 20., altitude, &found);
+    ASSERT_TRUE(found);
+    EXPECT_DOUBLE_EQ(wind.x, pilot.x);
+    EXPECT_DOUBLE_EQ(wind.y, pilot.y);
+
+    // next measurement replace pilot wind
+    const vector_t measured = { -2., 3. };
+    store.add(time + 30., measured, altitude, 3);
+    wind = store.profile.get(time + 30., altitude, &found);
+    ASSERT_TRUE(found);
+    EXPECT_NEAR(wind.x, measured.x, 1e-9);
+    EXPECT_NEAR(wind.y, measured.y, 1e-9);
+
+    bool expected_found;
+    const vector_t expected = reference_wind(store.measurements, time + 30., altitude, &expected_found);
+    EXPECT_TRUE(expected_found);
+    EXPECT_NEAR(wind.x, expected.x, 1e-9);
+    EXPECT_NEAR(wind.y, expected.y, 1e-9);
+}
+
+TEST(wind_profile, bands) {
+    EXPECT_EQ(wind_profile::band_index(-5000.), 0U);
+    EXPECT_EQ(wind_profile::band_index(50000.), wind_profile::band_count - 1);
+    EXPECT_DOUBLE_EQ(wind_profile::band_altitude(wind_profile::band_index(1234.)), 1250.);
+
+    wind_profile profile;
+    profile.add(100., { 1., 2. }, 1250., 5);
+    bool found;
+    const vector_t wind = profile.get_band(wind_profile::band_index(2150.), 200., &found);
+    EXPECT_TRUE(found);
+    EXPECT_DOUBLE_EQ(wind.x, 1.);
+    profile.get_band(wind_profile::band_index(2250.), 200., &found);
+    EXPECT_FALSE(found);
+}
+
+TEST(wind_profile, same_as_former_list_with_long_history) {
+    store_t store;
+    unsigned seed = 1;
+    double time = 36000.;
+    double altitude = 0.;
+    while (store.measurements.size() < 200) {
+        altitude = 0.;
+        thermal(store, time, altitude, 3000., seed);
+    }
+
+    comparison_t queries;
+    for (unsigned i = 0; i < 30; ++i) {
+        queries.check(store, time, i * 100.);
+    }
+    EXPECT_EQ(queries.found_mismatch, 0U);
+    EXPECT_LT(queries.max, 0.75);
+}